@@ -0,0 +1,75 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RByteSwap
+#define ROOT_RByteSwap
+
+#include "RtypesCore.h"
+#include "Byteswap.h"
+
+#include <cstddef>
+#include <cstring>
+
+namespace ROOT {
+namespace Internal {
+
+/// Byte order conversion of unsigned integer words, shared by the array (de-)serialization of TBuffer and
+/// TBufferFile.  Not part of the public interface.
+
+inline UShort_t SwapBytes(UShort_t x) { return Rbswap_16(x); }
+inline UInt_t SwapBytes(UInt_t x) { return Rbswap_32(x); }
+inline ULong64_t SwapBytes(ULong64_t x)
+{
+#ifdef R__USEASMSWAP
+   return Rbswap_64(x);
+#else
+   return (ULong64_t(Rbswap_32(UInt_t(x))) << 32) | Rbswap_32(UInt_t(x >> 32));
+#endif
+}
+
+/// The unsigned integer type of N bytes
+template <std::size_t N>
+struct RUIntOfSize;
+template <>
+struct RUIntOfSize<2> {
+   using type = UShort_t;
+};
+template <>
+struct RUIntOfSize<4> {
+   using type = UInt_t;
+};
+template <>
+struct RUIntOfSize<8> {
+   using type = ULong64_t;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy n elements of N bytes from src to dst and reverse the byte order of every element.
+/// The buffers do not need to be aligned; dst may be equal to src for an in-place conversion.  The elements are
+/// accessed through memcpy, without volatile accesses or aliasing, so that the compiler vectorizes the loop.
+
+template <std::size_t N>
+void SwapCopyScalar(void *dst, const void *src, std::size_t n)
+{
+   using UInt_N = typename RUIntOfSize<N>::type;
+   auto d = reinterpret_cast<unsigned char *>(dst);
+   auto s = reinterpret_cast<const unsigned char *>(src);
+   for (std::size_t i = 0; i < n; ++i) {
+      UInt_N val;
+      memcpy(&val, s + i * N, N);
+      val = SwapBytes(val);
+      memcpy(d + i * N, &val, N);
+   }
+}
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
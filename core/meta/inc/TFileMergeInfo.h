@@ -53,11 +53,12 @@ public:
    TString      fOptions;                  // Additional text based option being passed down to customize the merge.
    TObject     *fUserData{nullptr};        // Place holder to pass extra information.  This object will be deleted at the end of each series of objects.
    TIOFeatures *fIOFeatures{nullptr};      // Any ROOT IO features that should be explicitly enabled.
+   Bool_t       fIsIncomplete{kFALSE};     // Set by Merge if the merged object lacks input data that could not be read; the merge is then stopped.
 
    TFileMergeInfo(TDirectory *outputfile) : fOutputDirectory(outputfile) {}
    virtual ~TFileMergeInfo() { delete fUserData; } ;
 
-   void Reset() { fIsFirst = kTRUE; delete fUserData; fUserData = 0; }
+   void Reset() { fIsFirst = kTRUE; fIsIncomplete = kFALSE; delete fUserData; fUserData = 0; }
 
    ClassDef(TFileMergeInfo, 0);
 };
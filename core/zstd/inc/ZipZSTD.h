@@ -17,6 +17,21 @@ extern "C" {
 #endif
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+
+/**
+ * Dictionaries for the compression of many small, similar buffers.  A dictionary is trained on sample buffers with
+ * R__trainZSTDDict() and registered with R__addZSTDDict(), which returns a handle to it; every call of R__addZSTDDict()
+ * must be matched by a call of R__releaseZSTDDict() on the handle, which removes the dictionary once it is no longer
+ * used.  Registering the same content again returns the same handle.  Buffers compressed with R__zipZSTDDict() carry
+ * the identifier of their dictionary and a checksum; R__unzipZSTD() decompresses them with the registered dictionary
+ * of that identifier whose result matches the checksum, so the dictionary must be registered while the buffer is
+ * decompressed.
+ */
+typedef struct R__ZSTDDict R__ZSTDDict;
+int R__trainZSTDDict(char *dict, int dictcapacity, const char *samples, const int *samplesizes, int nsamples);
+R__ZSTDDict *R__addZSTDDict(const char *dict, int dictsize);
+void R__releaseZSTDDict(R__ZSTDDict *dict);
+void R__zipZSTDDict(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, R__ZSTDDict *dict);
 #ifdef __cplusplus
 }
 #endif
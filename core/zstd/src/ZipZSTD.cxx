@@ -14,7 +14,13 @@
 
 #include "zdict.h"
 #include <zstd.h>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <iostream>
 
@@ -22,17 +28,84 @@ static const int kHeaderSize = 9;
 
 static const size_t errorCodeSmallBuffer = (size_t)-70;
 
-void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+using CDict_ptr = std::unique_ptr<ZSTD_CDict, decltype(&ZSTD_freeCDict)>;
+using DDict_ptr = std::unique_ptr<ZSTD_DDict, decltype(&ZSTD_freeDDict)>;
+
+/// A registered dictionary, digested for decompression and, on demand, for compression at a given level
+struct R__ZSTDDict {
+    unsigned fID = 0;
+    std::string fContent;
+    /// The number of R__addZSTDDict() calls not yet matched by R__releaseZSTDDict(), guarded by the registry lock
+    int fNRefs = 0;
+    DDict_ptr fDDict{nullptr, &ZSTD_freeDDict};
+    /// Guarded by the registry lock
+    std::map<int, CDict_ptr> fCDicts;
+};
+
+namespace {
+
+/// The registered dictionaries by identifier.  The identifier is only a 32 bit hash of the content: different
+/// dictionaries can share it, so every identifier maps to the list of the dictionaries that have it.  A dictionary
+/// is removed once it is released by all its users; the decompressions that use it at that time hold a reference.
+struct DictRegistry {
+    std::mutex fMutex;
+    std::unordered_map<unsigned, std::vector<std::shared_ptr<R__ZSTDDict>>> fEntries;
+};
+
+DictRegistry &GetDictRegistry()
+{
+    static DictRegistry registry;
+    return registry;
+}
+
+std::vector<std::shared_ptr<R__ZSTDDict>> GetDicts(unsigned dictid)
+{
+    auto &registry = GetDictRegistry();
+    std::lock_guard<std::mutex> lock(registry.fMutex);
+    auto it = registry.fEntries.find(dictid);
+    return (it == registry.fEntries.end()) ? std::vector<std::shared_ptr<R__ZSTDDict>>() : it->second;
+}
+
+const ZSTD_CDict *GetCDict(R__ZSTDDict &dict, int level)
+{
+    auto &registry = GetDictRegistry();
+    std::lock_guard<std::mutex> lock(registry.fMutex);
+    auto &cdict = dict.fCDicts.emplace(level, CDict_ptr{nullptr, &ZSTD_freeCDict}).first->second;
+    if (!cdict)
+        cdict.reset(ZSTD_createCDict(dict.fContent.data(), dict.fContent.size(), level));
+    return cdict.get();
+}
+
+/// Whether the zstd frame carries the checksum of its content (see the Frame_Header_Descriptor in RFC 8878)
+bool HasChecksum(const unsigned char *frame, size_t size)
+{
+    return size > 4 && (frame[4] & 0x4);
+}
+
+} // anonymous namespace
+
+static void R__zipZSTDImpl(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                           const ZSTD_CDict *cdict)
 {
     using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
     Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
 
     *irep = 0;
 
-    size_t retval = ZSTD_compressCCtx(fCtx.get(),
-                                        &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
-                                        src, static_cast<size_t>(*srcsize),
-                                        2*cxlevel);
+    size_t retval;
+    if (cdict) {
+        // The checksum tells apart the dictionaries that share the identifier of the frame, see R__unzipZSTD()
+        ZSTD_CCtx_setParameter(fCtx.get(), ZSTD_c_checksumFlag, 1);
+        ZSTD_CCtx_refCDict(fCtx.get(), cdict);
+        retval = ZSTD_compress2(fCtx.get(),
+                                &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                src, static_cast<size_t>(*srcsize));
+    } else {
+        retval = ZSTD_compressCCtx(fCtx.get(),
+                                   &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                   src, static_cast<size_t>(*srcsize),
+                                   2*cxlevel);
+    }
 
     if (R__unlikely(ZSTD_isError(retval))) {
         if (R__unlikely(retval != errorCodeSmallBuffer)) {
@@ -58,6 +131,78 @@ void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
     tgt[8] = (inflate_size >> 16) & 0xff;
 }
 
+void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+{
+    R__zipZSTDImpl(cxlevel, srcsize, src, tgtsize, tgt, irep, nullptr);
+}
+
+void R__zipZSTDDict(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, R__ZSTDDict *dict)
+{
+    auto cdict = GetCDict(*dict, 2*cxlevel);
+    if (R__unlikely(!cdict)) {
+        std::cerr << "Error in zip ZSTD: the dictionary " << dict->fID << " cannot be digested." << std::endl;
+        *irep = 0;
+        return;
+    }
+    R__zipZSTDImpl(cxlevel, srcsize, src, tgtsize, tgt, irep, cdict);
+}
+
+int R__trainZSTDDict(char *dict, int dictcapacity, const char *samples, const int *samplesizes, int nsamples)
+{
+    std::vector<size_t> sizes(samplesizes, samplesizes + nsamples);
+    size_t retval = ZDICT_trainFromBuffer(dict, static_cast<size_t>(dictcapacity), samples, sizes.data(),
+                                          static_cast<unsigned>(nsamples));
+    // Failing to train, typically because of too few or too small samples, is not an error
+    return ZDICT_isError(retval) ? 0 : static_cast<int>(retval);
+}
+
+R__ZSTDDict *R__addZSTDDict(const char *dict, int dictsize)
+{
+    unsigned dictid = ZDICT_getDictID(dict, static_cast<size_t>(dictsize));
+    if (dictid == 0)
+        return nullptr;
+
+    auto &registry = GetDictRegistry();
+    std::lock_guard<std::mutex> lock(registry.fMutex);
+    auto &entries = registry.fEntries[dictid];
+    for (auto &entry : entries) {
+        if (entry->fContent.size() == static_cast<size_t>(dictsize) &&
+            entry->fContent.compare(0, dictsize, dict, dictsize) == 0) {
+            ++entry->fNRefs;
+            return entry.get();
+        }
+    }
+    auto entry = std::make_shared<R__ZSTDDict>();
+    entry->fID = dictid;
+    entry->fContent.assign(dict, dictsize);
+    entry->fNRefs = 1;
+    entry->fDDict.reset(ZSTD_createDDict(entry->fContent.data(), entry->fContent.size()));
+    if (!entry->fDDict)
+        return nullptr;
+    entries.emplace_back(entry);
+    return entry.get();
+}
+
+void R__releaseZSTDDict(R__ZSTDDict *dict)
+{
+    if (!dict)
+        return;
+    auto &registry = GetDictRegistry();
+    std::lock_guard<std::mutex> lock(registry.fMutex);
+    if (--dict->fNRefs > 0)
+        return;
+    auto it = registry.fEntries.find(dict->fID);
+    auto &entries = it->second;
+    for (auto entry = entries.begin(); entry != entries.end(); ++entry) {
+        if (entry->get() == dict) {
+            entries.erase(entry);
+            break;
+        }
+    }
+    if (entries.empty())
+        registry.fEntries.erase(it);
+}
+
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
 {
     using Ctx_ptr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
@@ -77,9 +222,33 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
       return;
     }
 
-    size_t retval = ZSTD_decompressDCtx(fCtx.get(),
-                                        (char *)tgt, static_cast<size_t>(*tgtsize),
-                                        (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    const auto frame = &src[kHeaderSize];
+    const auto frameSize = static_cast<size_t>(*srcsize - kHeaderSize);
+    size_t retval = 0;
+    unsigned dictid = ZSTD_getDictID_fromFrame(frame, frameSize);
+    if (dictid == 0) {
+        retval = ZSTD_decompressDCtx(fCtx.get(), (char *)tgt, static_cast<size_t>(*tgtsize), (char *)frame, frameSize);
+    } else {
+        // Hold the dictionaries, which their users might release concurrently
+        const auto dicts = GetDicts(dictid);
+        if (R__unlikely(dicts.empty())) {
+            std::cerr << "R__unzipZSTD: the buffer was compressed with the dictionary " << dictid <<
+            ", which is not registered." << std::endl;
+            return;
+        }
+        // Without a checksum, decompressing with the wrong one of several dictionaries would not be detected
+        if (R__unlikely(dicts.size() > 1 && !HasChecksum(frame, frameSize))) {
+            std::cerr << "R__unzipZSTD: the buffer was compressed with one of several dictionaries with the "
+            "identifier " << dictid << " and has no checksum to tell them apart." << std::endl;
+            return;
+        }
+        for (const auto &dict : dicts) {
+            retval = ZSTD_decompress_usingDDict(fCtx.get(), (char *)tgt, static_cast<size_t>(*tgtsize),
+                                                (char *)frame, frameSize, dict->fDDict.get());
+            if (!ZSTD_isError(retval) || retval == errorCodeSmallBuffer)
+                break;
+        }
+    }
 
     /* The error code 18446744073709551546 arises when the tgt buffer is too small
      * However this error is already handled outside of the compression algorithm
@@ -9,9 +9,12 @@
 #ifndef ROOT_RIoUring
 #define ROOT_RIoUring
 
+#include <algorithm>
+#include <cerrno>
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
+#include <string>
 
 #include <liburing.h>
 #include <liburing/io_uring.h>
@@ -25,6 +28,8 @@ class RIoUring {
 private:
    struct io_uring fRing;
    std::uint32_t fDepth = 0;
+   /// Number of read events that have been submitted but not yet reaped
+   std::uint32_t fNInFlight = 0;
 
    static bool CheckIsAvailable() {
       try {
@@ -106,81 +111,105 @@ public:
       std::size_t fSize = 0;
       /// The number of actually read bytes, set by the RIoUring instance
       std::size_t fOutBytes = 0;
+      /// The error of the read if it failed, set by the RIoUring instance
+      int fErrno = 0;
       /// The file descriptor
       int fFileDes = -1;
    };
 
-   /// Submit a number of read events and wait for completion. Events are submitted in batches if
-   /// the number of events is larger than the submission queue depth.
-   void SubmitReadsAndWait(RReadEvent* readEvents, unsigned int nReads) {
-      unsigned int batch = 0;
-      unsigned int batchSize = fDepth;
-      unsigned int readPos = 0;
-
-      while (readPos < nReads) {
-         if (readPos + batchSize > nReads) {
-            batchSize = nReads - readPos;
+   /// Submit up to nReads read events without waiting for their completion. The number of submitted events is
+   /// limited by the free capacity of the ring; the return value is the number of events taken from readEvents.
+   /// The events must stay valid until they are reaped by ReapReads().
+   unsigned int SubmitReads(RReadEvent *readEvents, unsigned int nReads) {
+      unsigned int nSubmit = std::min(nReads, fDepth - fNInFlight);
+      if (nSubmit == 0)
+         return 0;
+
+      // Check the events before queuing any of them, queued events cannot be taken back
+      for (std::size_t i = 0; i < nSubmit; ++i) {
+         if (readEvents[i].fFileDes == -1) {
+            throw std::runtime_error("bad fd (-1) for read request '" + std::to_string(i) + "'");
+         }
+         if (readEvents[i].fBuffer == nullptr) {
+            throw std::runtime_error("null read buffer for read request '" + std::to_string(i) + "'");
          }
-         // prep reads
-         struct io_uring_sqe *sqe;
-         for (std::size_t i = readPos; i < readPos + batchSize; ++i) {
-            sqe = io_uring_get_sqe(&fRing);
-            if (!sqe) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "get SQE failed for read request '" + std::to_string(i)
-                  + "', error: " + std::string(strerror(errno)));
-            }
-            if (readEvents[i].fFileDes == -1) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "bad fd (-1) for read request '" + std::to_string(i) + "'");
-            }
-            if (readEvents[i].fBuffer == nullptr) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "null read buffer for read request '" + std::to_string(i) + "'");
-            }
-            io_uring_prep_read(sqe,
-               readEvents[i].fFileDes,
-               readEvents[i].fBuffer,
-               readEvents[i].fSize,
-               readEvents[i].fOffset
-            );
-            sqe->user_data = i;
+      }
+      struct io_uring_sqe *sqe;
+      for (std::size_t i = 0; i < nSubmit; ++i) {
+         sqe = io_uring_get_sqe(&fRing);
+         if (!sqe) {
+            throw std::runtime_error("get SQE failed for read request '" + std::to_string(i)
+               + "', error: " + std::string(strerror(errno)));
          }
+         io_uring_prep_read(sqe,
+            readEvents[i].fFileDes,
+            readEvents[i].fBuffer,
+            readEvents[i].fSize,
+            readEvents[i].fOffset
+         );
+         io_uring_sqe_set_data(sqe, &readEvents[i]);
+      }
+
+      int submitted = io_uring_submit(&fRing);
+      if (submitted < 0) {
+         throw std::runtime_error("ring submit failed, error: " + std::string(std::strerror(-submitted)));
+      }
+      if (submitted != static_cast<int>(nSubmit)) {
+         throw std::runtime_error("ring submitted " + std::to_string(submitted) +
+            " events but requested " + std::to_string(nSubmit));
+      }
+      fNInFlight += nSubmit;
+      return nSubmit;
+   }
 
-         // todo(max) check for any difference between submit vs. submit and wait for large nReq
-         int submitted = io_uring_submit_and_wait(&fRing, batchSize);
-         if (submitted <= 0) {
-            throw std::runtime_error("batch " + std::to_string(batch) + ": "
-               "ring submit failed, error: " + std::string(strerror(errno)));
+   /// Block until nReads of the submitted read events completed and set their fOutBytes members. A failed read
+   /// sets the fErrno member of its event rather than throwing, since the event may belong to another user of the
+   /// ring; only failures of the ring itself throw.
+   void ReapReads(unsigned int nReads) {
+      if (nReads > fNInFlight) {
+         throw std::runtime_error("cannot reap " + std::to_string(nReads) + " reads, only " +
+            std::to_string(fNInFlight) + " in flight");
+      }
+      struct io_uring_cqe *cqe;
+      int ret;
+      for (unsigned int i = 0; i < nReads; ++i) {
+         do {
+            ret = io_uring_wait_cqe(&fRing, &cqe);
+         } while (ret == -EINTR);
+         if (ret < 0) {
+            throw std::runtime_error("wait cqe failed, error: " + std::string(std::strerror(-ret)));
          }
-         if (submitted != static_cast<int>(batchSize)) {
-            throw std::runtime_error("ring submitted " + std::to_string(submitted) +
-               " events but requested " + std::to_string(batchSize));
+         auto readEvent = reinterpret_cast<RReadEvent *>(io_uring_cqe_get_data(cqe));
+         auto res = cqe->res;
+         io_uring_cqe_seen(&fRing, cqe);
+         fNInFlight--;
+         if (readEvent == nullptr) {
+            throw std::runtime_error("bad cqe user data: null read event");
          }
-         // reap reads
-         struct io_uring_cqe *cqe;
-         int ret;
-         for (int i = 0; i < submitted; ++i) {
-            ret = io_uring_wait_cqe(&fRing, &cqe);
-            if (ret < 0) {
-               throw std::runtime_error("wait cqe failed, error: " + std::string(std::strerror(-ret)));
-            }
-            auto index = reinterpret_cast<std::size_t>(io_uring_cqe_get_data(cqe));
-            if (index >= nReads) {
-               throw std::runtime_error("bad cqe user data: " + std::to_string(index));
-            }
-            if (cqe->res < 0) {
-               throw std::runtime_error("batch " + std::to_string(batch) + ": "
-                  + "read failed for ReadEvent[" + std::to_string(index) + "], "
-                  "error: " + std::string(std::strerror(-cqe->res)));
-            }
-            readEvents[index].fOutBytes = static_cast<std::size_t>(cqe->res);
-            io_uring_cqe_seen(&fRing, cqe);
+         readEvent->fErrno = (res < 0) ? -res : 0;
+         readEvent->fOutBytes = (res < 0) ? 0 : static_cast<std::size_t>(res);
+      }
+   }
+
+   /// Number of submitted read events that have not yet been reaped
+   std::uint32_t GetNInFlight() const {
+      return fNInFlight;
+   }
+
+   /// Submit a number of read events and wait for completion. Events are submitted in batches if
+   /// the number of events is larger than the submission queue depth. Throws if a read failed.
+   void SubmitReadsAndWait(RReadEvent* readEvents, unsigned int nReads) {
+      unsigned int readPos = 0;
+      while (readPos < nReads) {
+         readPos += SubmitReads(readEvents + readPos, nReads - readPos);
+         ReapReads(fNInFlight);
+      }
+      for (unsigned int i = 0; i < nReads; ++i) {
+         if (readEvents[i].fErrno) {
+            throw std::runtime_error("read failed at offset " + std::to_string(readEvents[i].fOffset) + ", "
+               "error: " + std::string(std::strerror(readEvents[i].fErrno)));
          }
-         readPos += batchSize;
-         batch += 1;
       }
-      return;
    }
 };
 
@@ -76,6 +76,18 @@ public:
       std::size_t fOutBytes = 0;
    };
 
+   /**
+    * Handle to a vector read issued by ReadVAsync().  The destination buffers and the RIOVec array of the request
+    * must stay valid until Wait() returned.  A handle must not outlive the RRawFile object that created it.
+    * Destructing a handle implicitly waits for the outstanding reads.
+    */
+   class RAsyncReadV {
+   public:
+      virtual ~RAsyncReadV() = default;
+      /// Blocks until all the byte ranges of the request have been read and the fOutBytes members are set
+      virtual void Wait() = 0;
+   };
+
 private:
    /// Don't change without adapting ReadAt()
    static constexpr unsigned int kNumBlockBuffers = 2;
@@ -134,6 +146,9 @@ protected:
 
    /// By default implemented as a loop of ReadAt calls but can be overwritten, e.g. XRootD or DAVIX implementations
    virtual void ReadVImpl(RIOVec *ioVec, unsigned int nReq);
+   /// By default implemented as a synchronous ReadVImpl() call that returns an already completed handle. Derived
+   /// classes that set kFeatureHasAsyncIo return a handle for requests that are still in flight.
+   virtual std::unique_ptr<RAsyncReadV> ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq);
 
 public:
    RRawFile(std::string_view url, ROptions options);
@@ -167,6 +182,9 @@ public:
 
    /// Opens the file if necessary and calls ReadVImpl
    void ReadV(RIOVec *ioVec, unsigned int nReq);
+   /// Opens the file if necessary and calls ReadVAsyncImpl. The read requests are submitted and the call returns
+   /// without waiting for the data, unless the file does not support async IO (see kFeatureHasAsyncIo).
+   std::unique_ptr<RAsyncReadV> ReadVAsync(RIOVec *ioVec, unsigned int nReq);
 
    /// Memory mapping according to POSIX standard; in particular, new mappings of the same range replace older ones.
    /// Mappings need to be aligned at page boundaries, therefore the real offset can be smaller than the desired value.
@@ -17,10 +17,13 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 
 namespace ROOT {
 namespace Internal {
 
+class RIoUring;
+
 /**
  * \class RRawFileUnix RRawFileUnix.hxx
  * \ingroup IO
@@ -31,11 +34,19 @@ namespace Internal {
 class RRawFileUnix : public RRawFile {
 private:
    int fFileDes;
+   /// Created by the first vector read and shared by all the asynchronous vector reads of the file
+   std::shared_ptr<RIoUring> fIoUring;
+   /// Set if the io_uring instance cannot be created, in which case vector reads are synchronous
+   bool fIoUringFailed = false;
+
+   /// Returns nullptr if io_uring is not available
+   RIoUring *GetIoUring();
 
 protected:
    void OpenImpl() final;
    size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
    void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   std::unique_ptr<RAsyncReadV> ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq) final;
    std::uint64_t GetSizeImpl() final;
    void *MapImpl(size_t nbytes, std::uint64_t offset, std::uint64_t &mapdOffset) final;
    void UnmapImpl(void *region, size_t nbytes) final;
@@ -36,6 +36,14 @@ class TBufferMergerFile;
  * socket, TBufferMerger uses threads that each write to a
  * TBufferMergerFile, which in turn push data into a queue
  * managed by the TBufferMerger.
+ *
+ * The TBufferMergerFiles use the compression settings of the
+ * output file, so the baskets are compressed by the threads that
+ * write them. The queue is merged by one of the writing threads
+ * at a time; unless the merge options ask otherwise, the baskets
+ * are appended to the output file without recompression.
+ *
+ * A memory budget bounds the size of the queue, see SetMemoryBudget().
  */
 
 class TBufferMerger {
@@ -73,6 +81,12 @@ public:
    /** Returns the current value of the auto save setting in bytes (default = 0). */
    size_t GetAutoSave() const;
 
+   /** Returns the number of bytes that are queued or being merged. */
+   size_t GetBuffered() const;
+
+   /** Returns the current memory budget in bytes (default = 0, i.e. unlimited). */
+   size_t GetMemoryBudget() const;
+
    /** Returns the current merge options. */
    const char* GetMergeOptions();
 
@@ -86,6 +100,17 @@ public:
     */
    void SetAutoSave(size_t size);
 
+   /** Bounds the memory held by the buffers that are queued or being merged.
+    *  A TBufferMergerFile that pushes a buffer beyond this budget blocks until
+    *  the ongoing merge is done, and then merges the queue itself, regardless
+    *  of the auto save setting. This applies back-pressure on the writing
+    *  threads when they produce data faster than it can be merged. The budget
+    *  can be exceeded by the buffers that the writing threads push while a
+    *  merge is ongoing, i.e. by at most one buffer per thread.
+    *  A size of 0 disables the budget.
+    */
+   void SetMemoryBudget(size_t size);
+
    /** Sets the merge options. SetMergeOptions("fast") will disable
     * recompression of input data into the output if they have different
     * compression settings.
@@ -107,14 +132,16 @@ private:
 
    void Init(std::unique_ptr<TFile>);
 
-   void Merge();
+   void Merge(bool wait = false);
    void Push(TBufferFile *buffer);
 
    size_t fAutoSave{0};                                          //< AutoSave only every fAutoSave bytes
    size_t fBuffered{0};                                          //< Number of bytes currently buffered
+   size_t fMerging{0};                                           //< Number of bytes currently being merged
+   size_t fMemoryBudget{0};                                      //< Maximum of fBuffered + fMerging, if not 0
    TFileMerger fMerger{false, false};                            //< TFileMerger used to merge all buffers
    std::mutex fMergeMutex;                                       //< Mutex used to lock fMerger
-   std::mutex fQueueMutex;                                       //< Mutex used to lock fQueue
+   mutable std::mutex fQueueMutex;                               //< Mutex used to lock fQueue and the byte counts
    std::queue<TBufferFile *> fQueue;                             //< Queue to which data is pushed and merged
    std::vector<std::weak_ptr<TBufferMergerFile>> fAttachedFiles; //< Attached files
 };
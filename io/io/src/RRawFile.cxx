@@ -41,6 +41,12 @@ const char *kLineBreakTokens[] = {"", "\n", "\n", "\r\n"};
 constexpr unsigned int kLineBreakTokenSizes[] = {0, 1, 1, 2};
 #endif
 constexpr unsigned int kLineBuffer = 128; // On Readln, look for line-breaks in chunks of 128 bytes
+
+/// Returned by the default ReadVAsyncImpl(), which reads synchronously
+class RAsyncReadVDone : public ROOT::Internal::RRawFile::RAsyncReadV {
+public:
+   void Wait() final {}
+};
 } // anonymous namespace
 
 size_t ROOT::Internal::RRawFile::RBlockBuffer::CopyTo(void *buffer, size_t nbytes, std::uint64_t offset)
@@ -105,6 +111,13 @@ void ROOT::Internal::RRawFile::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
    }
 }
 
+std::unique_ptr<ROOT::Internal::RRawFile::RAsyncReadV>
+ROOT::Internal::RRawFile::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   ReadVImpl(ioVec, nReq);
+   return std::unique_ptr<RAsyncReadV>(new RAsyncReadVDone());
+}
+
 void ROOT::Internal::RRawFile::UnmapImpl(void * /* region */, size_t /* nbytes */)
 {
    throw std::runtime_error("Memory mapping unsupported");
@@ -212,6 +225,15 @@ void ROOT::Internal::RRawFile::ReadV(RIOVec *ioVec, unsigned int nReq)
    ReadVImpl(ioVec, nReq);
 }
 
+std::unique_ptr<ROOT::Internal::RRawFile::RAsyncReadV>
+ROOT::Internal::RRawFile::ReadVAsync(RIOVec *ioVec, unsigned int nReq)
+{
+   if (!fIsOpen)
+      OpenImpl();
+   fIsOpen = true;
+   return ReadVAsyncImpl(ioVec, nReq);
+}
+
 bool ROOT::Internal::RRawFile::Readln(std::string &line)
 {
    if (fOptions.fLineBreak == ELineBreaks::kAuto) {
@@ -33,6 +33,113 @@
 
 namespace {
 constexpr int kDefaultBlockSize = 4096; // If fstat() does not provide a block size hint, use this value instead
+
+#ifdef R__HAS_URING
+/// Marks the read events whose completion has not been reaped yet
+constexpr std::size_t kReadPending = static_cast<std::size_t>(-1);
+
+/**
+ * An asynchronous vector read on the io_uring instance of its file, which all the vector reads of the file share.
+ * The constructor submits as many read events as the ring can still hold; further batches, if any, are submitted
+ * while waiting for the completion of the first ones. Reaping completions on the shared ring can complete the read
+ * events of other requests as well, hence every request tracks its pending events by their fOutBytes member and
+ * reports only the errors of its own events.
+ */
+class RAsyncReadVUring : public ROOT::Internal::RRawFile::RAsyncReadV {
+private:
+   using RIoUring = ROOT::Internal::RIoUring;
+   using RIOVec = ROOT::Internal::RRawFile::RIOVec;
+
+   std::shared_ptr<RIoUring> fRing;
+   std::vector<RIoUring::RReadEvent> fReads;
+   RIOVec *fIoVec;
+   unsigned int fNSubmitted = 0;
+   /// The failure of the ring itself, if any, which stops the submission of further events
+   std::string fRingError;
+   bool fIsDone = false;
+
+   bool IsInFlight() const
+   {
+      for (unsigned int i = 0; i < fNSubmitted; ++i) {
+         if (fReads[i].fOutBytes == kReadPending)
+            return true;
+      }
+      return false;
+   }
+
+   void Submit()
+   {
+      try {
+         fNSubmitted += fRing->SubmitReads(&fReads[fNSubmitted], fReads.size() - fNSubmitted);
+      } catch (const std::runtime_error &err) {
+         fRingError = err.what();
+      }
+   }
+
+public:
+   RAsyncReadVUring(const std::shared_ptr<RIoUring> &ring, int fileDes, RIOVec *ioVec, unsigned int nReq)
+      : fRing(ring), fReads(nReq), fIoVec(ioVec)
+   {
+      for (std::size_t i = 0; i < nReq; ++i) {
+         fReads[i].fBuffer = ioVec[i].fBuffer;
+         fReads[i].fOffset = ioVec[i].fOffset;
+         fReads[i].fSize = ioVec[i].fSize;
+         fReads[i].fOutBytes = kReadPending;
+         fReads[i].fFileDes = fileDes;
+      }
+      // Errors are reported by Wait()
+      Submit();
+   }
+
+   ~RAsyncReadVUring()
+   {
+      try {
+         Wait();
+      } catch (const std::runtime_error &err) {
+         Error("RRawFileUnix", "asynchronous vector read failed: %s", err.what());
+      }
+   }
+
+   void Wait() final
+   {
+      if (fIsDone)
+         return;
+      const auto nReq = fReads.size();
+      // The kernel writes into the buffers of the events in flight: they must complete before the buffers are
+      // released, even if the request fails
+      while (IsInFlight() || (fNSubmitted < nReq && fRingError.empty())) {
+         if (fNSubmitted < nReq && fRingError.empty())
+            Submit();
+         // Nothing in flight on the ring, hence none of our events
+         if (fRing->GetNInFlight() == 0)
+            break;
+         // Either our events are in flight or the ring is full with the events of other requests
+         try {
+            fRing->ReapReads(1);
+         } catch (const std::runtime_error &err) {
+            if (fRingError.empty())
+               fRingError = err.what();
+            if (IsInFlight()) {
+               // The kernel might still complete our events: keep their buffers alive for the rest of the process
+               new std::vector<RIoUring::RReadEvent>(std::move(fReads));
+               fReads.clear();
+               fNSubmitted = 0;
+            }
+         }
+      }
+      fIsDone = true;
+      if (!fRingError.empty())
+         throw std::runtime_error(fRingError);
+      for (std::size_t i = 0; i < nReq; ++i) {
+         if (fReads[i].fErrno) {
+            throw std::runtime_error("read failed at offset " + std::to_string(fReads[i].fOffset) + ", error: " +
+                                     std::string(std::strerror(fReads[i].fErrno)));
+         }
+         fIoVec[i].fOutBytes = fReads[i].fOutBytes;
+      }
+   }
+};
+#endif
 } // anonymous namespace
 
 ROOT::Internal::RRawFileUnix::RRawFileUnix(std::string_view url, ROptions options)
@@ -52,7 +159,12 @@ std::unique_ptr<ROOT::Internal::RRawFile> ROOT::Internal::RRawFileUnix::Clone()
 }
 
 int ROOT::Internal::RRawFileUnix::GetFeatures() const {
-   return kFeatureHasSize | kFeatureHasMmap;
+   int features = kFeatureHasSize | kFeatureHasMmap;
+#ifdef R__HAS_URING
+   if (RIoUring::IsAvailable())
+      features |= kFeatureHasAsyncIo;
+#endif
+   return features;
 }
 
 std::uint64_t ROOT::Internal::RRawFileUnix::GetSizeImpl()
@@ -112,33 +224,41 @@ void ROOT::Internal::RRawFileUnix::OpenImpl()
    }
 }
 
-void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+ROOT::Internal::RIoUring *ROOT::Internal::RRawFileUnix::GetIoUring()
 {
 #ifdef R__HAS_URING
-   if (RIoUring::IsAvailable()) {
-      RIoUring ring;
-      std::vector<RIoUring::RReadEvent> reads;
-      reads.reserve(nReq);
-      for (std::size_t i = 0; i < nReq; ++i) {
-         RIoUring::RReadEvent ev;
-         ev.fBuffer = ioVec[i].fBuffer;
-         ev.fOffset = ioVec[i].fOffset;
-         ev.fSize = ioVec[i].fSize;
-         ev.fFileDes = fFileDes;
-         reads.push_back(ev);
-      }
-      ring.SubmitReadsAndWait(reads.data(), nReq);
-      for (std::size_t i = 0; i < nReq; ++i) {
-         ioVec[i].fOutBytes = reads.at(i).fOutBytes;
-      }
-      return;
+   if (fIoUring || fIoUringFailed || !RIoUring::IsAvailable())
+      return fIoUring.get();
+   try {
+      fIoUring = std::make_shared<RIoUring>();
+   } catch (const std::runtime_error &err) {
+      // E.g., the memlock limit of the user is exhausted by the rings of other files
+      fIoUringFailed = true;
+      Warning("RRawFileUnix", "io_uring setup failed, falling back to default ReadV implementation\n%s", err.what());
    }
-   Warning("RRawFileUnix",
-           "io_uring setup failed, falling back to default ReadV implementation");
 #endif
+   return fIoUring.get();
+}
+
+void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   if (GetIoUring()) {
+      ReadVAsyncImpl(ioVec, nReq)->Wait();
+      return;
+   }
    RRawFile::ReadVImpl(ioVec, nReq);
 }
 
+std::unique_ptr<ROOT::Internal::RRawFile::RAsyncReadV>
+ROOT::Internal::RRawFileUnix::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
+{
+#ifdef R__HAS_URING
+   if (GetIoUring())
+      return std::make_unique<RAsyncReadVUring>(fIoUring, fFileDes, ioVec, nReq);
+#endif
+   return RRawFile::ReadVAsyncImpl(ioVec, nReq);
+}
+
 size_t ROOT::Internal::RRawFileUnix::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
 {
    size_t total_bytes = 0;
@@ -18,6 +18,7 @@ The concrete implementation of TBuffer for writing/reading to/from a ROOT file o
 */
 
 #include <string.h>
+#include <algorithm>
 #include <typeinfo>
 #include <string>
 
@@ -34,15 +35,16 @@ The concrete implementation of TBuffer for writing/reading to/from a ROOT file o
 #include "TStreamerInfoActions.h"
 #include "TInterpreter.h"
 #include "TVirtualMutex.h"
+#include "ROOT/RByteSwap.hxx"
 
-#if (defined(__linux) || defined(__APPLE__)) && defined(__i386__) && \
-     defined(__GNUC__)
-#define USE_BSWAPCPY
+// Runtime dispatch of the byte swapping kernels follows the approach of the builtin zlib: the SIMD kernels are
+// compiled with a target attribute and selected according to the CPU features at first use.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && defined(R__BYTESWAP)
+#define R__TBUFFERFILE_X86_KERNELS
+#include <immintrin.h>
 #endif
 
-#ifdef USE_BSWAPCPY
-#include "Bswapcpy.h"
-#endif
+#include <cstddef>
 
 
 const UInt_t kNewClassTag       = 0xFFFFFFFF;
@@ -56,6 +58,216 @@ const Int_t  kMapOffset         = 2;   // first 2 map entries are taken by null
 
 ClassImp(TBufferFile);
 
+namespace {
+
+/// Arrays of fewer bytes are converted inline rather than through the dispatched kernels
+constexpr std::size_t kMinKernelBytes = 32;
+/// Number of elements of the stack blocks used to convert truncated floats
+constexpr std::size_t kBlockSize = 256;
+
+#ifdef R__BYTESWAP
+using ROOT::Internal::SwapCopyScalar;
+#endif
+
+#ifdef R__TBUFFERFILE_X86_KERNELS
+/// Shuffle mask for (v)pshufb that reverses the bytes of every N byte element of a 16 byte lane
+template <std::size_t N>
+struct RSwapMask {
+   alignas(16) unsigned char fBytes[16];
+   constexpr RSwapMask() : fBytes()
+   {
+      for (std::size_t i = 0; i < 16; ++i)
+         fBytes[i] = (i / N) * N + (N - 1 - i % N);
+   }
+};
+
+template <std::size_t N>
+__attribute__((target("ssse3")))
+void SwapCopySsse3(void *dst, const void *src, std::size_t n)
+{
+   static constexpr RSwapMask<N> kMask;
+   const auto shuffle = _mm_load_si128(reinterpret_cast<const __m128i *>(kMask.fBytes));
+   auto d = reinterpret_cast<unsigned char *>(dst);
+   auto s = reinterpret_cast<const unsigned char *>(src);
+   const std::size_t nBytes = n * N;
+   std::size_t i = 0;
+   for (; i + 16 <= nBytes; i += 16) {
+      auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(d + i), _mm_shuffle_epi8(v, shuffle));
+   }
+   SwapCopyScalar<N>(d + i, s + i, (nBytes - i) / N);
+}
+
+template <std::size_t N>
+__attribute__((target("avx2")))
+void SwapCopyAvx2(void *dst, const void *src, std::size_t n)
+{
+   // vpshufb shuffles within the two 16 byte lanes, which is fine because no element crosses a lane
+   static constexpr RSwapMask<N> kMask;
+   const auto shuffle = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(kMask.fBytes)));
+   auto d = reinterpret_cast<unsigned char *>(dst);
+   auto s = reinterpret_cast<const unsigned char *>(src);
+   const std::size_t nBytes = n * N;
+   std::size_t i = 0;
+   for (; i + 64 <= nBytes; i += 64) {
+      auto v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i));
+      auto v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i + 32));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(d + i), _mm256_shuffle_epi8(v0, shuffle));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(d + i + 32), _mm256_shuffle_epi8(v1, shuffle));
+   }
+   for (; i + 32 <= nBytes; i += 32) {
+      auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(d + i), _mm256_shuffle_epi8(v, shuffle));
+   }
+   SwapCopyScalar<N>(d + i, s + i, (nBytes - i) / N);
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Rebuild n floats from their truncated representation: an exponent byte followed by a big endian 16 bit word
+/// that holds the nbits most significant bits of the mantissa and, in bit nbits+1, the sign.
+/// See TBufferFile::WriteFloat16.
+
+void UnpackTruncatedFloatsScalar(Float_t *dst, const unsigned char *src, std::size_t n, Int_t nbits)
+{
+   const UInt_t manMask = (1 << (nbits + 1)) - 1;
+   const UInt_t signBit = 1 << (nbits + 1);
+   for (std::size_t i = 0; i < n; ++i) {
+      const UInt_t theExp = src[3 * i];
+      const UInt_t theMan = (UInt_t(src[3 * i + 1]) << 8) | src[3 * i + 2];
+      UInt_t bits = (theExp << 23) | ((theMan & manMask) << (23 - nbits));
+      if (theMan & signBit)
+         bits |= 0x80000000;
+      memcpy(dst + i, &bits, sizeof(Float_t));
+   }
+}
+
+#ifdef R__TBUFFERFILE_X86_KERNELS
+__attribute__((target("ssse3")))
+void UnpackTruncatedFloatsSsse3(Float_t *dst, const unsigned char *src, std::size_t n, Int_t nbits)
+{
+   // Move every three byte record into a 32 bit lane as (exponent << 16 | mantissa)
+   const auto shuffle = _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+   const auto lowWord = _mm_set1_epi32(0xFFFF);
+   const auto manMask = _mm_set1_epi32((1 << (nbits + 1)) - 1);
+   const auto one = _mm_set1_epi32(1);
+   const auto manShift = _mm_cvtsi32_si128(23 - nbits);
+   const auto signShift = _mm_cvtsi32_si128(nbits + 1);
+   std::size_t i = 0;
+   // Every iteration loads 16 bytes but consumes only 12 of them
+   for (; 3 * i + 16 <= 3 * n; i += 4) {
+      auto records = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 3 * i)), shuffle);
+      auto theMan = _mm_and_si128(records, lowWord);
+      auto theExp = _mm_srli_epi32(records, 16);
+      auto bits = _mm_or_si128(_mm_slli_epi32(theExp, 23), _mm_sll_epi32(_mm_and_si128(theMan, manMask), manShift));
+      auto sign = _mm_slli_epi32(_mm_and_si128(_mm_srl_epi32(theMan, signShift), one), 31);
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_or_si128(bits, sign));
+   }
+   UnpackTruncatedFloatsScalar(dst + i, src + 3 * i, n - i, nbits);
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Inverse of UnpackTruncatedFloatsScalar(); rounds the mantissa to nbits.
+
+void PackTruncatedFloats(unsigned char *dst, const Float_t *src, std::size_t n, Int_t nbits)
+{
+   for (std::size_t i = 0; i < n; ++i) {
+      Int_t intValue;
+      memcpy(&intValue, src + i, sizeof(Float_t));
+      UChar_t theExp = (UChar_t)(0x000000ff & ((intValue << 1) >> 24));
+      UShort_t theMan = ((1 << (nbits + 1)) - 1) & (intValue >> (23 - nbits - 1));
+      theMan++;
+      theMan = theMan >> 1;
+      if (theMan & 1 << nbits)
+         theMan = (1 << nbits) - 1;
+      if (src[i] < 0)
+         theMan |= 1 << (nbits + 1);
+      dst[3 * i] = theExp;
+      dst[3 * i + 1] = theMan >> 8;
+      dst[3 * i + 2] = theMan & 0xff;
+   }
+}
+
+/// The byte swapping kernels available on the current CPU
+struct RByteSwapKernels {
+   using SwapCopy_t = void (*)(void *, const void *, std::size_t);
+   using UnpackTruncatedFloats_t = void (*)(Float_t *, const unsigned char *, std::size_t, Int_t);
+
+#ifdef R__BYTESWAP
+   SwapCopy_t fSwapCopy2 = SwapCopyScalar<2>;
+   SwapCopy_t fSwapCopy4 = SwapCopyScalar<4>;
+   SwapCopy_t fSwapCopy8 = SwapCopyScalar<8>;
+#endif
+   UnpackTruncatedFloats_t fUnpackTruncatedFloats = UnpackTruncatedFloatsScalar;
+
+   RByteSwapKernels()
+   {
+#ifdef R__TBUFFERFILE_X86_KERNELS
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("ssse3")) {
+         fSwapCopy2 = SwapCopySsse3<2>;
+         fSwapCopy4 = SwapCopySsse3<4>;
+         fSwapCopy8 = SwapCopySsse3<8>;
+         fUnpackTruncatedFloats = UnpackTruncatedFloatsSsse3;
+      }
+      if (__builtin_cpu_supports("avx2")) {
+         fSwapCopy2 = SwapCopyAvx2<2>;
+         fSwapCopy4 = SwapCopyAvx2<4>;
+         fSwapCopy8 = SwapCopyAvx2<8>;
+      }
+#endif
+   }
+
+   static const RByteSwapKernels &Get()
+   {
+      static const RByteSwapKernels kernels;
+      return kernels;
+   }
+
+#ifdef R__BYTESWAP
+   template <std::size_t N>
+   SwapCopy_t GetSwapCopy() const
+   {
+      return (N == 2) ? fSwapCopy2 : ((N == 4) ? fSwapCopy4 : fSwapCopy8);
+   }
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy n values of type T from the I/O buffer at src, where they are stored in big endian byte order, to dst.
+
+template <typename T>
+inline void FromBigEndian(T *dst, const char *src, std::size_t n)
+{
+#ifdef R__BYTESWAP
+   if (n * sizeof(T) < kMinKernelBytes)
+      SwapCopyScalar<sizeof(T)>(dst, src, n);
+   else
+      RByteSwapKernels::Get().GetSwapCopy<sizeof(T)>()(dst, src, n);
+#else
+   memcpy(dst, src, n * sizeof(T));
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy n values of type T from src to the I/O buffer at dst in big endian byte order.
+
+template <typename T>
+inline void ToBigEndian(char *dst, const T *src, std::size_t n)
+{
+#ifdef R__BYTESWAP
+   if (n * sizeof(T) < kMinKernelBytes)
+      SwapCopyScalar<sizeof(T)>(dst, src, n);
+   else
+      RByteSwapKernels::Get().GetSwapCopy<sizeof(T)>()(dst, src, n);
+#else
+   memcpy(dst, src, n * sizeof(T));
+#endif
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Thread-safe check on StreamerInfos of a TClass
 
@@ -760,18 +972,8 @@ Int_t TBufferFile::ReadArray(Short_t *&h)
 
    if (!h) h = new Short_t[n];
 
-#ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(h, fBufCur, n);
+   FromBigEndian(h, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
-#else
-   memcpy(h, fBufCur, l);
-   fBufCur += l;
-#endif
 
    return n;
 }
@@ -793,18 +995,8 @@ Int_t TBufferFile::ReadArray(Int_t *&ii)
 
    if (!ii) ii = new Int_t[n];
 
-#ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(ii, fBufCur, n);
+   FromBigEndian(ii, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
-#else
-   memcpy(ii, fBufCur, l);
-   fBufCur += l;
-#endif
 
    return n;
 }
@@ -852,13 +1044,8 @@ Int_t TBufferFile::ReadArray(Long64_t *&ll)
 
    if (!ll) ll = new Long64_t[n];
 
-#ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
-#else
-   memcpy(ll, fBufCur, l);
+   FromBigEndian(ll, fBufCur, n);
    fBufCur += l;
-#endif
 
    return n;
 }
@@ -880,18 +1067,8 @@ Int_t TBufferFile::ReadArray(Float_t *&f)
 
    if (!f) f = new Float_t[n];
 
-#ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(f, fBufCur, n);
+   FromBigEndian(f, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
-#else
-   memcpy(f, fBufCur, l);
-   fBufCur += l;
-#endif
 
    return n;
 }
@@ -913,13 +1090,8 @@ Int_t TBufferFile::ReadArray(Double_t *&d)
 
    if (!d) d = new Double_t[n];
 
-#ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
-#else
-   memcpy(d, fBufCur, l);
+   FromBigEndian(d, fBufCur, n);
    fBufCur += l;
-#endif
 
    return n;
 }
@@ -1033,18 +1205,8 @@ Int_t TBufferFile::ReadStaticArray(Short_t *h)
 
    if (!h) return 0;
 
-#ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(h, fBufCur, n);
-   fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
-#else
-   memcpy(h, fBufCur, l);
+   FromBigEndian(h, fBufCur, n);
    fBufCur += l;
-#endif
 
    return n;
 }
@@ -1065,18 +1227,8 @@ Int_t TBufferFile::ReadStaticArray(Int_t *ii)
 
    if (!ii) return 0;
 
-#ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(ii, fBufCur, n);
-   fBufCur += sizeof(Int_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
-#else
-   memcpy(ii, fBufCur, l);
+   FromBigEndian(ii, fBufCur, n);
    fBufCur += l;
-#endif
 
    return n;
 }
@@ -1122,13 +1274,8 @@ Int_t TBufferFile::ReadStaticArray(Long64_t *ll)
 
    if (!ll) return 0;
 
-#ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
-#else
-   memcpy(ll, fBufCur, l);
+   FromBigEndian(ll, fBufCur, n);
    fBufCur += l;
-#endif
 
    return n;
 }
@@ -1149,18 +1296,8 @@ Int_t TBufferFile::ReadStaticArray(Float_t *f)
 
    if (!f) return 0;
 
-#ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(f, fBufCur, n);
-   fBufCur += sizeof(Float_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
-#else
-   memcpy(f, fBufCur, l);
+   FromBigEndian(f, fBufCur, n);
    fBufCur += l;
-#endif
 
    return n;
 }
@@ -1181,13 +1318,8 @@ Int_t TBufferFile::ReadStaticArray(Double_t *d)
 
    if (!d) return 0;
 
-#ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
-#else
-   memcpy(d, fBufCur, l);
+   FromBigEndian(d, fBufCur, n);
    fBufCur += l;
-#endif
 
    return n;
 }
@@ -1299,18 +1431,8 @@ void TBufferFile::ReadFastArray(Short_t *h, Int_t n)
    Int_t l = sizeof(Short_t)*n;
    if (n <= 0 || l > fBufSize) return;
 
-#ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(h, fBufCur, n);
-   fBufCur += sizeof(Short_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
-#else
-   memcpy(h, fBufCur, l);
+   FromBigEndian(h, fBufCur, n);
    fBufCur += l;
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1321,18 +1443,8 @@ void TBufferFile::ReadFastArray(Int_t *ii, Int_t n)
    Int_t l = sizeof(Int_t)*n;
    if (l <= 0 || l > fBufSize) return;
 
-#ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(ii, fBufCur, n);
-   fBufCur += sizeof(Int_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
-#else
-   memcpy(ii, fBufCur, l);
+   FromBigEndian(ii, fBufCur, n);
    fBufCur += l;
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1359,13 +1471,8 @@ void TBufferFile::ReadFastArray(Long64_t *ll, Int_t n)
    Int_t l = sizeof(Long64_t)*n;
    if (l <= 0 || l > fBufSize) return;
 
-#ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
-#else
-   memcpy(ll, fBufCur, l);
+   FromBigEndian(ll, fBufCur, n);
    fBufCur += l;
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1376,18 +1483,8 @@ void TBufferFile::ReadFastArray(Float_t *f, Int_t n)
    Int_t l = sizeof(Float_t)*n;
    if (l <= 0 || l > fBufSize) return;
 
-#ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(f, fBufCur, n);
-   fBufCur += sizeof(Float_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
-#else
-   memcpy(f, fBufCur, l);
+   FromBigEndian(f, fBufCur, n);
    fBufCur += l;
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1398,13 +1495,8 @@ void TBufferFile::ReadFastArray(Double_t *d, Int_t n)
    Int_t l = sizeof(Double_t)*n;
    if (l <= 0 || l > fBufSize) return;
 
-#ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
-#else
-   memcpy(d, fBufCur, l);
+   FromBigEndian(d, fBufCur, n);
    fBufCur += l;
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1417,33 +1509,11 @@ void TBufferFile::ReadFastArrayFloat16(Float_t *f, Int_t n, TStreamerElement *el
 
    if (ele && ele->GetFactor() != 0) {
       //a range was specified. We read an integer and convert it back to a float
-      Double_t xmin = ele->GetXmin();
-      Double_t factor = ele->GetFactor();
-      for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; f[j] = (Float_t)(aint/factor + xmin);
-      }
+      ReadFastArrayWithFactor(f, n, ele->GetFactor(), ele->GetXmin());
    } else {
-      Int_t i;
       Int_t nbits = 0;
       if (ele) nbits = (Int_t)ele->GetXmin();
-      if (!nbits) nbits = 12;
-      //we read the exponent and the truncated mantissa of the float
-      //and rebuild the new float.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      UChar_t  theExp;
-      UShort_t theMan;
-      for (i = 0; i < n; i++) {
-         *this >> theExp;
-         *this >> theMan;
-         fIntValue = theExp;
-         fIntValue <<= 23;
-         fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-         if(1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-         f[i] = fFloatValue;
-      }
+      ReadFastArrayWithNbits(f, n, nbits);
    }
 }
 
@@ -1456,8 +1526,13 @@ void TBufferFile::ReadFastArrayWithFactor(Float_t *ptr, Int_t n, Double_t factor
    if (n <= 0 || 3*n > fBufSize) return;
 
    //a range was specified. We read an integer and convert it back to a float
-   for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; ptr[j] = (Float_t)(aint/factor + minvalue);
+   UInt_t aint[kBlockSize];
+   for (Int_t i = 0; i < n; i += kBlockSize) {
+      const Int_t nBlock = std::min(Int_t(kBlockSize), n - i);
+      FromBigEndian(aint, fBufCur, nBlock);
+      fBufCur += sizeof(UInt_t) * nBlock;
+      for (Int_t j = 0; j < nBlock; j++)
+         ptr[i + j] = (Float_t)(aint[j]/factor + minvalue);
    }
 }
 
@@ -1472,21 +1547,8 @@ void TBufferFile::ReadFastArrayWithNbits(Float_t *ptr, Int_t n, Int_t nbits)
    if (!nbits) nbits = 12;
    //we read the exponent and the truncated mantissa of the float
    //and rebuild the new float.
-   union {
-      Float_t fFloatValue;
-      Int_t   fIntValue;
-   };
-   UChar_t  theExp;
-   UShort_t theMan;
-   for (Int_t i = 0; i < n; i++) {
-      *this >> theExp;
-      *this >> theMan;
-      fIntValue = theExp;
-      fIntValue <<= 23;
-      fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-      if(1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-      ptr[i] = fFloatValue;
-   }
+   RByteSwapKernels::Get().fUnpackTruncatedFloats(ptr, reinterpret_cast<unsigned char *>(fBufCur), n, nbits);
+   fBufCur += 3 * n;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1499,41 +1561,11 @@ void TBufferFile::ReadFastArrayDouble32(Double_t *d, Int_t n, TStreamerElement *
 
    if (ele && ele->GetFactor() != 0) {
       //a range was specified. We read an integer and convert it back to a double.
-      Double_t xmin = ele->GetXmin();
-      Double_t factor = ele->GetFactor();
-      for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + xmin);
-      }
+      ReadFastArrayWithFactor(d, n, ele->GetFactor(), ele->GetXmin());
    } else {
-      Int_t i;
       Int_t nbits = 0;
       if (ele) nbits = (Int_t)ele->GetXmin();
-      if (!nbits) {
-         //we read a float and convert it to double
-         Float_t afloat;
-         for (i = 0; i < n; i++) {
-            *this >> afloat;
-            d[i] = (Double_t)afloat;
-         }
-      } else {
-         //we read the exponent and the truncated mantissa of the float
-         //and rebuild the double.
-         union {
-            Float_t fFloatValue;
-            Int_t   fIntValue;
-         };
-         UChar_t  theExp;
-         UShort_t theMan;
-         for (i = 0; i < n; i++) {
-            *this >> theExp;
-            *this >> theMan;
-            fIntValue = theExp;
-            fIntValue <<= 23;
-            fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-            if (1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-            d[i] = (Double_t)fFloatValue;
-         }
-      }
+      ReadFastArrayWithNbits(d, n, nbits);
    }
 }
 
@@ -1546,8 +1578,13 @@ void TBufferFile::ReadFastArrayWithFactor(Double_t *d, Int_t n, Double_t factor,
    if (n <= 0 || 3*n > fBufSize) return;
 
    //a range was specified. We read an integer and convert it back to a double.
-   for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + minvalue);
+   UInt_t aint[kBlockSize];
+   for (Int_t i = 0; i < n; i += kBlockSize) {
+      const Int_t nBlock = std::min(Int_t(kBlockSize), n - i);
+      FromBigEndian(aint, fBufCur, nBlock);
+      fBufCur += sizeof(UInt_t) * nBlock;
+      for (Int_t j = 0; j < nBlock; j++)
+         d[i + j] = (Double_t)(aint[j]/factor + minvalue);
    }
 }
 
@@ -1559,31 +1596,22 @@ void TBufferFile::ReadFastArrayWithNbits(Double_t *d, Int_t n, Int_t nbits)
 {
    if (n <= 0 || 3*n > fBufSize) return;
 
-   if (!nbits) {
-      //we read a float and convert it to double
-      Float_t afloat;
-      for (Int_t i = 0; i < n; i++) {
-         *this >> afloat;
-         d[i] = (Double_t)afloat;
-      }
-   } else {
-      //we read the exponent and the truncated mantissa of the float
-      //and rebuild the double.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      UChar_t  theExp;
-      UShort_t theMan;
-      for (Int_t i = 0; i < n; i++) {
-         *this >> theExp;
-         *this >> theMan;
-         fIntValue = theExp;
-         fIntValue <<= 23;
-         fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
-         if (1<<(nbits+1) & theMan) fFloatValue = -fFloatValue;
-         d[i] = (Double_t)fFloatValue;
+   Float_t afloat[kBlockSize];
+   for (Int_t i = 0; i < n; i += kBlockSize) {
+      const Int_t nBlock = std::min(Int_t(kBlockSize), n - i);
+      if (!nbits) {
+         //we read a float and convert it to double
+         FromBigEndian(afloat, fBufCur, nBlock);
+         fBufCur += sizeof(Float_t) * nBlock;
+      } else {
+         //we read the exponent and the truncated mantissa of the float
+         //and rebuild the double.
+         RByteSwapKernels::Get().fUnpackTruncatedFloats(afloat, reinterpret_cast<unsigned char *>(fBufCur), nBlock,
+                                                        nbits);
+         fBufCur += 3 * nBlock;
       }
+      for (Int_t j = 0; j < nBlock; j++)
+         d[i + j] = (Double_t)afloat[j];
    }
 }
 
@@ -1732,18 +1760,8 @@ void TBufferFile::WriteArray(const Short_t *h, Int_t n)
    Int_t l = sizeof(Short_t)*n;
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
-#ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(fBufCur, h, n);
+   ToBigEndian(fBufCur, h, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, h[i]);
-# endif
-#else
-   memcpy(fBufCur, h, l);
-   fBufCur += l;
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1762,18 +1780,8 @@ void TBufferFile::WriteArray(const Int_t *ii, Int_t n)
    Int_t l = sizeof(Int_t)*n;
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
-#ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(fBufCur, ii, n);
+   ToBigEndian(fBufCur, ii, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ii[i]);
-# endif
-#else
-   memcpy(fBufCur, ii, l);
-   fBufCur += l;
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1830,13 +1838,8 @@ void TBufferFile::WriteArray(const Long64_t *ll, Int_t n)
    Int_t l = sizeof(Long64_t)*n;
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
-#ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ll[i]);
-#else
-   memcpy(fBufCur, ll, l);
+   ToBigEndian(fBufCur, ll, n);
    fBufCur += l;
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1855,18 +1858,8 @@ void TBufferFile::WriteArray(const Float_t *f, Int_t n)
    Int_t l = sizeof(Float_t)*n;
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
-#ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(fBufCur, f, n);
+   ToBigEndian(fBufCur, f, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, f[i]);
-# endif
-#else
-   memcpy(fBufCur, f, l);
-   fBufCur += l;
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1885,13 +1878,8 @@ void TBufferFile::WriteArray(const Double_t *d, Int_t n)
    Int_t l = sizeof(Double_t)*n;
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
-#ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, d[i]);
-#else
-   memcpy(fBufCur, d, l);
+   ToBigEndian(fBufCur, d, n);
    fBufCur += l;
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1998,18 +1986,8 @@ void TBufferFile::WriteFastArray(const Short_t *h, Int_t n)
    Int_t l = sizeof(Short_t)*n;
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
-#ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy16(fBufCur, h, n);
+   ToBigEndian(fBufCur, h, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, h[i]);
-# endif
-#else
-   memcpy(fBufCur, h, l);
-   fBufCur += l;
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2022,18 +2000,8 @@ void TBufferFile::WriteFastArray(const Int_t *ii, Int_t n)
    Int_t l = sizeof(Int_t)*n;
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
-#ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(fBufCur, ii, n);
-   fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ii[i]);
-# endif
-#else
-   memcpy(fBufCur, ii, l);
+   ToBigEndian(fBufCur, ii, n);
    fBufCur += l;
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2074,13 +2042,8 @@ void TBufferFile::WriteFastArray(const Long64_t *ll, Int_t n)
    Int_t l = sizeof(Long64_t)*n;
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
-#ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ll[i]);
-#else
-   memcpy(fBufCur, ll, l);
+   ToBigEndian(fBufCur, ll, n);
    fBufCur += l;
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2093,18 +2056,8 @@ void TBufferFile::WriteFastArray(const Float_t *f, Int_t n)
    Int_t l = sizeof(Float_t)*n;
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
-#ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
-   bswapcpy32(fBufCur, f, n);
-   fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, f[i]);
-# endif
-#else
-   memcpy(fBufCur, f, l);
+   ToBigEndian(fBufCur, f, n);
    fBufCur += l;
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2117,13 +2070,8 @@ void TBufferFile::WriteFastArray(const Double_t *d, Int_t n)
    Int_t l = sizeof(Double_t)*n;
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
-#ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, d[i]);
-#else
-   memcpy(fBufCur, d, l);
+   ToBigEndian(fBufCur, d, n);
    fBufCur += l;
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2144,36 +2092,28 @@ void TBufferFile::WriteFastArrayFloat16(const Float_t *f, Int_t n, TStreamerElem
       Double_t factor = ele->GetFactor();
       Double_t xmin = ele->GetXmin();
       Double_t xmax = ele->GetXmax();
-      for (int j = 0; j < n; j++) {
-         Float_t x = f[j];
-         if (x < xmin) x = xmin;
-         if (x > xmax) x = xmax;
-         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); *this << aint;
+      UInt_t aint[kBlockSize];
+      for (Int_t i = 0; i < n; i += kBlockSize) {
+         const Int_t nBlock = std::min(Int_t(kBlockSize), n - i);
+         for (Int_t j = 0; j < nBlock; j++) {
+            Float_t x = f[i + j];
+            if (x < xmin) x = xmin;
+            if (x > xmax) x = xmax;
+            aint[j] = UInt_t(0.5+factor*(x-xmin));
+         }
+         ToBigEndian(fBufCur, aint, nBlock);
+         fBufCur += sizeof(UInt_t) * nBlock;
       }
    } else {
       Int_t nbits = 0;
       //number of bits stored in fXmin (see TStreamerElement::GetRange)
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) nbits = 12;
-      Int_t i;
       //a range is not specified, but nbits is.
       //In this case we truncate the mantissa to nbits and we stream
       //the exponent as a UChar_t and the mantissa as a UShort_t.
-      union {
-         Float_t fFloatValue;
-         Int_t   fIntValue;
-      };
-      for (i = 0; i < n; i++) {
-         fFloatValue = f[i];
-         UChar_t  theExp = (UChar_t)(0x000000ff & ((fIntValue<<1)>>24));
-         UShort_t theMan = ((1<<(nbits+1))-1) & (fIntValue>>(23-nbits-1));
-         theMan++;
-         theMan = theMan>>1;
-         if (theMan&1<<nbits) theMan = (1<<nbits) - 1;
-         if (fFloatValue < 0) theMan |= 1<<(nbits+1);
-         *this << theExp;
-         *this << theMan;
-      }
+      PackTruncatedFloats(reinterpret_cast<unsigned char *>(fBufCur), f, n, nbits);
+      fBufCur += 3 * n;
    }
 }
 
@@ -2195,41 +2135,37 @@ void TBufferFile::WriteFastArrayDouble32(const Double_t *d, Int_t n, TStreamerEl
       Double_t factor = ele->GetFactor();
       Double_t xmin = ele->GetXmin();
       Double_t xmax = ele->GetXmax();
-      for (int j = 0; j < n; j++) {
-         Double_t x = d[j];
-         if (x < xmin) x = xmin;
-         if (x > xmax) x = xmax;
-         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); *this << aint;
+      UInt_t aint[kBlockSize];
+      for (Int_t i = 0; i < n; i += kBlockSize) {
+         const Int_t nBlock = std::min(Int_t(kBlockSize), n - i);
+         for (Int_t j = 0; j < nBlock; j++) {
+            Double_t x = d[i + j];
+            if (x < xmin) x = xmin;
+            if (x > xmax) x = xmax;
+            aint[j] = UInt_t(0.5+factor*(x-xmin));
+         }
+         ToBigEndian(fBufCur, aint, nBlock);
+         fBufCur += sizeof(UInt_t) * nBlock;
       }
    } else {
       Int_t nbits = 0;
       //number of bits stored in fXmin (see TStreamerElement::GetRange)
       if (ele) nbits = (Int_t)ele->GetXmin();
-      Int_t i;
-      if (!nbits) {
-         //if no range and no bits specified, we convert from double to float
-         for (i = 0; i < n; i++) {
-            Float_t afloat = (Float_t)d[i];
-            *this << afloat;
-         }
-      } else {
-         //a range is not specified, but nbits is.
-         //In this case we truncate the mantissa to nbits and we stream
-         //the exponent as a UChar_t and the mantissa as a UShort_t.
-         union {
-            Float_t fFloatValue;
-            Int_t   fIntValue;
-         };
-         for (i = 0; i < n; i++) {
-            fFloatValue = (Float_t)d[i];
-            UChar_t  theExp = (UChar_t)(0x000000ff & ((fIntValue<<1)>>24));
-            UShort_t theMan = ((1<<(nbits+1))-1) & (fIntValue>>(23-nbits-1));
-            theMan++;
-            theMan = theMan>>1;
-            if(theMan&1<<nbits) theMan = (1<<nbits) - 1;
-            if (fFloatValue < 0) theMan |= 1<<(nbits+1);
-            *this << theExp;
-            *this << theMan;
+      Float_t afloat[kBlockSize];
+      for (Int_t i = 0; i < n; i += kBlockSize) {
+         const Int_t nBlock = std::min(Int_t(kBlockSize), n - i);
+         for (Int_t j = 0; j < nBlock; j++)
+            afloat[j] = (Float_t)d[i + j];
+         if (!nbits) {
+            //if no range and no bits specified, we convert from double to float
+            ToBigEndian(fBufCur, afloat, nBlock);
+            fBufCur += sizeof(Float_t) * nBlock;
+         } else {
+            //a range is not specified, but nbits is.
+            //In this case we truncate the mantissa to nbits and we stream
+            //the exponent as a UChar_t and the mantissa as a UShort_t.
+            PackTruncatedFloats(reinterpret_cast<unsigned char *>(fBufCur), afloat, nBlock, nbits);
+            fBufCur += 3 * nBlock;
          }
       }
    }
@@ -67,13 +67,20 @@ size_t TBufferMerger::GetQueueSize() const
 
 void TBufferMerger::Push(TBufferFile *buffer)
 {
+   bool overBudget, autoSave;
    {
       std::lock_guard<std::mutex> lock(fQueueMutex);
       fBuffered += buffer->BufferSize();
       fQueue.push(buffer);
+      overBudget = fMemoryBudget > 0 && fBuffered + fMerging > fMemoryBudget;
+      autoSave = fBuffered > fAutoSave;
    }
 
-   if (fBuffered > fAutoSave)
+   // Beyond the budget, the producer waits for the ongoing merge and then merges the queue,
+   // such that it cannot queue further buffers in the meantime
+   if (overBudget)
+      Merge(/* wait = */ true);
+   else if (autoSave)
       Merge();
 }
 
@@ -82,6 +89,17 @@ size_t TBufferMerger::GetAutoSave() const
    return fAutoSave;
 }
 
+size_t TBufferMerger::GetBuffered() const
+{
+   std::lock_guard<std::mutex> lock(fQueueMutex);
+   return fBuffered + fMerging;
+}
+
+size_t TBufferMerger::GetMemoryBudget() const
+{
+   return fMemoryBudget;
+}
+
 const char *TBufferMerger::GetMergeOptions()
 {
    return fMerger.GetMergeOptions();
@@ -93,31 +111,47 @@ void TBufferMerger::SetAutoSave(size_t size)
    fAutoSave = size;
 }
 
+void TBufferMerger::SetMemoryBudget(size_t size)
+{
+   fMemoryBudget = size;
+}
+
 void TBufferMerger::SetMergeOptions(const TString& options)
 {
    fMerger.SetMergeOptions(options);
 }
 
-void TBufferMerger::Merge()
+void TBufferMerger::Merge(bool wait)
 {
-   if (fMergeMutex.try_lock()) {
-      std::queue<TBufferFile *> queue;
-      {
-         std::lock_guard<std::mutex> q(fQueueMutex);
-         std::swap(queue, fQueue);
-         fBuffered = 0;
-      }
-
-      while (!queue.empty()) {
-         std::unique_ptr<TBufferFile> buffer{queue.front()};
-         fMerger.AddAdoptFile(new TMemFile(fMerger.GetOutputFileName(), std::move(buffer)));
-         queue.pop();
-      }
-
-      fMerger.PartialMerge();
-      fMerger.Reset();
-      fMergeMutex.unlock();
+   std::unique_lock<std::mutex> mergeLock(fMergeMutex, std::defer_lock);
+   if (wait)
+      mergeLock.lock();
+   else if (!mergeLock.try_lock())
+      return;
+
+   std::queue<TBufferFile *> queue;
+   {
+      std::lock_guard<std::mutex> q(fQueueMutex);
+      std::swap(queue, fQueue);
+      fMerging = fBuffered;
+      fBuffered = 0;
+   }
+
+   // A waiting producer may find that the queue was merged in the meantime
+   if (queue.empty())
+      return;
+
+   while (!queue.empty()) {
+      std::unique_ptr<TBufferFile> buffer{queue.front()};
+      fMerger.AddAdoptFile(new TMemFile(fMerger.GetOutputFileName(), std::move(buffer)));
+      queue.pop();
    }
+
+   fMerger.PartialMerge();
+   fMerger.Reset();
+
+   std::lock_guard<std::mutex> q(fQueueMutex);
+   fMerging = 0;
 }
 
 } // namespace Experimental
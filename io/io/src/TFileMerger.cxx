@@ -622,11 +622,14 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
                               ROOT::MergeFunc_t func = cl->GetMerge();
                               Long64_t result = func(obj, &inputs, &info);
                               info.fIsFirst = kFALSE;
+                              inputs.Delete();
                               if (result < 0) {
                                  Error("MergeRecursive", "calling Merge() on '%s' with the corresponding object in '%s'",
                                        key->GetName(), nextsource->GetName());
                               }
-                              inputs.Delete();
+                              // E.g. a TTree whose baskets could not be fast cloned: the output would be corrupt
+                              if (info.fIsIncomplete)
+                                 return kFALSE;
                            }
                         }
                      }
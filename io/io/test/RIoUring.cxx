@@ -43,6 +43,99 @@ TEST(RRawFileUnix, ReadV)
    }
 }
 
+TEST(RRawFileUnix, ReadVAsync)
+{
+   auto file = "test_uring_readv_async";
+   auto filesize = 2 << 20;
+   FileRaii fileGuard(file, std::string(filesize, 'b')); // ~2MB
+   auto f = RRawFileUnix::Create(file);
+   EXPECT_TRUE(f->GetFeatures() & RRawFile::kFeatureHasAsyncIo);
+
+   auto nReq = 2000; // larger than the typical ring size, remaining batches are submitted in Wait()
+
+   auto iovecsA = make_iovecs(nReq, filesize);
+   auto iovecsB = make_iovecs(nReq, filesize);
+   auto handleA = f->ReadVAsync(iovecsA.data(), nReq);
+   auto handleB = f->ReadVAsync(iovecsB.data(), nReq);
+   handleB->Wait();
+   handleA->Wait();
+
+   for (auto iovecs : {iovecsA, iovecsB}) {
+      for (auto iovec: iovecs) {
+         EXPECT_GT(iovec.fOutBytes, 0U);
+         for (std::size_t i = 0; i < iovec.fOutBytes; ++i) {
+            EXPECT_EQ('b', ((unsigned char*)iovec.fBuffer)[i]);
+         }
+         free(iovec.fBuffer);
+      }
+   }
+}
+
+TEST(RRawFileUnix, ManyReadVAsync)
+{
+   auto file = "test_uring_readv_many";
+   auto filesize = 2 << 20;
+   FileRaii fileGuard(file, std::string(filesize, 'c')); // ~2MB
+   auto f = RRawFileUnix::Create(file);
+
+   // Many requests in flight at the same time share the io_uring instance of the file; with a ring per request,
+   // they would exhaust the memlock limit
+   const int nHandles = 512;
+   const int nReq = 4;
+   std::vector<std::vector<RIOVec>> iovecs;
+   std::vector<std::unique_ptr<RRawFile::RAsyncReadV>> handles;
+   for (int i = 0; i < nHandles; ++i) {
+      iovecs.emplace_back(make_iovecs(nReq, filesize));
+      handles.emplace_back(f->ReadVAsync(iovecs.back().data(), nReq));
+   }
+   // Wait in reverse order, so that the completions of other requests are reaped first
+   for (int i = nHandles - 1; i >= 0; --i)
+      handles[i]->Wait();
+
+   for (auto &requestIovecs : iovecs) {
+      for (auto iovec : requestIovecs) {
+         EXPECT_GT(iovec.fOutBytes, 0U);
+         for (std::size_t i = 0; i < iovec.fOutBytes; ++i) {
+            EXPECT_EQ('c', ((unsigned char*)iovec.fBuffer)[i]);
+         }
+         free(iovec.fBuffer);
+      }
+   }
+}
+
+TEST(RRawFileUnix, ReadVAsyncError)
+{
+   auto file = "test_uring_readv_error";
+   auto filesize = 2 << 20;
+   FileRaii fileGuard(file, std::string(filesize, 'd')); // ~2MB
+   auto f = RRawFileUnix::Create(file);
+
+   const int nReq = 16;
+   auto iovecsA = make_iovecs(nReq, filesize);
+   auto iovecsB = make_iovecs(nReq, filesize);
+   // The kernel fails to write into an invalid address rather than crashing
+   void *validBuffer = iovecsA[nReq / 2].fBuffer;
+   iovecsA[nReq / 2].fBuffer = reinterpret_cast<void *>(16);
+   auto handleA = f->ReadVAsync(iovecsA.data(), nReq);
+   auto handleB = f->ReadVAsync(iovecsB.data(), nReq);
+   // Waiting for B reaps the failed event of A, which is reported by A only
+   EXPECT_NO_THROW(handleB->Wait());
+   EXPECT_THROW(handleA->Wait(), std::runtime_error);
+   // A third request on the same ring is not affected either
+   auto iovecsC = make_iovecs(nReq, filesize);
+   EXPECT_NO_THROW(f->ReadVAsync(iovecsC.data(), nReq)->Wait());
+
+   for (auto iovecs : {iovecsB, iovecsC}) {
+      for (auto iovec : iovecs)
+         EXPECT_GT(iovec.fOutBytes, 0U);
+   }
+   iovecsA[nReq / 2].fBuffer = validBuffer;
+   for (auto iovecs : {iovecsA, iovecsB, iovecsC}) {
+      for (auto iovec : iovecs)
+         free(iovec.fBuffer);
+   }
+}
+
 TEST(RawUring, NopRoundTrip)
 {
    struct io_uring ring;
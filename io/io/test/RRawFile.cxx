@@ -132,6 +132,34 @@ TEST(RRawFile, ReadV)
 }
 
 
+TEST(RRawFile, ReadVAsync)
+{
+   FileRaii readvGuard("test_rawfile_readv_async", "Hello, World");
+   auto f = RRawFile::Create("test_rawfile_readv_async");
+
+   char buffer[2];
+   buffer[0] = buffer[1] = 0;
+   RRawFile::RIOVec iovec[2];
+   iovec[0].fBuffer = &buffer[0];
+   iovec[0].fOffset = 0;
+   iovec[0].fSize = 1;
+   iovec[1].fBuffer = &buffer[1];
+   iovec[1].fOffset = 11;
+   iovec[1].fSize = 2;
+   auto handle = f->ReadVAsync(iovec, 2);
+   handle->Wait();
+
+   EXPECT_EQ(1U, iovec[0].fOutBytes);
+   EXPECT_EQ(1U, iovec[1].fOutBytes);
+   EXPECT_EQ('H', buffer[0]);
+   EXPECT_EQ('d', buffer[1]);
+
+   // Waiting twice is harmless
+   handle->Wait();
+   EXPECT_EQ('H', buffer[0]);
+}
+
+
 TEST(RRawFile, SplitUrl)
 {
    EXPECT_STREQ("C:\\Data\\events.root", RRawFile::GetLocation("C:\\Data\\events.root").c_str());
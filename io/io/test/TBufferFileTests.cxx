@@ -0,0 +1,124 @@
+#include "TBufferFile.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+// Array lengths around the thresholds and block sizes of the vectorized conversion
+const std::vector<Int_t> kArraySizes{1, 3, 7, 8, 15, 16, 17, 31, 33, 64, 100, 255, 256, 257, 1000, 4099};
+
+template <typename T>
+std::vector<T> MakeValues(Int_t n)
+{
+   std::vector<T> values(n);
+   for (Int_t i = 0; i < n; ++i)
+      values[i] = static_cast<T>((i * 7919) % 20011) * ((i % 2) ? -1 : 1) + static_cast<T>(i) / 8;
+   return values;
+}
+
+template <typename T>
+void CheckRoundTrip(Int_t n)
+{
+   const auto values = MakeValues<T>(n);
+   TBufferFile writeBuf(TBuffer::kWrite);
+   // Misalign the array with respect to the buffer start
+   writeBuf.WriteChar(0);
+   writeBuf.WriteFastArray(values.data(), n);
+
+   // The serialized form is big-endian
+   const auto bytes = reinterpret_cast<const unsigned char *>(writeBuf.Buffer()) + 1;
+   for (Int_t i = 0; i < n; ++i) {
+      const auto valueBytes = reinterpret_cast<const unsigned char *>(&values[i]);
+      for (std::size_t b = 0; b < sizeof(T); ++b) {
+#ifdef R__BYTESWAP
+         ASSERT_EQ(valueBytes[sizeof(T) - 1 - b], bytes[i * sizeof(T) + b]);
+#else
+         ASSERT_EQ(valueBytes[b], bytes[i * sizeof(T) + b]);
+#endif
+      }
+   }
+
+   TBufferFile readBuf(TBuffer::kRead, writeBuf.Length(), writeBuf.Buffer(), kFALSE);
+   Char_t c;
+   readBuf.ReadChar(c);
+   std::vector<T> result(n);
+   readBuf.ReadFastArray(result.data(), n);
+   EXPECT_EQ(values, result) << "n = " << n;
+   EXPECT_EQ(writeBuf.Length(), readBuf.Length());
+}
+
+} // anonymous namespace
+
+TEST(TBufferFile, FastArrayRoundTrip)
+{
+   for (auto n : kArraySizes) {
+      CheckRoundTrip<Short_t>(n);
+      CheckRoundTrip<UShort_t>(n);
+      CheckRoundTrip<Int_t>(n);
+      CheckRoundTrip<UInt_t>(n);
+      CheckRoundTrip<Long64_t>(n);
+      CheckRoundTrip<ULong64_t>(n);
+      CheckRoundTrip<Float_t>(n);
+      CheckRoundTrip<Double_t>(n);
+   }
+}
+
+TEST(TBufferFile, Float16Nbits)
+{
+   for (auto n : kArraySizes) {
+      const auto values = MakeValues<Float_t>(n);
+
+      // Without a streamer element, the mantissa is truncated to 12 bits
+      TBufferFile writeBuf(TBuffer::kWrite);
+      writeBuf.WriteFastArrayFloat16(values.data(), n);
+      TBufferFile scalarBuf(TBuffer::kWrite);
+      for (auto v : values)
+         scalarBuf.WriteFloat16(&v);
+      ASSERT_EQ(scalarBuf.Length(), writeBuf.Length());
+      EXPECT_EQ(0, memcmp(scalarBuf.Buffer(), writeBuf.Buffer(), writeBuf.Length()));
+
+      std::vector<Float_t> expected(n);
+      TBufferFile scalarRead(TBuffer::kRead, scalarBuf.Length(), scalarBuf.Buffer(), kFALSE);
+      for (auto &v : expected)
+         scalarRead.ReadWithNbits(&v, 12);
+
+      std::vector<Float_t> floats(n);
+      TBufferFile floatRead(TBuffer::kRead, writeBuf.Length(), writeBuf.Buffer(), kFALSE);
+      floatRead.ReadFastArrayWithNbits(floats.data(), n, 12);
+      EXPECT_EQ(expected, floats) << "n = " << n;
+
+      std::vector<Double_t> doubles(n);
+      TBufferFile doubleRead(TBuffer::kRead, writeBuf.Length(), writeBuf.Buffer(), kFALSE);
+      doubleRead.ReadFastArrayWithNbits(doubles.data(), n, 12);
+      for (Int_t i = 0; i < n; ++i) {
+         EXPECT_EQ(Double_t(expected[i]), doubles[i]);
+         EXPECT_NEAR(values[i], doubles[i], std::abs(values[i]) / 1000.);
+      }
+   }
+}
+
+TEST(TBufferFile, Float16Factor)
+{
+   const Double_t factor = 0.5;
+   const Double_t minValue = -10.;
+   for (auto n : kArraySizes) {
+      TBufferFile writeBuf(TBuffer::kWrite);
+      for (Int_t i = 0; i < n; ++i)
+         writeBuf.WriteUInt(UInt_t(i));
+
+      std::vector<Float_t> floats(n);
+      TBufferFile floatRead(TBuffer::kRead, writeBuf.Length(), writeBuf.Buffer(), kFALSE);
+      floatRead.ReadFastArrayWithFactor(floats.data(), n, factor, minValue);
+      std::vector<Double_t> doubles(n);
+      TBufferFile doubleRead(TBuffer::kRead, writeBuf.Length(), writeBuf.Buffer(), kFALSE);
+      doubleRead.ReadFastArrayWithFactor(doubles.data(), n, factor, minValue);
+      for (Int_t i = 0; i < n; ++i) {
+         EXPECT_FLOAT_EQ(Float_t(i / factor + minValue), floats[i]);
+         EXPECT_DOUBLE_EQ(i / factor + minValue, doubles[i]);
+      }
+   }
+}
@@ -11,6 +11,7 @@
 #include <cstdio>
 #include <future>
 #include <memory>
+#include <random>
 #include <thread>
 #include <sys/stat.h>
 
@@ -178,6 +179,66 @@ TEST(TBufferMerger, AutoSave)
    RemoveFile("tbuffermerger_autosave.root");
 }
 
+TEST(TBufferMerger, MemoryBudget)
+{
+   const int nthreads = 8;
+   const int nwrites = 10;
+   const int nevents = 20000;
+   const size_t budget = 1024 * 1024;
+   // Each buffer holds about nevents doubles that hardly compress
+   const size_t maxBufferSize = 400 * 1024;
+
+   ROOT::EnableThreadSafety();
+
+   {
+      TBufferMerger merger("tbuffermerger_budget.root");
+      // Without the budget, all the buffers would be queued until the end
+      merger.SetAutoSave(1024 * 1024 * 1024);
+      merger.SetMemoryBudget(budget);
+      EXPECT_EQ(budget, merger.GetMemoryBudget());
+
+      std::atomic<size_t> maxBuffered{0};
+      std::vector<std::thread> threads;
+      for (int i = 0; i < nthreads; ++i) {
+         threads.emplace_back([=, &merger, &maxBuffered]() {
+            auto myfile = merger.GetFile();
+            auto mytree = new TTree("mytree", "mytree");
+            mytree->ResetBit(kMustCleanup);
+            double x = 0;
+            mytree->Branch("x", &x);
+            std::mt19937 random(i + 1);
+            std::uniform_real_distribution<double> uniform;
+            for (int w = 0; w < nwrites; ++w) {
+               for (int e = 0; e < nevents; ++e) {
+                  x = uniform(random);
+                  mytree->Fill();
+               }
+               myfile->Write();
+               size_t buffered = merger.GetBuffered();
+               size_t seen = maxBuffered;
+               while (buffered > seen && !maxBuffered.compare_exchange_weak(seen, buffered)) {
+               }
+            }
+            mytree->ResetBranchAddresses();
+         });
+      }
+
+      for (auto &&t : threads)
+         t.join();
+
+      EXPECT_LE(maxBuffered, budget + nthreads * maxBufferSize);
+   }
+
+   {
+      TFile f("tbuffermerger_budget.root");
+      auto t = f.Get<TTree>("mytree");
+      ASSERT_TRUE(t != nullptr);
+      EXPECT_EQ(nthreads * nwrites * nevents, t->GetEntries());
+   }
+
+   RemoveFile("tbuffermerger_budget.root");
+}
+
 TEST(TBufferMerger, CheckTreeFillResults)
 {
    int sum_s, sum_p;
@@ -2,7 +2,9 @@
 
 #include "TFileMerger.h"
 
+#include "TError.h"
 #include "TMemFile.h"
+#include "TNamed.h"
 #include "TTree.h"
 
 static void CreateATuple(TMemFile &file, const char *name, double value)
@@ -68,3 +70,34 @@ TEST(TFileMerger, CreateWithUnwritableTFilePointer)
    ROOT_EXPECT_ERROR(merger.OutputFile(std::move(output)), "TFileMerger::OutputFile",
                      "output file output.root is not writable");
 }
+
+TEST(TFileMerger, ContinueAfterFailedMerge)
+{
+   TMemFile a("a.root", "RECREATE");
+   CreateATuple(a, "a_tree", 1.);
+   CreateATuple(a, "c_tree", 3.);
+
+   // A TTree cannot be merged with an object of another class with the same name
+   TMemFile b("b.root", "RECREATE");
+   TNamed notATree("a_tree", "not a tree");
+   b.WriteObject(&notATree, "a_tree");
+   CreateATuple(b, "c_tree", 4.);
+
+   TFileMerger merger;
+   ASSERT_TRUE(merger.OutputFile(std::unique_ptr<TMemFile>(new TMemFile("output.root", "CREATE"))));
+   merger.AddFile(&a, false);
+   merger.AddFile(&b, false);
+   {
+      // Both TTree::Merge and TFileMerger::MergeRecursive report the failure
+      const auto errorIgnoreLevel = gErrorIgnoreLevel;
+      gErrorIgnoreLevel = kFatal;
+      // Only the failure to read the input of a merged object stops the merge
+      EXPECT_TRUE(merger.PartialMerge());
+      gErrorIgnoreLevel = errorIgnoreLevel;
+   }
+
+   auto &result = *static_cast<TMemFile *>(merger.GetOutputFile());
+   auto c = result.Get<TTree>("c_tree");
+   ASSERT_NE(c, nullptr);
+   EXPECT_EQ(2, c->GetEntries());
+}
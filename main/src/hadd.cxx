@@ -27,6 +27,9 @@
   \param -O   Re-optimize basket size when merging TTree
   \param -v   Explicitly set the verbosity level: 0 request no output, 99 is the default
   \param -j   Parallelise the execution in multiple processes
+  \param -mt  Merge in a single process using several threads (optionally followed by the number of threads):
+              while the baskets of an input tree are copied, its next baskets are read in the background and,
+              when they are recompressed, the branches are compressed in parallel
   \param -dbg  Parallelise the execution in multiple processes in debug mode (Does not delete  partial  files  stored
               inside working directory)
   \param -d   Carry out the partial multiprocess execution in the specified directory
@@ -80,6 +83,13 @@
   (i.e. direct copy of the raw byte on disk). The "fast" mode is typically
   5 times faster than the mode unzipping and unstreaming the baskets.
 
+  With the option -mt, the input trees are merged in a single process and
+  without partial files. While the baskets of an input tree are written in
+  order to the target file, a thread reads the next baskets of the same
+  input file; the input files themselves are still read one after the
+  other. If the baskets must be recompressed, the branches are compressed
+  in parallel.
+
   If the option -cachesize is used, hadd will resize (or disable if 0) the
   prefetching cache use to speed up I/O operations.
 
@@ -101,6 +111,7 @@
 #include "ROOT/TIOFeatures.hxx"
 #include "TFile.h"
 #include "THashList.h"
+#include "TROOT.h"
 #include "TKey.h"
 #include "TClass.h"
 #include "TSystem.h"
@@ -139,6 +150,8 @@ int main( int argc, char **argv )
    Bool_t keepCompressionAsIs = kFALSE;
    Bool_t useFirstInputCompression = kFALSE;
    Bool_t multiproc = kFALSE;
+   Bool_t multithread = kFALSE;
+   UInt_t nThreads = 0;
    Bool_t debug = kFALSE;
    Int_t maxopenedfiles = 0;
    Int_t verbosity = 99;
@@ -213,6 +226,19 @@ int main( int argc, char **argv )
          }
          multiproc = kTRUE;
          ++ffirst;
+      } else if (strcmp(argv[a], "-mt") == 0) {
+         // If the number of threads is not specified, let the thread pool use all the cores.
+         if (a + 1 != argc && isdigit(argv[a + 1][0])) {
+            char *end = nullptr;
+            Long_t request = strtol(argv[a + 1], &end, 10);
+            if (*end == '\0' && request < kMaxInt) {
+               nThreads = (UInt_t)request;
+               ++a;
+               ++ffirst;
+            }
+         }
+         multithread = kTRUE;
+         ++ffirst;
       } else if ( strcmp(argv[a],"-cachesize=") == 0 ) {
          int size;
          static const size_t arglen = strlen("-cachesize=");
@@ -363,6 +389,18 @@ int main( int argc, char **argv )
 
    gSystem->Load("libTreePlayer");
 
+   if (multithread) {
+#ifdef R__USE_IMT
+      if (multiproc) {
+         std::cout << "hadd: the options -j and -mt are exclusive, merging in a single process." << std::endl;
+         multiproc = kFALSE;
+      }
+      ROOT::EnableImplicitMT(nThreads);
+#else
+      std::cerr << "Error: option -mt requires ROOT to be built with implicit multi-threading (ignored).\n";
+#endif
+   }
+
    const char *targetname = 0;
    if (outputPlace) {
       targetname = argv[outputPlace];
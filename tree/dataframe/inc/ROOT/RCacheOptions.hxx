@@ -0,0 +1,31 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RCACHEOPTIONS
+#define ROOT_RCACHEOPTIONS
+
+#include <cstddef>
+#include <string>
+
+namespace ROOT {
+
+namespace RDF {
+/// A collection of options to steer where Cache keeps the cached columns
+struct RCacheOptions {
+   /// If non-zero, the approximate number of bytes that the cached values may take in memory. Beyond it, the cached
+   /// values are spilled to a scratch file, which requires ROOT to be built with root7.
+   std::size_t fMemoryBudget = 0;
+   /// The directory of the scratch file; the temporary directory of the system if empty
+   std::string fScratchDir;
+};
+} // ns RDF
+} // ns ROOT
+
+#endif
@@ -20,6 +20,7 @@
 #define ROOT_RDFOPERATIONS
 
 #include "Compression.h"
+#include "ROOT/RCacheOptions.hxx"
 #include "ROOT/RIntegerSequence.hxx"
 #include "ROOT/RStringView.hxx"
 #include "ROOT/RVec.hxx"
@@ -43,10 +44,15 @@
 #include "TTree.h"
 #include "TTreeReader.h" // for SnapshotHelper
 #include "ROOT/RDF/RMergeableValue.hxx"
+#include "ROOT/RDF/RCacheDS.hxx"
+#include "ROOT/RDF/RNTupleSnapshotWriter.hxx"
 
 #include <algorithm>
+#include <atomic>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
@@ -62,6 +68,11 @@ namespace RDF {
 template <typename Helper>
 class RActionImpl {
 public:
+   /// Whether the action can be run in bulk mode, see RLoopManager::SetBulkSize(). Helpers that keep the addresses of
+   /// the column values between calls to Exec must set it to false: in bulk mode, the values of each entry of a bulk
+   /// are stored at a different address.
+   static constexpr bool fgSupportsBulk = true;
+
    virtual ~RActionImpl() = default;
    // call Helper::FinalizeTask if present, do nothing otherwise
    template <typename T = Helper>
@@ -1255,6 +1266,8 @@ class SnapshotHelper : public RActionImpl<SnapshotHelper<ColTypes...>> {
 
 public:
    using ColumnTypes_t = TypeList<ColTypes...>;
+   // the column values are used as branch addresses
+   static constexpr bool fgSupportsBulk = false;
    SnapshotHelper(std::string_view filename, std::string_view dirname, std::string_view treename,
                   const ColumnNames_t &vbnames, const ColumnNames_t &bnames, const RSnapshotOptions &options)
       : fFileName(filename), fDirName(dirname), fTreeName(treename), fOptions(options), fInputBranchNames(vbnames),
@@ -1388,6 +1401,8 @@ class SnapshotHelperMT : public RActionImpl<SnapshotHelperMT<ColTypes...>> {
 
 public:
    using ColumnTypes_t = TypeList<ColTypes...>;
+   // the column values are used as branch addresses
+   static constexpr bool fgSupportsBulk = false;
    SnapshotHelperMT(const unsigned int nSlots, std::string_view filename, std::string_view dirname,
                     std::string_view treename, const ColumnNames_t &vbnames, const ColumnNames_t &bnames,
                     const RSnapshotOptions &options)
@@ -1533,6 +1548,236 @@ public:
    std::string GetActionName() { return "Snapshot"; }
 };
 
+/// Helper object for a Snapshot action that writes RNTuple, single- or multi-thread
+template <typename... ColTypes>
+class SnapshotHelperRNTuple : public RActionImpl<SnapshotHelperRNTuple<ColTypes...>> {
+   std::unique_ptr<RNTupleSnapshotWriter> fWriter; // must use a ptr because RNTupleSnapshotWriter is not movable
+   std::vector<int> fIsFirstEvent; // vector<bool> does not allow concurrent writing of different elements
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   // the column values are used as the addresses of the field values
+   static constexpr bool fgSupportsBulk = false;
+   SnapshotHelperRNTuple(const unsigned int nSlots, std::string_view filename, std::string_view ntuplename,
+                         const ColumnNames_t &bnames, const RSnapshotOptions &options)
+      : fWriter(new RNTupleSnapshotWriter(nSlots, std::string(filename), std::string(ntuplename),
+                                          ReplaceDotWithUnderscore(bnames), {TypeID2TypeName(typeid(ColTypes))...},
+                                          options)),
+        fIsFirstEvent(nSlots, 1)
+   {
+   }
+   SnapshotHelperRNTuple(const SnapshotHelperRNTuple &) = delete;
+   SnapshotHelperRNTuple(SnapshotHelperRNTuple &&) = default;
+
+   void InitTask(TTreeReader *, unsigned int slot)
+   {
+      // the addresses of the column values can change between tasks
+      fIsFirstEvent[slot] = 1;
+   }
+
+   void Exec(unsigned int slot, ColTypes &... values)
+   {
+      if (fIsFirstEvent[slot]) {
+         fWriter->Connect(slot, {static_cast<void *>(&values)...});
+         fIsFirstEvent[slot] = 0;
+      }
+      fWriter->Fill(slot);
+   }
+
+   void Initialize() { fWriter->Initialize(); }
+
+   void Finalize() { fWriter->Finalize(); }
+
+   /// The RDataFrame that reads the output, returned by Snapshot
+   std::shared_ptr<ROOT::RDataFrame> GetOutputRDF() { return fWriter->GetOutputRDF(); }
+
+   std::string GetActionName() { return "Snapshot"; }
+};
+
+/// Return a file name in the given directory, or in the temporary directory if empty, that no other cache of this or
+/// another process uses
+std::string MakeCacheFileName(const std::string &dir);
+
+/// The approximate number of bytes that a value takes in the memory of Cache, see RCacheOptions::fMemoryBudget
+template <typename T>
+std::size_t GetCacheSize(const T &)
+{
+   return sizeof(T);
+}
+
+template <typename T>
+std::size_t GetCacheSize(const std::vector<T> &v)
+{
+   return sizeof(v) + v.size() * sizeof(T);
+}
+
+template <typename T>
+std::size_t GetCacheSize(const RVec<T> &v)
+{
+   return sizeof(v) + v.size() * sizeof(T);
+}
+
+inline std::size_t GetCacheSize(const std::string &s)
+{
+   return sizeof(s) + s.size();
+}
+
+/// Fills the store of a Cache with a memory budget, see RCacheOptions::fMemoryBudget.
+/// The slots keep their values in memory as long as all slots together stay within the budget. Once the budget is
+/// exceeded, every slot moves its values to an RNTuple in a scratch file at its next entry, and from then on writes
+/// the following entries to that file directly.
+template <typename... ColTypes>
+class CacheHelper : public RActionImpl<CacheHelper<ColTypes...>> {
+   using Values_t = std::tuple<std::vector<ColTypes>...>;
+   /// The state that the slots share, held by pointer because atomics and once flags are not movable
+   struct RSharedState {
+      /// The number of bytes that the slots have reported so far
+      std::atomic<std::size_t> fNBytes{0};
+      std::atomic<bool> fMustSpill{false};
+      std::once_flag fWriterInitialized;
+   };
+   /// The number of bytes that a slot caches before it reports them to the shared state
+   static constexpr std::size_t kNBytesPerReport = 64 * 1024;
+
+   const std::shared_ptr<RCacheStore<ColTypes...>> fStore;
+   const std::size_t fMemoryBudget;
+   std::unique_ptr<RNTupleSnapshotWriter> fWriter; // must use a ptr because RNTupleSnapshotWriter is not movable
+   std::unique_ptr<RSharedState> fSharedState;
+   /// Per slot, the values cached in memory
+   std::vector<Values_t> fValues;
+   /// Per slot, the number of bytes cached in memory that have not been reported yet
+   std::vector<std::size_t> fNBytes;
+   /// Per slot, whether the slot writes to the scratch file; vector<bool> does not allow concurrent writing
+   std::vector<int> fIsSpilling;
+   /// Per slot, the entry that the slot writes to the scratch file
+   std::vector<std::tuple<ColTypes...>> fEntries;
+
+   template <std::size_t... S>
+   void Push(unsigned int slot, std::index_sequence<S...>, const ColTypes &... values)
+   {
+      int expander[] = {(std::get<S>(fValues[slot]).push_back(values), 0)...};
+      (void)expander;
+      std::size_t nBytes = 0;
+      int sizeExpander[] = {(nBytes += GetCacheSize(values), 0)...};
+      (void)sizeExpander;
+
+      fNBytes[slot] += nBytes;
+      if (fNBytes[slot] >= kNBytesPerReport) {
+         const auto nTotal = fSharedState->fNBytes.fetch_add(fNBytes[slot]) + fNBytes[slot];
+         fNBytes[slot] = 0;
+         if (nTotal > fMemoryBudget)
+            fSharedState->fMustSpill = true;
+      }
+   }
+
+   template <std::size_t... S>
+   void Write(unsigned int slot, std::index_sequence<S...>, const ColTypes &... values)
+   {
+      int expander[] = {(std::get<S>(fEntries[slot]) = values, 0)...};
+      (void)expander;
+      fWriter->Fill(slot);
+   }
+
+   /// Write the values that the slot cached in memory to the scratch file, and release their memory
+   template <std::size_t... S>
+   void Spill(unsigned int slot, std::index_sequence<S...>)
+   {
+      std::call_once(fSharedState->fWriterInitialized, [this] { fWriter->Initialize(); });
+      fWriter->Connect(slot, {static_cast<void *>(&std::get<S>(fEntries[slot]))...});
+      fIsSpilling[slot] = 1;
+
+      auto &values = fValues[slot];
+      const auto nEntries = std::get<0>(values).size();
+      for (std::size_t i = 0; i < nEntries; ++i) {
+         int expander[] = {(std::get<S>(fEntries[slot]) = std::move(std::get<S>(values)[i]), 0)...};
+         (void)expander;
+         fWriter->Fill(slot);
+      }
+      values = Values_t();
+   }
+
+   template <std::size_t I>
+   int MoveColumnToStore()
+   {
+      auto &column = std::get<I>(fStore->fValues);
+      std::size_t nEntries = 0;
+      for (auto &values : fValues)
+         nEntries += std::get<I>(values).size();
+      column.clear();
+      column.reserve(nEntries);
+      for (auto &values : fValues) {
+         auto &slotColumn = std::get<I>(values);
+         std::move(slotColumn.begin(), slotColumn.end(), std::back_inserter(column));
+      }
+      return 0;
+   }
+
+   /// Move the values that the slots cached in memory to the store
+   template <std::size_t... S>
+   void MoveToStore(std::index_sequence<S...>)
+   {
+      int expander[] = {MoveColumnToStore<S>()...};
+      (void)expander;
+   }
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   CacheHelper(const std::shared_ptr<RCacheStore<ColTypes...>> &store, const ColumnNames_t &columnNames,
+               const RCacheOptions &options, const unsigned int nSlots)
+      : fStore(store), fMemoryBudget(options.fMemoryBudget), fSharedState(new RSharedState), fValues(nSlots),
+        fNBytes(nSlots, 0), fIsSpilling(nSlots, 0), fEntries(nSlots)
+   {
+      // the scratch file is written for reading it back soon: favour speed over compression
+      RSnapshotOptions writeOptions;
+      writeOptions.fCompressionAlgorithm = ROOT::kLZ4;
+      writeOptions.fCompressionLevel = 1;
+      fStore->fFieldNames = ReplaceDotWithUnderscore(columnNames);
+      // checks at booking that the columns can be spilled, which creates the file only once it has to
+      fWriter.reset(new RNTupleSnapshotWriter(nSlots, MakeCacheFileName(options.fScratchDir),
+                                              fStore->GetNTupleName(), fStore->fFieldNames,
+                                              {TypeID2TypeName(typeid(ColTypes))...}, writeOptions));
+   }
+   CacheHelper(const CacheHelper &) = delete;
+   CacheHelper(CacheHelper &&) = default;
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   void Exec(unsigned int slot, const ColTypes &... values)
+   {
+      if (!fIsSpilling[slot]) {
+         if (!fSharedState->fMustSpill) {
+            Push(slot, std::index_sequence_for<ColTypes...>(), values...);
+            return;
+         }
+         Spill(slot, std::index_sequence_for<ColTypes...>());
+      }
+      Write(slot, std::index_sequence_for<ColTypes...>(), values...);
+   }
+
+   void Initialize() {}
+
+   void Finalize()
+   {
+      auto nBytes = fSharedState->fNBytes.load();
+      for (auto n : fNBytes)
+         nBytes += n;
+      if (fSharedState->fMustSpill || nBytes > fMemoryBudget) {
+         for (unsigned int slot = 0; slot < fValues.size(); ++slot) {
+            if (!fIsSpilling[slot])
+               Spill(slot, std::index_sequence_for<ColTypes...>());
+         }
+         fWriter->Finalize();
+         fStore->fFileName = fWriter->GetFileName();
+      } else {
+         MoveToStore(std::index_sequence_for<ColTypes...>());
+      }
+      fValues.clear();
+      fEntries.clear();
+   }
+
+   std::string GetActionName() { return "Cache"; }
+};
+
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
 class AggregateHelper : public RActionImpl<AggregateHelper<Acc, Merge, R, T, U, MustCopyAssign>> {
@@ -75,6 +75,9 @@ HeadNode_t CreateSnapshotRDF(const ColumnNames_t &validCols,
                             RLoopManager &loopManager,
                             std::unique_ptr<RDFInternal::RActionBase> actionPtr);
 
+HeadNode_t CreateSnapshotRDF(const std::shared_ptr<ROOT::RDataFrame> &snapshotRDF, bool isLazy,
+                             RLoopManager &loopManager, std::unique_ptr<RDFInternal::RActionBase> actionPtr);
+
 std::string DemangleTypeIdName(const std::type_info &typeInfo);
 
 ColumnNames_t ConvertRegexToColumns(const RDFInternal::RBookedDefines &defines, TTree *tree,
@@ -234,6 +237,39 @@ std::unique_ptr<RActionBase> BuildAction(const ColumnNames_t &bl, const std::sha
    return std::make_unique<Action_t>(Helper_t(d, prevNode), bl, prevNode, std::move(defines));
 }
 
+// Attach to an action built by BuildAction a factory of its copies that process a systematic variation.
+// The varied results are copies of the nominal one, hence only actions with a copiable result support variations.
+template <typename... ColTypes, typename ActionTag, typename ActionResultType, typename PrevNodeType>
+void SetVariedActionFactory(RActionBase &action, const ColumnNames_t &bl, const std::shared_ptr<ActionResultType> &,
+                            const unsigned int nSlots, const std::shared_ptr<PrevNodeType> &prevNode, ActionTag,
+                            const RDFInternal::RBookedDefines &defines, std::true_type)
+{
+   action.SetVariedActionFactory(
+      [bl, nSlots, prevNode, defines](const std::string &variationName, const std::shared_ptr<void> &variedResult) {
+         return BuildAction<ColTypes...>(bl, std::static_pointer_cast<ActionResultType>(variedResult), nSlots,
+                                         GetVariedNode(prevNode, variationName), ActionTag{},
+                                         defines.GetVaried(variationName));
+      });
+}
+
+template <typename... ColTypes, typename ActionTag, typename ActionResultType, typename PrevNodeType>
+void SetVariedActionFactory(RActionBase &, const ColumnNames_t &, const std::shared_ptr<ActionResultType> &,
+                            const unsigned int, const std::shared_ptr<PrevNodeType> &, ActionTag,
+                            const RDFInternal::RBookedDefines &, std::false_type)
+{
+}
+
+template <typename... ColTypes, typename ActionTag, typename ActionResultType, typename PrevNodeType>
+void SetVariedActionFactory(RActionBase &action, const ColumnNames_t &bl, const std::shared_ptr<ActionResultType> &r,
+                            const unsigned int nSlots, const std::shared_ptr<PrevNodeType> &prevNode, ActionTag tag,
+                            const RDFInternal::RBookedDefines &defines)
+{
+   using SupportsVariations_t =
+      std::integral_constant<bool, std::is_copy_constructible<ActionResultType>::value &&
+                                      !std::is_same<ActionTag, ActionTags::Display>::value>;
+   SetVariedActionFactory<ColTypes...>(action, bl, r, nSlots, prevNode, tag, defines, SupportsVariations_t{});
+}
+
 /****** end BuildAndBook ******/
 
 template <typename Filter>
@@ -247,6 +283,8 @@ void CheckFilter(Filter &)
 void CheckDefine(std::string_view definedCol, TTree *treePtr, const ColumnNames_t &customCols,
                        const std::map<std::string, std::string> &aliasMap, const ColumnNames_t &dataSourceColumns);
 
+void CheckVariedType(const std::string &colName, const std::string &colTypeName, const std::type_info &variedType);
+
 std::string PrettyPrintAddr(const void *const addr);
 
 void BookFilterJit(const std::shared_ptr<RJittedFilter> &jittedFilter, std::shared_ptr<RNodeBase> *prevNodeOnHeap,
@@ -436,8 +474,8 @@ void CallBuildAction(std::shared_ptr<PrevNodeType> *prevNodeOnHeap, const Column
    if (ds != nullptr)
       RDFInternal::AddDSColumns(cols, loopManager, *ds, ColTypes_t());
 
-   auto actionPtr = BuildAction<ColTypes...>(cols, std::move(rOnHeap), nSlots, std::move(prevNodePtr), ActionTag{},
-                                                *defines);
+   auto actionPtr = BuildAction<ColTypes...>(cols, rOnHeap, nSlots, prevNodePtr, ActionTag{}, *defines);
+   SetVariedActionFactory<ColTypes...>(*actionPtr, cols, rOnHeap, nSlots, prevNodePtr, ActionTag{}, *defines);
    jittedActionOnHeap->SetAction(std::move(actionPtr));
 
    // defines points to the columns structure in the heap, created before the jitted call so that the jitter can
@@ -14,6 +14,7 @@
 #include "ROOT/RDF/ColumnReaderUtils.hxx"
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RBulkColumn.hxx"
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t, IsInternalColumn
 #include "ROOT/RDF/RLoopManager.hxx"
@@ -21,6 +22,7 @@
 #include <array>
 #include <cstddef> // std::size_t
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -59,10 +61,14 @@ class RAction : public RActionBase {
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
 
+   /// Bulk mode: input column values per slot
+   std::vector<RBulkColumnReaders<ColumnTypes_t>> fBulkValues;
+
 public:
    RAction(Helper &&h, const ColumnNames_t &columns, std::shared_ptr<PrevDataFrame> pd, const RBookedDefines &defines)
       : RActionBase(pd->GetLoopManagerUnchecked(), columns, defines), fHelper(std::forward<Helper>(h)),
-        fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr), fValues(GetNSlots()), fIsDefine()
+        fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr), fValues(GetNSlots()), fIsDefine(),
+        fBulkValues(GetNSlots())
    {
       const auto nColumns = columns.size();
       const auto &customCols = GetDefines();
@@ -94,6 +100,11 @@ public:
       RDFInternal::RColumnReadersInfo info{RActionBase::GetColumnNames(), RActionBase::GetDefines(), fIsDefine.data(),
                                            fLoopManager->GetDSValuePtrs()};
       fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
+      if (fLoopManager->GetBulkSize() > 0) {
+         if (!Helper::fgSupportsBulk)
+            throw std::runtime_error("The " + fHelper.GetActionName() + " action cannot be run in bulk mode.");
+         fBulkValues[slot].Init(slot, fValues[slot], info, *fLoopManager);
+      }
       fHelper.InitTask(r, slot);
    }
 
@@ -111,8 +122,30 @@ public:
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
    }
 
+   template <typename... ColTypes, std::size_t... S>
+   void CallExecBulk(unsigned int slot, const REntryBulk &bulk, const char *mask, TypeList<ColTypes...>,
+                     std::index_sequence<S...>)
+   {
+      const auto values = fBulkValues[slot].GetValues();
+      for (std::size_t i = 0; i < bulk.fSize; ++i)
+         if (mask[i])
+            fHelper.Exec(slot, std::get<S>(values)[i]...);
+   }
+
+   void RunBulk(unsigned int slot, const REntryBulk &bulk) final
+   {
+      const char *mask = fPrevData.CheckFiltersBulk(slot, bulk);
+      fBulkValues[slot].Update(slot, bulk, mask);
+      CallExecBulk(slot, bulk, mask, ColumnTypes_t{}, TypeInd_t{});
+   }
+
    void TriggerChildrenCount() final { fPrevData.IncrChildrenCount(); }
 
+   std::vector<std::string> GetVariations() const final
+   {
+      return RDFInternal::Union(fPrevData.GetVariations(), GetDefines().GetVariationDeps(GetColumnNames()));
+   }
+
    /// Clean-up operations to be performed at the end of a task.
    void FinalizeSlot(unsigned int slot) final
    {
@@ -120,6 +153,7 @@ public:
          column.second->FinaliseSlot(slot);
       for (auto &v : fValues[slot])
          v.reset();
+      fBulkValues[slot].Reset();
       fHelper.CallFinalizeTask(slot);
    }
 
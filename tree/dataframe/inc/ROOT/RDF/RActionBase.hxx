@@ -15,8 +15,10 @@
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace ROOT {
 
@@ -33,10 +35,16 @@ namespace RDF {
 namespace GraphDrawing {
 class GraphNode;
 }
+struct REntryBulk;
 
 using namespace ROOT::Detail::RDF;
 
 class RActionBase {
+public:
+   /// Creates a copy of an action that processes the given variation and fills the given result, see MakeVariedAction()
+   using VariedActionFactory_t =
+      std::function<std::unique_ptr<RActionBase>(const std::string &, const std::shared_ptr<void> &)>;
+
 protected:
    /// A raw pointer to the RLoopManager at the root of this functional graph.
    /// Never null: children nodes have shared ownership of parent nodes in the graph.
@@ -49,6 +57,8 @@ private:
 
    RBookedDefines fDefines;
 
+   VariedActionFactory_t fVariedActionFactory;
+
 public:
    RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const RBookedDefines &defines);
    RActionBase(const RActionBase &) = delete;
@@ -57,9 +67,12 @@ public:
 
    const ColumnNames_t &GetColumnNames() const { return fColumnNames; }
    RBookedDefines &GetDefines() { return fDefines; }
+   const RBookedDefines &GetDefines() const { return fDefines; }
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
+   /// Bulk mode counterpart of Run, see RLoopManager::SetBulkSize()
+   virtual void RunBulk(unsigned int slot, const REntryBulk &bulk) = 0;
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
@@ -80,6 +93,16 @@ public:
       with others of the same type.
    */
    virtual std::unique_ptr<RMergeableValueBase> GetMergeableValue() const = 0;
+
+   /// Return the names of the variations, in the form "variation:tag", that affect the result of this action.
+   virtual std::vector<std::string> GetVariations() const = 0;
+
+   void SetVariedActionFactory(VariedActionFactory_t factory) { fVariedActionFactory = std::move(factory); }
+
+   /// Return a new action, to be booked in the same event loop, that fills `variedResult` reading the values of the
+   /// given variation. `variedResult` must point to an object of the result type of this action.
+   virtual std::unique_ptr<RActionBase>
+   MakeVariedAction(const std::string &variationName, const std::shared_ptr<void> &variedResult);
 };
 } // namespace RDF
 } // namespace Internal
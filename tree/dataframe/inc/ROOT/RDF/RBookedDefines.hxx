@@ -22,6 +22,7 @@ namespace ROOT {
 namespace Detail {
 namespace RDF {
 class RDefineBase;
+class RVariationBase;
 }
 }
 
@@ -34,19 +35,25 @@ namespace RDFDetail = ROOT::Detail::RDF;
  * \class ROOT::Internal::RDF::RBookedDefines
  * \ingroup dataframe
  * \brief Encapsulates the columns defined by the user
+ *
+ * Besides the defined columns, it also tracks the systematic variations registered with Vary(): for each varied column,
+ * the node that computes its alternative values.
  */
 
 class RBookedDefines {
    using RDefineBasePtrMap_t = std::map<std::string, std::shared_ptr<RDFDetail::RDefineBase>>;
    using ColumnNames_t = std::vector<std::string>;
+   using RVariationBasePtrMap_t = std::map<std::string, std::shared_ptr<RDFDetail::RVariationBase>>;
 
    // Since RBookedDefines is meant to be an immutable, copy-on-write object, the actual values are set as const
    using RDefineBasePtrMapPtr_t = std::shared_ptr<const RDefineBasePtrMap_t>;
    using ColumnNamesPtr_t = std::shared_ptr<const ColumnNames_t>;
+   using RVariationBasePtrMapPtr_t = std::shared_ptr<const RVariationBasePtrMap_t>;
 
 private:
    RDefineBasePtrMapPtr_t fDefines;
    ColumnNamesPtr_t fDefinesNames;
+   RVariationBasePtrMapPtr_t fVariations; ///< Varied columns and the corresponding variation nodes
 
 public:
    ////////////////////////////////////////////////////////////////////////////
@@ -63,8 +70,9 @@ public:
 
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates the object starting from the provided maps
-   RBookedDefines(RDefineBasePtrMapPtr_t defines, ColumnNamesPtr_t defineNames)
-      : fDefines(defines), fDefinesNames(defineNames)
+   RBookedDefines(RDefineBasePtrMapPtr_t defines, ColumnNamesPtr_t defineNames,
+                  RVariationBasePtrMapPtr_t variations = std::make_shared<RVariationBasePtrMap_t>())
+      : fDefines(defines), fDefinesNames(defineNames), fVariations(variations)
    {
    }
 
@@ -72,7 +80,8 @@ public:
    /// \brief Creates a new wrapper with empty maps
    RBookedDefines()
       : fDefines(std::make_shared<RDefineBasePtrMap_t>()),
-        fDefinesNames(std::make_shared<ColumnNames_t>())
+        fDefinesNames(std::make_shared<ColumnNames_t>()),
+        fVariations(std::make_shared<RVariationBasePtrMap_t>())
    {
    }
 
@@ -95,6 +104,22 @@ public:
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Internally it recreates the map with the new column name, and swaps with the old one.
    void AddName(std::string_view name);
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the map of the varied columns to the nodes computing their variations
+   const RVariationBasePtrMap_t &GetVariations() const { return *fVariations; }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Internally it recreates the map of variations with the new one, and swaps with the old one.
+   void AddVariation(const std::shared_ptr<RDFDetail::RVariationBase> &variation);
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the names of the variations, in the form "variation:tag", that affect the given columns
+   ColumnNames_t GetVariationDeps(const ColumnNames_t &columns) const;
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns a copy in which the columns affected by the given variation are replaced by their varied values
+   RBookedDefines GetVaried(const std::string &variationName) const;
 };
 
 } // Namespace RDF
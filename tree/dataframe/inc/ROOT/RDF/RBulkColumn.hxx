@@ -0,0 +1,196 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RBULKCOLUMN
+#define ROOT_RDF_RBULKCOLUMN
+
+#include "ROOT/RDF/ColumnReaderUtils.hxx"
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/Utils.hxx" // TypeID2TypeName
+#include "ROOT/TypeTraits.hxx"
+#include "Rtypes.h" // Long64_t, R__CLING_PTRCHECK
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+namespace RDFDetail = ROOT::Detail::RDF;
+
+/// The entries that the nodes of the computation graph process together in bulk mode, see
+/// RLoopManager::SetBulkSize(). The nodes receive the same entry numbers as they would one at a time.
+struct REntryBulk {
+   const Long64_t *fEntries; ///< The entry numbers, in processing order
+   std::size_t fSize;        ///< The number of entries in the bulk, at most the bulk size
+
+   /// Identifies the bulk among the bulks that a processing slot processes during an event loop
+   Long64_t GetId() const { return fEntries[0]; }
+};
+
+/// Whether values of type T can be stored in the arrays that the nodes exchange in bulk mode
+template <typename T>
+using IsBulkCompatible_t =
+   std::integral_constant<bool, std::is_default_constructible<T>::value && std::is_copy_assignable<T>::value>;
+
+/// The values of an input column for the entries of a bulk, shared by all the nodes that read the column in a
+/// processing slot. Column readers only return the value of the current entry of the data source, hence values are
+/// loaded by the event loop after moving the data source to their entry, see RLoopManager::LoadBulkColumns().
+class RBulkColumnBase {
+   const std::string fColName;
+   /// Per entry of the current bulk, whether its value was loaded
+   std::vector<char> fIsLoaded;
+
+public:
+   RBulkColumnBase(const std::string &colName, std::size_t bulkSize) : fColName(colName), fIsLoaded(bulkSize, 0) {}
+   virtual ~RBulkColumnBase() = default;
+   /// Copy the value of the given entry, which must be the current entry of the data source, to position idx
+   virtual void Load(std::size_t idx, Long64_t entry) = 0;
+   virtual const std::type_info &GetTypeId() const = 0;
+   const std::string &GetColumnName() const { return fColName; }
+   bool IsLoaded(std::size_t idx) const { return fIsLoaded[idx] != 0; }
+   void SetLoaded(std::size_t idx) { fIsLoaded[idx] = 1; }
+   /// Forget the values of the current bulk
+   void ResetLoaded() { std::fill(fIsLoaded.begin(), fIsLoaded.end(), 0); }
+};
+
+template <typename T>
+class R__CLING_PTRCHECK(off) RBulkColumn final : public RBulkColumnBase {
+   std::unique_ptr<RColumnReaderBase> fReader;
+   std::unique_ptr<T[]> fValues;
+
+public:
+   RBulkColumn(const std::string &colName, std::unique_ptr<RColumnReaderBase> reader, std::size_t bulkSize)
+      : RBulkColumnBase(colName, bulkSize), fReader(std::move(reader)), fValues(new T[bulkSize])
+   {
+   }
+
+   void Load(std::size_t idx, Long64_t entry) final { fValues[idx] = fReader->template Get<T>(entry); }
+
+   const std::type_info &GetTypeId() const final { return typeid(T); }
+
+   T *GetValues() { return fValues.get(); }
+};
+
+/// Return the values of the column in the given slot, creating the column with the given reader if no other node of
+/// the computation graph reads it with the same type.
+template <typename T>
+T *GetBulkColumnValues(RBulkColumnBase *&column, unsigned int slot, std::unique_ptr<RColumnReaderBase> &reader,
+                       const std::string &colName, RDFDetail::RLoopManager &lm, std::true_type)
+{
+   column = lm.GetBulkColumn(slot, colName, typeid(T));
+   if (column == nullptr)
+      column = lm.AddBulkColumn(
+         slot, std::unique_ptr<RBulkColumnBase>(new RBulkColumn<T>(colName, std::move(reader), lm.GetBulkSize())));
+   return static_cast<RBulkColumn<T> *>(column)->GetValues();
+}
+
+template <typename T>
+T *GetBulkColumnValues(RBulkColumnBase *&, unsigned int, std::unique_ptr<RColumnReaderBase> &,
+                       const std::string &colName, RDFDetail::RLoopManager &, std::false_type)
+{
+   throw std::runtime_error("Column \"" + colName + "\" of type " + TypeID2TypeName(typeid(T)) +
+                            " cannot be processed in bulk mode: its type must be default-constructible and "
+                            "copy-assignable.");
+}
+
+template <typename ColTypeList>
+class RBulkColumnReaders;
+
+/// The input columns of a node in bulk mode, for one processing slot.
+/// For each column, it provides the array that holds the values of the entries of the current bulk. The values of
+/// defined columns are computed on demand by Update(), those of the other columns are loaded on demand by the event
+/// loop into arrays that are shared by all the nodes that read them.
+template <typename... ColTypes>
+class RBulkColumnReaders<ROOT::TypeTraits::TypeList<ColTypes...>> {
+   static constexpr std::size_t kNColumns = sizeof...(ColTypes);
+
+   std::tuple<ColTypes *...> fValues;
+   /// Non-null for defined columns
+   std::array<RDFDetail::RDefineBase *, kNColumns> fDefines{};
+   /// Non-null for the other columns, owned by the loop manager
+   std::array<RBulkColumnBase *, kNColumns> fColumns{};
+   RDFDetail::RLoopManager *fLoopManager = nullptr;
+
+   template <std::size_t I, typename T>
+   int InitColumn(unsigned int slot, std::unique_ptr<RColumnReaderBase> &reader, const RColumnReadersInfo &colInfo,
+                  RDFDetail::RLoopManager &lm)
+   {
+      const auto &colName = colInfo.fColNames[I];
+      if (colInfo.fIsDefine[I]) {
+         auto define = colInfo.fCustomCols.GetColumns().at(colName).get();
+         define->InitBulkSlot(slot, lm);
+         fDefines[I] = define;
+         std::get<I>(fValues) = static_cast<T *>(define->GetBulkValuePtr(slot));
+      } else {
+         std::get<I>(fValues) =
+            GetBulkColumnValues<T>(fColumns[I], slot, reader, colName, lm, IsBulkCompatible_t<T>{});
+      }
+      return 0;
+   }
+
+   template <std::size_t... S>
+   void InitImpl(unsigned int slot, std::array<std::unique_ptr<RColumnReaderBase>, kNColumns> &readers,
+                 const RColumnReadersInfo &colInfo, RDFDetail::RLoopManager &lm, std::index_sequence<S...>)
+   {
+      int expander[] = {0, InitColumn<S, ColTypes>(slot, readers[S], colInfo, lm)...};
+      (void)expander;
+      // avoid "unused parameter" warnings for nodes without input columns
+      (void)slot;
+      (void)readers;
+      (void)colInfo;
+   }
+
+public:
+   /// Set up the arrays of values. The column readers of the non-defined columns that no other node reads yet are
+   /// taken over by the loop manager, which then uses them to load the values.
+   void Init(unsigned int slot, std::array<std::unique_ptr<RColumnReaderBase>, kNColumns> &readers,
+             const RColumnReadersInfo &colInfo, RDFDetail::RLoopManager &lm)
+   {
+      fLoopManager = &lm;
+      InitImpl(slot, readers, colInfo, lm, std::make_index_sequence<kNColumns>{});
+   }
+
+   /// Load or compute the values of the columns for the entries of the bulk selected by the mask.
+   void Update(unsigned int slot, const REntryBulk &bulk, const char *mask)
+   {
+      fLoopManager->LoadBulkColumns(slot, bulk, mask, fColumns.data(), kNColumns);
+      for (auto define : fDefines)
+         if (define != nullptr)
+            define->UpdateBulk(slot, bulk, mask);
+   }
+
+   /// Return the addresses of the arrays of values, one per input column
+   std::tuple<ColTypes *...> GetValues() const { return fValues; }
+
+   void Reset()
+   {
+      fDefines.fill(nullptr);
+      fColumns.fill(nullptr);
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RBULKCOLUMN
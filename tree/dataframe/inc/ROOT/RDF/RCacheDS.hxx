@@ -0,0 +1,212 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RCACHEDS
+#define ROOT_RDF_RCACHEDS
+
+#include "ROOT/RDataSource.hxx"
+#include "ROOT/RDF/RNTupleCacheReader.hxx"
+#include "ROOT/RDF/Utils.hxx" // TypeID2TypeName
+#include "ROOT/RIntegerSequence.hxx"
+#include "ROOT/RResultPtr.hxx"
+#include "RtypesCore.h"
+#include "TSystem.h"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// The columns cached by Cache with a memory budget, see RCacheOptions::fMemoryBudget: either in memory, or spilled
+/// to an RNTuple in a scratch file.
+template <typename... ColTypes>
+struct RCacheStore {
+   /// The cached values, if they were not spilled
+   std::tuple<std::vector<ColTypes>...> fValues;
+   /// The fields of the ntuple in the scratch file, one per column
+   std::vector<std::string> fFieldNames;
+   /// The scratch file, if the values were spilled; removed together with the store
+   std::string fFileName;
+
+   RCacheStore() = default;
+   RCacheStore(const RCacheStore &) = delete;
+   RCacheStore &operator=(const RCacheStore &) = delete;
+   ~RCacheStore()
+   {
+      if (!fFileName.empty())
+         gSystem->Unlink(fFileName.c_str());
+   }
+
+   static const char *GetNTupleName() { return "cache"; }
+};
+
+/// The data source of the RDataFrame returned by Cache with a memory budget.
+/// It serves the values of the store, which the event loop of the originating RDataFrame fills the first time the
+/// data source is initialised. Values in memory are read in place, spilled values are read back from the scratch file
+/// entry by entry.
+template <typename... ColTypes>
+class RCacheDS final : public ROOT::RDF::RDataSource {
+   ROOT::RDF::RResultPtr<RCacheStore<ColTypes...>> fStore;
+   const std::vector<std::string> fColNames;
+   const std::vector<std::string> fColTypeNames;
+   /// Set by Initialise(), once the store has been filled
+   RCacheStore<ColTypes...> *fStorePtr = nullptr;
+   /// Created by Initialise() if the values were spilled
+   std::unique_ptr<RNTupleCacheReader> fReader;
+   /// Per slot, the values of the current entry, if they are not read in place
+   std::vector<std::tuple<ColTypes...>> fValues;
+   /// Per slot, per column, the address of the value of the current entry
+   std::vector<std::vector<void *>> fValuePtrs;
+   std::vector<std::pair<ULong64_t, ULong64_t>> fEntryRanges;
+   unsigned int fNSlots = 0;
+
+   template <std::size_t... S>
+   std::vector<void *> GetValueAddresses(unsigned int slot, std::index_sequence<S...>)
+   {
+      return {static_cast<void *>(&std::get<S>(fValues[slot]))...};
+   }
+
+   /// Point the column readers at the value of the entry in the store
+   template <std::size_t S>
+   int SetValuePtr(unsigned int slot, ULong64_t entry, std::false_type /*isBool*/)
+   {
+      fValuePtrs[slot][S] = &std::get<S>(fStorePtr->fValues)[entry];
+      return 0;
+   }
+
+   /// std::vector<bool> does not store bools that could be pointed at: the value is copied
+   template <std::size_t S>
+   int SetValuePtr(unsigned int slot, ULong64_t entry, std::true_type /*isBool*/)
+   {
+      std::get<S>(fValues[slot]) = std::get<S>(fStorePtr->fValues)[entry];
+      return 0;
+   }
+
+   template <std::size_t... S>
+   void SetValuePtrs(unsigned int slot, ULong64_t entry, std::index_sequence<S...>)
+   {
+      int expander[] = {SetValuePtr<S>(slot, entry, std::is_same<ColTypes, bool>())...};
+      (void)expander;
+   }
+
+protected:
+   Record_t GetColumnReadersImpl(std::string_view colName, const std::type_info &id) final
+   {
+      const auto it = std::find(fColNames.begin(), fColNames.end(), colName);
+      if (it == fColNames.end())
+         throw std::runtime_error("The specified column name, \"" + std::string(colName) +
+                                  "\" is not known to the data source.");
+      const auto colIdx = std::distance(fColNames.begin(), it);
+      const auto idName = TypeID2TypeName(id);
+      if (idName != fColTypeNames[colIdx])
+         throw std::runtime_error("Column " + std::string(colName) + " has type " + fColTypeNames[colIdx] +
+                                  " while the id specified is associated to type " + idName);
+
+      Record_t ret(fNSlots);
+      for (unsigned int slot = 0; slot < fNSlots; ++slot)
+         ret[slot] = &fValuePtrs[slot][colIdx];
+      return ret;
+   }
+
+   std::string AsString() final { return "cache data source"; }
+
+public:
+   RCacheDS(const ROOT::RDF::RResultPtr<RCacheStore<ColTypes...>> &store, const std::vector<std::string> &colNames)
+      : fStore(store), fColNames(colNames), fColTypeNames({TypeID2TypeName(typeid(ColTypes))...})
+   {
+   }
+
+   const std::vector<std::string> &GetColumnNames() const final { return fColNames; }
+
+   bool HasColumn(std::string_view colName) const final
+   {
+      return std::find(fColNames.begin(), fColNames.end(), colName) != fColNames.end();
+   }
+
+   std::string GetTypeName(std::string_view colName) const final
+   {
+      const auto it = std::find(fColNames.begin(), fColNames.end(), colName);
+      return fColTypeNames.at(std::distance(fColNames.begin(), it));
+   }
+
+   void SetNSlots(unsigned int nSlots) final
+   {
+      fNSlots = nSlots;
+      fValues.resize(fNSlots);
+      for (unsigned int slot = 0; slot < fNSlots; ++slot)
+         fValuePtrs.emplace_back(GetValueAddresses(slot, std::index_sequence_for<ColTypes...>()));
+   }
+
+   void Initialise() final
+   {
+      // runs the event loop that fills the store, if it has not run yet
+      fStorePtr = fStore.GetPtr();
+      ULong64_t nEntries = 0;
+      if (fStorePtr->fFileName.empty()) {
+         nEntries = std::get<0>(fStorePtr->fValues).size();
+      } else {
+         if (!fReader) {
+            fReader.reset(new RNTupleCacheReader(fNSlots, fStorePtr->fFileName, fStorePtr->GetNTupleName(),
+                                                 fStorePtr->fFieldNames, fColTypeNames));
+            for (unsigned int slot = 0; slot < fNSlots; ++slot)
+               fReader->Connect(slot, fValuePtrs[slot]);
+         }
+         nEntries = fReader->GetNEntries();
+      }
+
+      // the same partitioning as RLazyDS
+      const auto nEntriesInRange = nEntries / fNSlots;
+      auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
+      fEntryRanges.resize(fNSlots);
+      auto init = 0ULL;
+      for (auto &range : fEntryRanges) {
+         auto end = init + nEntriesInRange;
+         if (0 != reminder) {
+            reminder--;
+            end += 1;
+         }
+         range = {init, end};
+         init = end;
+      }
+   }
+
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final
+   {
+      auto entryRanges(std::move(fEntryRanges)); // empty fEntryRanges
+      fEntryRanges.clear();
+      return entryRanges;
+   }
+
+   bool SetEntry(unsigned int slot, ULong64_t entry) final
+   {
+      if (fReader)
+         fReader->Read(slot, entry);
+      else
+         SetValuePtrs(slot, entry, std::index_sequence_for<ColTypes...>());
+      return true;
+   }
+
+   std::string GetLabel() final { return "CacheDS"; }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RCACHEDS
@@ -12,6 +12,7 @@
 #define ROOT_RCUSTOMCOLUMN
 
 #include "ROOT/RDF/ColumnReaderUtils.hxx"
+#include "ROOT/RDF/RBulkColumn.hxx"
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/Utils.hxx"
@@ -20,8 +21,12 @@
 #include "ROOT/TypeTraits.hxx"
 #include "RtypesCore.h"
 
+#include <algorithm>
 #include <array>
 #include <deque>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -69,6 +74,16 @@ class RDefine final : public RDefineBase {
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
 
+   /// Bulk mode: per slot, the values of the entries of the current bulk; null if the slot is not in bulk mode
+   std::vector<std::unique_ptr<ret_type[]>> fBulkResults;
+   /// Bulk mode: per slot, the entries of the current bulk whose values are already computed
+   std::vector<std::vector<char>> fBulkDone;
+   /// Bulk mode: per slot, the entries of the current bulk whose values are being computed
+   std::vector<std::vector<char>> fBulkMasks;
+   std::vector<Long64_t> fLastCheckedBulk;
+   /// Bulk mode: input column values per slot
+   std::vector<RDFInternal::RBulkColumnReaders<ColumnTypes_t>> fBulkValues;
+
    template <typename... ColTypes, std::size_t... S>
    void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
    {
@@ -97,12 +112,100 @@ class RDefine final : public RDefineBase {
       (void)entry;
    }
 
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateBulkHelper(unsigned int slot, const RDFInternal::REntryBulk &bulk, const char *mask,
+                         TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
+   {
+      const auto values = fBulkValues[slot].GetValues();
+      auto results = fBulkResults[slot].get();
+      for (std::size_t i = 0; i < bulk.fSize; ++i)
+         if (mask[i])
+            results[i] = fExpression(std::get<S>(values)[i]...);
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateBulkHelper(unsigned int slot, const RDFInternal::REntryBulk &bulk, const char *mask,
+                         TypeList<ColTypes...>, std::index_sequence<S...>, SlotTag)
+   {
+      const auto values = fBulkValues[slot].GetValues();
+      auto results = fBulkResults[slot].get();
+      for (std::size_t i = 0; i < bulk.fSize; ++i)
+         if (mask[i])
+            results[i] = fExpression(slot, std::get<S>(values)[i]...);
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateBulkHelper(unsigned int slot, const RDFInternal::REntryBulk &bulk, const char *mask,
+                         TypeList<ColTypes...>, std::index_sequence<S...>, SlotAndEntryTag)
+   {
+      const auto values = fBulkValues[slot].GetValues();
+      auto results = fBulkResults[slot].get();
+      for (std::size_t i = 0; i < bulk.fSize; ++i)
+         if (mask[i])
+            results[i] = fExpression(slot, bulk.fEntries[i], std::get<S>(values)[i]...);
+   }
+
+   void InitBulkSlotImpl(unsigned int slot, RLoopManager &lm, std::true_type)
+   {
+      const auto bulkSize = lm.GetBulkSize();
+      fBulkResults[slot].reset(new ret_type[bulkSize]);
+      fBulkDone[slot].assign(bulkSize, 0);
+      fBulkMasks[slot].assign(bulkSize, 0);
+      fLastCheckedBulk[slot] = -1;
+      RDFInternal::RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fDSValuePtrs};
+      fBulkValues[slot].Init(slot, fValues[slot], info, lm);
+   }
+
+   void InitBulkSlotImpl(unsigned int, RLoopManager &, std::false_type)
+   {
+      throw std::runtime_error("Column \"" + fName + "\" of type " + fType +
+                               " cannot be processed in bulk mode: its type must be default-constructible and "
+                               "copy-assignable.");
+   }
+
+   void UpdateBulkImpl(unsigned int slot, const RDFInternal::REntryBulk &bulk, const char *mask, std::true_type)
+   {
+      auto &done = fBulkDone[slot];
+      if (bulk.GetId() != fLastCheckedBulk[slot]) {
+         std::fill(done.begin(), done.end(), 0);
+         fLastCheckedBulk[slot] = bulk.GetId();
+      }
+      // only compute the values that were not requested by other nodes already
+      auto &todo = fBulkMasks[slot];
+      bool anyTodo = false;
+      for (std::size_t i = 0; i < bulk.fSize; ++i) {
+         todo[i] = mask[i] && !done[i];
+         anyTodo |= todo[i];
+      }
+      if (!anyTodo)
+         return;
+      fBulkValues[slot].Update(slot, bulk, todo.data());
+      UpdateBulkHelper(slot, bulk, todo.data(), ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+      for (std::size_t i = 0; i < bulk.fSize; ++i)
+         done[i] |= todo[i];
+   }
+
+   void UpdateBulkImpl(unsigned int, const RDFInternal::REntryBulk &, const char *, std::false_type) {}
+
+   std::shared_ptr<RDefineBase> MakeVariedDefine(const std::string &variationName, std::true_type)
+   {
+      return std::make_shared<RDefine>(fName, fType, fExpression, fColumnNames, fNSlots,
+                                       fDefines.GetVaried(variationName), fDSValuePtrs);
+   }
+
+   std::shared_ptr<RDefineBase> MakeVariedDefine(const std::string &, std::false_type)
+   {
+      throw std::runtime_error("The expression of column \"" + fName +
+                               "\" cannot be copied, hence it cannot be evaluated for systematic variations.");
+   }
+
 public:
    RDefine(std::string_view name, std::string_view type, F expression, const ColumnNames_t &columns,
                  unsigned int nSlots, const RDFInternal::RBookedDefines &defines,
                  const std::map<std::string, std::vector<void *>> &DSValuePtrs)
       : RDefineBase(name, type, nSlots, defines, DSValuePtrs), fExpression(std::move(expression)),
-        fColumnNames(columns), fLastResults(fNSlots), fValues(fNSlots), fIsDefine()
+        fColumnNames(columns), fLastResults(fNSlots), fValues(fNSlots), fIsDefine(), fBulkResults(fNSlots),
+        fBulkDone(fNSlots), fBulkMasks(fNSlots), fLastCheckedBulk(fNSlots, -1), fBulkValues(fNSlots)
    {
       const auto nColumns = fColumnNames.size();
       for (auto i = 0u; i < nColumns; ++i)
@@ -137,12 +240,38 @@ public:
 
    const std::type_info &GetTypeId() const { return typeid(ret_type); }
 
+   std::vector<std::string> GetVariations() const final { return fDefines.GetVariationDeps(fColumnNames); }
+
+   std::shared_ptr<RDefineBase> GetVariedDefine(const std::string &variationName) final
+   {
+      auto &variedDefine = fVariedDefines[variationName];
+      if (!variedDefine)
+         variedDefine = MakeVariedDefine(variationName, std::is_copy_constructible<F>{});
+      return variedDefine;
+   }
+
+   void InitBulkSlot(unsigned int slot, RLoopManager &lm) final
+   {
+      if (!fBulkResults[slot])
+         InitBulkSlotImpl(slot, lm, RDFInternal::IsBulkCompatible_t<ret_type>{});
+   }
+
+   /// Return the (type-erased) address of the array of values of the current bulk for the given processing slot.
+   void *GetBulkValuePtr(unsigned int slot) final { return static_cast<void *>(fBulkResults[slot].get()); }
+
+   void UpdateBulk(unsigned int slot, const RDFInternal::REntryBulk &bulk, const char *mask) final
+   {
+      UpdateBulkImpl(slot, bulk, mask, RDFInternal::IsBulkCompatible_t<ret_type>{});
+   }
+
    /// Clean-up operations to be performed at the end of a task.
    void FinaliseSlot(unsigned int slot) final
    {
       if (fIsInitialized[slot]) {
          for (auto &v : fValues[slot])
             v.reset();
+         fBulkValues[slot].Reset();
+         fBulkResults[slot].reset();
          fIsInitialized[slot] = false;
       }
    }
@@ -23,11 +23,19 @@
 class TTreeReader;
 
 namespace ROOT {
+namespace Internal {
+namespace RDF {
+struct REntryBulk;
+}
+} // namespace Internal
+
 namespace Detail {
 namespace RDF {
 
 namespace RDFInternal = ROOT::Internal::RDF;
 
+class RLoopManager;
+
 class RDefineBase {
 protected:
    const std::string fName; ///< The name of the custom column
@@ -42,6 +50,8 @@ protected:
    RDFInternal::RBookedDefines fDefines;
    std::deque<bool> fIsInitialized; // because vector<bool> is not thread-safe
    const std::map<std::string, std::vector<void *>> &fDSValuePtrs; // reference to RLoopManager's data member
+   /// Clones of this column that read the values of a systematic variation, by variation name
+   std::map<std::string, std::shared_ptr<RDefineBase>> fVariedDefines;
 
    static unsigned int GetNextID();
 
@@ -65,6 +75,18 @@ public:
    virtual void FinaliseSlot(unsigned int slot) = 0;
    /// Return the unique identifier of this RDefineBase.
    unsigned int GetID() const { return fID; }
+   /// Return the names of the variations, in the form "variation:tag", that affect the values of this column.
+   virtual std::vector<std::string> GetVariations() const { return {}; }
+   /// Return a clone of this column that reads the values of the given variation for its varied input columns.
+   virtual std::shared_ptr<RDefineBase> GetVariedDefine(const std::string &variationName);
+
+   /// Prepare the given processing slot for bulk mode, see RLoopManager::SetBulkSize(). Called after InitSlot.
+   /// Throws if the values of this column cannot be computed in bulk.
+   virtual void InitBulkSlot(unsigned int slot, RLoopManager &lm);
+   /// Return the (type-erased) address of the array that holds the values of the current bulk for the given slot.
+   virtual void *GetBulkValuePtr(unsigned int slot);
+   /// Compute the values of the entries of the bulk that are selected by the mask, unless already computed.
+   virtual void UpdateBulk(unsigned int slot, const RDFInternal::REntryBulk &bulk, const char *mask);
 };
 
 } // ns RDF
@@ -12,6 +12,7 @@
 #define ROOT_RFILTER
 
 #include "ROOT/RDF/ColumnReaderUtils.hxx"
+#include "ROOT/RDF/RBulkColumn.hxx"
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RCutFlowReport.hxx"
 #include "ROOT/RDF/Utils.hxx"
@@ -23,7 +24,9 @@
 
 #include <algorithm>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace ROOT {
@@ -61,13 +64,33 @@ class RFilter final : public RFilterBase {
    std::vector<std::array<std::unique_ptr<RDFInternal::RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
+   /// Bulk mode: per slot, the entries of the current bulk that pass this filter and the filters upstream
+   std::vector<std::vector<char>> fBulkMasks;
+   std::vector<Long64_t> fLastCheckedBulk;
+   /// Bulk mode: input column values per slot
+   std::vector<RDFInternal::RBulkColumnReaders<ColumnTypes_t>> fBulkValues;
+
+   std::shared_ptr<RNodeBase> MakeVariedFilter(const std::string &variationName, std::true_type)
+   {
+      // varied filters do not contribute to the cut-flow report, hence they are not named
+      auto filter = std::make_shared<RFilter<FilterF, RNodeBase>>(
+         fFilter, fColumnNames, GetVariedNode(fPrevDataPtr, variationName), fDefines.GetVaried(variationName));
+      fLoopManager->Book(filter.get());
+      return filter;
+   }
+
+   std::shared_ptr<RNodeBase> MakeVariedFilter(const std::string &, std::false_type)
+   {
+      throw std::runtime_error("The expression of filter \"" + fName +
+                               "\" cannot be copied, hence it cannot be evaluated for systematic variations.");
+   }
 
 public:
    RFilter(FilterF f, const ColumnNames_t &columns, std::shared_ptr<PrevDataFrame> pd,
            const RDFInternal::RBookedDefines &defines, std::string_view name = "")
       : RFilterBase(pd->GetLoopManagerUnchecked(), name, pd->GetLoopManagerUnchecked()->GetNSlots(), defines),
         fFilter(std::move(f)), fColumnNames(columns), fPrevDataPtr(std::move(pd)), fPrevData(*fPrevDataPtr),
-        fValues(fNSlots), fIsDefine()
+        fValues(fNSlots), fIsDefine(), fBulkMasks(fNSlots), fLastCheckedBulk(fNSlots, -1), fBulkValues(fNSlots)
    {
       const auto nColumns = fColumnNames.size();
       for (auto i = 0u; i < nColumns; ++i)
@@ -106,12 +129,47 @@ public:
       return fFilter(fValues[slot][S]->template Get<ColTypes>(entry)...);
    }
 
+   const char *CheckFiltersBulk(unsigned int slot, const RDFInternal::REntryBulk &bulk) final
+   {
+      auto &mask = fBulkMasks[slot];
+      if (bulk.GetId() != fLastCheckedBulk[slot]) {
+         const char *prevMask = fPrevData.CheckFiltersBulk(slot, bulk);
+         fBulkValues[slot].Update(slot, bulk, prevMask);
+         CheckFilterBulkHelper(slot, bulk, prevMask, ColumnTypes_t{}, TypeInd_t{});
+         fLastCheckedBulk[slot] = bulk.GetId();
+      }
+      return mask.data();
+   }
+
+   template <typename... ColTypes, std::size_t... S>
+   void CheckFilterBulkHelper(unsigned int slot, const RDFInternal::REntryBulk &bulk, const char *prevMask,
+                              TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      const auto values = fBulkValues[slot].GetValues();
+      auto mask = fBulkMasks[slot].data();
+      ULong64_t nChecked = 0;
+      ULong64_t nAccepted = 0;
+      for (std::size_t i = 0; i < bulk.fSize; ++i) {
+         // the filter is only evaluated for the entries that pass the filters upstream
+         mask[i] = prevMask[i] && fFilter(std::get<S>(values)[i]...);
+         nChecked += prevMask[i] != 0;
+         nAccepted += mask[i];
+      }
+      fAccepted[slot] += nAccepted;
+      fRejected[slot] += nChecked - nAccepted;
+   }
+
    void InitSlot(TTreeReader *r, unsigned int slot) final
    {
       for (auto &bookedBranch : fDefines.GetColumns())
          bookedBranch.second->InitSlot(r, slot);
       RDFInternal::RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fLoopManager->GetDSValuePtrs()};
       fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
+      if (fLoopManager->GetBulkSize() > 0) {
+         fBulkMasks[slot].assign(fLoopManager->GetBulkSize(), 0);
+         fLastCheckedBulk[slot] = -1;
+         fBulkValues[slot].Init(slot, fValues[slot], info, *fLoopManager);
+      }
    }
 
    // recursive chain of `Report`s
@@ -151,6 +209,19 @@ public:
       filters.push_back(name);
    }
 
+   std::vector<std::string> GetVariations() const final
+   {
+      return RDFInternal::Union(fPrevData.GetVariations(), fDefines.GetVariationDeps(fColumnNames));
+   }
+
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variationName) final
+   {
+      auto &variedFilter = fVariedFilters[variationName];
+      if (!variedFilter)
+         variedFilter = MakeVariedFilter(variationName, std::is_copy_constructible<FilterF>{});
+      return variedFilter;
+   }
+
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinaliseSlot(unsigned int slot) final
    {
@@ -159,6 +230,7 @@ public:
 
       for (auto &v : fValues[slot])
          v.reset();
+      fBulkValues[slot].Reset();
    }
 
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
@@ -16,6 +16,8 @@
 #include "RtypesCore.h"
 #include "TError.h" // R_ASSERT
 
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -43,6 +45,8 @@ protected:
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
 
    RDFInternal::RBookedDefines fDefines;
+   /// Clones of this filter that select entries according to a systematic variation, by variation name
+   std::map<std::string, std::shared_ptr<RNodeBase>> fVariedFilters;
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
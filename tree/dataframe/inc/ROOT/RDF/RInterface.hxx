@@ -17,13 +17,18 @@
 #include "ROOT/RDF/HistoModels.hxx"
 #include "ROOT/RDF/InterfaceUtils.hxx"
 #include "ROOT/RDF/RRange.hxx"
+#include "ROOT/RDF/RResultMap.hxx"
+#include "ROOT/RDF/RVariation.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RIntegerSequence.hxx"
+#include "ROOT/RDF/RCacheDS.hxx"
 #include "ROOT/RDF/RLazyDSImpl.hxx"
+#include "ROOT/RCacheOptions.hxx"
 #include "ROOT/RResultPtr.hxx"
 #include "ROOT/RSnapshotOptions.hxx"
 #include "ROOT/RStringView.hxx"
 #include "ROOT/TypeTraits.hxx"
+#include "RConfigure.h" // R__HAS_ROOT7
 #include "RtypesCore.h" // for ULong64_t
 #include "TH1.h"        // For Histo actions
 #include "TH2.h"        // For Histo actions
@@ -423,6 +428,101 @@ public:
       return newInterface;
    }
 
+   // clang-format off
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations for a column
+   /// \param[in] colName The name of the column whose values are varied. The column must already exist.
+   /// \param[in] expression Function, lambda expression, functor class or any other callable object returning an RVec with one alternative value of the column per variation tag.
+   /// \param[in] inputColumns Names of the columns/branches in input to the expression.
+   /// \param[in] variationTags Names of the alternative values, e.g. {"down", "up"}.
+   /// \param[in] variationName The name of the variation. It defaults to the name of the varied column.
+   /// \return the first node of the computation graph for which the variations are registered.
+   ///
+   /// The nominal values of the column are unchanged: the transformations and actions booked downstream keep reading
+   /// them. The varied results of an action are booked by passing its nominal result to
+   /// ROOT::RDF::Experimental::VariationsFor(), which returns them by "variation:tag" keys together with the nominal
+   /// one. The nominal and the varied results are filled in the same event loop: for each entry, the expression is
+   /// evaluated once, and only the Defines and Filters that depend on the varied column are evaluated again for each
+   /// variation tag.
+   ///
+   /// The values returned by the expression must have the type of the nominal column, which is checked when Vary is
+   /// called, and as many values as variation tags must be returned for each entry. Several columns can be varied together by registering the variations with
+   /// the same name and tags. The callables of the Defines and Filters that depend on varied columns must be
+   /// copy-constructible.
+   ///
+   /// An exception is thrown if the column already has variations in this branch of the computation graph.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto scaled = df.Vary("pt", [](double pt) { return ROOT::RVec<double>{0.9 * pt, 1.1 * pt}; }, {"pt"},
+   ///                       {"down", "up"}, "pt_scale");
+   /// auto h = scaled.Filter("pt > 10").Histo1D("pt");
+   /// auto hs = ROOT::RDF::Experimental::VariationsFor(h);
+   /// // hs["nominal"], hs["pt_scale:down"] and hs["pt_scale:up"] are filled in the same event loop
+   /// ~~~
+   template <typename F>
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, F &&expression, const ColumnNames_t &inputColumns,
+                                  const std::vector<std::string> &variationTags, std::string_view variationName = "")
+   {
+      using F_t = typename std::decay<F>::type;
+      using ColTypes_t = typename TTraits::CallableTraits<F_t>::arg_types;
+      using RetType_t = typename std::decay<typename TTraits::CallableTraits<F_t>::ret_type>::type;
+      static_assert(RDFInternal::IsRVec_t<RetType_t>::value,
+                    "Error in `Vary`: the expression must return an RVec with the values of all the variation tags");
+      constexpr auto nColumns = ColTypes_t::list_size;
+
+      if (variationTags.empty())
+         throw std::runtime_error("Vary: at least one variation tag is required.");
+
+      const auto validColName = GetValidatedColumnNames(1, {std::string(colName)})[0];
+      if (fDefines.GetVariations().count(validColName) > 0)
+         throw std::runtime_error("Vary: column \"" + validColName +
+                                  "\" already has variations in this branch of the computation graph.");
+
+      const auto validColumnNames = GetValidatedColumnNames(nColumns, inputColumns);
+      CheckAndFillDSColumns(validColumnNames, ColTypes_t());
+
+      using VariedType_t = typename RetType_t::value_type;
+      RDFInternal::CheckVariedType(validColName, GetColumnType(validColName), typeid(VariedType_t));
+      auto typeName = RDFInternal::TypeID2TypeName(typeid(VariedType_t));
+      if (typeName.empty())
+         typeName = "CLING_UNKNOWN_TYPE_" + RDFInternal::DemangleTypeIdName(typeid(VariedType_t));
+
+      using Variation_t = RDFDetail::RVariation<F_t>;
+      auto variation = std::make_shared<Variation_t>(
+         validColName, variationName.empty() ? std::string_view(validColName) : variationName, variationTags,
+         typeName, std::forward<F>(expression), validColumnNames, fLoopManager->GetNSlots(), fDefines,
+         fLoopManager->GetDSValuePtrs());
+
+      RDFInternal::RBookedDefines newCols(fDefines);
+      newCols.AddVariation(variation);
+      RInterface<Proxied, DS_t> newInterface(fProxiedPtr, *fLoopManager, std::move(newCols), fDataSource);
+
+      return newInterface;
+   }
+   // clang-format on
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Register systematic variations for a column, with tags "0", "1", ...
+   /// \param[in] colName The name of the column whose values are varied. The column must already exist.
+   /// \param[in] expression Callable returning an RVec with `nVariations` alternative values of the column.
+   /// \param[in] inputColumns Names of the columns/branches in input to the expression.
+   /// \param[in] nVariations The number of alternative values.
+   /// \param[in] variationName The name of the variation. It defaults to the name of the varied column.
+   /// \return the first node of the computation graph for which the variations are registered.
+   ///
+   /// Refer to the first overload of this method for the full documentation.
+   template <typename F>
+   RInterface<Proxied, DS_t> Vary(std::string_view colName, F &&expression, const ColumnNames_t &inputColumns,
+                                  std::size_t nVariations, std::string_view variationName = "")
+   {
+      std::vector<std::string> variationTags;
+      variationTags.reserve(nVariations);
+      for (std::size_t i = 0u; i < nVariations; ++i)
+         variationTags.emplace_back(std::to_string(i));
+      return Vary(colName, std::forward<F>(expression), inputColumns, variationTags, variationName);
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Save selected columns to disk, in a new TTree `treename` in file `filename`.
    /// \tparam ColumnTypes variadic list of branch/column types.
@@ -454,6 +554,15 @@ public:
    /// opts.fLazy = true;
    /// df.Snapshot("outputTree", "outputFile.root", {"x"}, opts);
    /// ~~~
+   ///
+   /// With `opts.fOutputFormat = ESnapshotOutputFormat::kRNTuple`, the columns are written as the fields of an RNTuple
+   /// named `treename` instead (experimental, requires ROOT to be built with root7). Each processing slot compresses
+   /// and writes whole clusters of `fAutoFlush` entries (64000 if not set) independently of the others, without the
+   /// intermediate in-memory files of TTree output. In multi-thread event loops, the clusters are appended in the
+   /// order in which the slots fill them: as for TTree output, the order of the entries in the RNTuple is not the one
+   /// of the input dataset and may change from run to run; only the entries within a cluster keep their relative
+   /// order. Only the RECREATE mode is supported, and the columns must be of fundamental types, std::string, RVecs or
+   /// std::vectors thereof, or classes with a dictionary.
    template <typename... ColumnTypes>
    RResultPtr<RInterface<RLoopManager>>
    Snapshot(std::string_view treename, std::string_view filename, const ColumnNames_t &columnList,
@@ -567,6 +676,7 @@ public:
    /// \brief Save selected columns in memory
    /// \tparam ColumnTypes variadic list of branch/column types.
    /// \param[in] columnList columns to be cached in memory.
+   /// \param[in] options RCacheOptions struct with the memory budget of the cache.
    /// \return a `RDataFrame` that wraps the cached dataset.
    ///
    /// This action returns a new `RDataFrame` object, completely detached from
@@ -592,20 +702,35 @@ public:
    /// ~~~{.cpp}
    /// auto cache_all_cols_df = df.Cache(myRegexp);
    /// ~~~
+   ///
+   /// ### Caching more data than fits in memory
+   /// With a non-zero `options.fMemoryBudget`, the cached values are kept in memory only as long as they take less
+   /// than approximately that many bytes. Beyond it, they are spilled to an RNTuple in a scratch file in
+   /// `options.fScratchDir`, from which the event loops of the new dataframe read them back. This is transparent to
+   /// the new dataframe, except for the order of the entries, which in multi-thread event loops is not defined. The
+   /// scratch file is removed together with the new dataframe.
+   /// This requires ROOT to be built with root7, and the columns must be of types that Snapshot can write to
+   /// RNTuple, see ESnapshotOutputFormat::kRNTuple.
+   /// ~~~{.cpp}
+   /// ROOT::RDF::RCacheOptions opts;
+   /// opts.fMemoryBudget = 4ull << 30; // 4 GB
+   /// auto cached_df = df.Filter("pt > 20").Cache<float, RVec<float>>({"pt", "eta"}, opts);
+   /// ~~~
    template <typename... ColumnTypes>
-   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList)
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList, const RCacheOptions &options = RCacheOptions())
    {
       auto staticSeq = std::make_index_sequence<sizeof...(ColumnTypes)>();
-      return CacheImpl<ColumnTypes...>(columnList, staticSeq);
+      return CacheImpl<ColumnTypes...>(columnList, options, staticSeq);
    }
 
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Save selected columns in memory
    /// \param[in] columnList columns to be cached in memory
+   /// \param[in] options RCacheOptions struct with the memory budget of the cache.
    /// \return a `RDataFrame` that wraps the cached dataset.
    ///
    /// See the previous overloads for more information.
-   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList)
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList, const RCacheOptions &options = RCacheOptions())
    {
       // Early return: if the list of columns is empty, just return an empty RDF
       // If we proceed, the jitted call will not compile!
@@ -620,7 +745,7 @@ public:
       RInterface<TTraits::TakeFirstParameter_t<decltype(upcastNode)>> upcastInterface(fProxiedPtr, *fLoopManager,
                                                                                       fDefines, fDataSource);
       // build a string equivalent to
-      // "(RInterface<nodetype*>*)(this)->Cache<Ts...>(*(ColumnNames_t*)(&columnList))"
+      // "(RInterface<nodetype*>*)(this)->Cache<Ts...>(*(ColumnNames_t*)(&columnList), *(RCacheOptions*)(&options))"
       RInterface<RLoopManager> resRDF(std::make_shared<ROOT::Detail::RDF::RLoopManager>(0));
       cacheCall << "*reinterpret_cast<ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager>*>("
                 << RDFInternal::PrettyPrintAddr(&resRDF)
@@ -635,7 +760,8 @@ public:
       if (!columnList.empty())
          cacheCall.seekp(-2, cacheCall.cur);                         // remove the last ",
       cacheCall << ">(*reinterpret_cast<std::vector<std::string>*>(" // vector<string> should be ColumnNames_t
-                << RDFInternal::PrettyPrintAddr(&columnList) << "));";
+                << RDFInternal::PrettyPrintAddr(&columnList) << "), *reinterpret_cast<ROOT::RDF::RCacheOptions*>("
+                << RDFInternal::PrettyPrintAddr(&options) << "));";
       // jit cacheCall, return result
       RDFInternal::InterpreterCalc(cacheCall.str(), "Cache");
       return resRDF;
@@ -644,28 +770,32 @@ public:
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Save selected columns in memory
    /// \param[in] columnNameRegexp The regular expression to match the column names to be selected. The presence of a '^' and a '$' at the end of the string is implicitly assumed if they are not specified. The dialect supported is PCRE via the TPRegexp class. An empty string signals the selection of all columns.
+   /// \param[in] options RCacheOptions struct with the memory budget of the cache.
    /// \return a `RDataFrame` that wraps the cached dataset.
    ///
    /// The existing columns are matched against the regular expression. If the string provided
    /// is empty, all columns are selected. See the previous overloads for more information.
-   RInterface<RLoopManager> Cache(std::string_view columnNameRegexp = "")
+   RInterface<RLoopManager>
+   Cache(std::string_view columnNameRegexp = "", const RCacheOptions &options = RCacheOptions())
    {
 
       auto selectedColumns = RDFInternal::ConvertRegexToColumns(fDefines, fLoopManager->GetTree(), fDataSource,
                                                                 columnNameRegexp, "Cache");
-      return Cache(selectedColumns);
+      return Cache(selectedColumns, options);
    }
 
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Save selected columns in memory
    /// \param[in] columnList columns to be cached in memory.
+   /// \param[in] options RCacheOptions struct with the memory budget of the cache.
    /// \return a `RDataFrame` that wraps the cached dataset.
    ///
    /// See the previous overloads for more information.
-   RInterface<RLoopManager> Cache(std::initializer_list<std::string> columnList)
+   RInterface<RLoopManager>
+   Cache(std::initializer_list<std::string> columnList, const RCacheOptions &options = RCacheOptions())
    {
       ColumnNames_t selectedColumns(columnList);
-      return Cache(selectedColumns);
+      return Cache(selectedColumns, options);
    }
 
    // clang-format off
@@ -1970,6 +2100,32 @@ public:
    /// ~~~
    unsigned int GetNRuns() const { return fLoopManager->GetNRuns(); }
 
+   /// \brief Process the entries in bulks of the given size
+   /// \param[in] bulkSize The number of entries per bulk; zero disables bulk mode, which is the default
+   ///
+   /// In bulk mode, the event loop first collects bulkSize entries, then each Filter, Define and action processes the
+   /// whole bulk at once: Defines and Filters run in a tight loop over arrays of values and pass a mask of the selected
+   /// entries downstream, actions are filled with the selected entries. This saves several virtual calls per node and
+   /// per entry. The tutorial df032_BulkMode.C measures the effect on a given computation graph.
+   ///
+   /// Each input column is copied to one array per processing slot, which all the nodes that read the column share.
+   /// The values of TTree branches are only read for the entries that pass the filters upstream of the nodes that read
+   /// them, as in the default mode; bulks then do not span two files of a TChain. Data sources do not support random
+   /// access to their entries, hence the values of the columns of a data source are copied for every entry.
+   ///
+   /// Expressions are only evaluated for the entries that pass the filters upstream. Callbacks run after each bulk.
+   /// The types of all the columns must be default-constructible and copy-assignable; Snapshot and systematic
+   /// variations (see Vary()) are not supported in bulk mode, the event loop throws if the computation graph contains
+   /// them. The setting applies to the whole computation graph and takes effect at the next event loop.
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df("tree", "file.root");
+   /// df.SetBulkSize(256);
+   /// auto h = df.Define("pt", "sqrt(px*px + py*py)").Filter("pt > 10").Histo1D("pt");
+   /// ~~~
+   void SetBulkSize(std::size_t bulkSize) { fLoopManager->SetBulkSize(bulkSize); }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Execute a user-defined accumulation operation on the processed column values in each processing slot
@@ -2269,6 +2425,8 @@ private:
 
       auto action = RDFInternal::BuildAction<ColTypes...>(validColumnNames, r, nSlots, fProxiedPtr, ActionTag{},
                                                              fDefines);
+      RDFInternal::SetVariedActionFactory<ColTypes...>(*action, validColumnNames, r, nSlots, fProxiedPtr, ActionTag{},
+                                                       fDefines);
       fLoopManager->Book(action.get());
       return MakeResultPtr(r, *fLoopManager, std::move(action));
    }
@@ -2388,6 +2546,23 @@ private:
          treename = treename.substr(lastSlash + 1, treename.size());
       }
 
+      if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+#ifdef R__HAS_ROOT7
+         if (!dirname.empty())
+            throw std::runtime_error("Snapshot: RNTuple output cannot be written to a TDirectory.");
+         using Helper_t = RDFInternal::SnapshotHelperRNTuple<ColumnTypes...>;
+         using Action_t = RDFInternal::RAction<Helper_t, Proxied>;
+         Helper_t helper(fLoopManager->GetNSlots(), filename, treename, columnList, options);
+         auto snapshotRDF = helper.GetOutputRDF();
+         std::unique_ptr<RDFInternal::RActionBase> actionPtr(
+            new Action_t(std::move(helper), validCols, fProxiedPtr, fDefines));
+         fLoopManager->Book(actionPtr.get());
+         return RDFInternal::CreateSnapshotRDF(snapshotRDF, options.fLazy, *fLoopManager, std::move(actionPtr));
+#else
+         throw std::runtime_error("Snapshot: RNTuple output requires ROOT to be built with root7.");
+#endif
+      }
+
       // add action node to functional graph and run event loop
       std::unique_ptr<RDFInternal::RActionBase> actionPtr;
       if (!ROOT::IsImplicitMTEnabled()) {
@@ -2414,7 +2589,8 @@ private:
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Implementation of cache
    template <typename... ColTypes, std::size_t... S>
-   RInterface<RLoopManager> CacheImpl(const ColumnNames_t &columnList, std::index_sequence<S...> s)
+   RInterface<RLoopManager>
+   CacheImpl(const ColumnNames_t &columnList, const RCacheOptions &options, std::index_sequence<S...> s)
    {
       // Check at compile time that the columns types are copy constructible
       constexpr bool areCopyConstructible =
@@ -2425,6 +2601,27 @@ private:
       // in memory!
       RDFInternal::CheckTypesAndPars(sizeof...(ColTypes), columnList.size());
 
+      if (options.fMemoryBudget > 0) {
+#ifdef R__HAS_ROOT7
+         const auto validColumnNames = GetValidatedColumnNames(columnList.size(), columnList);
+         CheckAndFillDSColumns(validColumnNames, TTraits::TypeList<ColTypes...>());
+
+         using Helper_t = RDFInternal::CacheHelper<ColTypes...>;
+         using Action_t = RDFInternal::RAction<Helper_t, Proxied>;
+         auto store = std::make_shared<RDFInternal::RCacheStore<ColTypes...>>();
+         const auto nSlots = fLoopManager->GetNSlots();
+
+         auto action = std::make_unique<Action_t>(Helper_t(store, columnList, options, nSlots), validColumnNames,
+                                                  fProxiedPtr, fDefines);
+         fLoopManager->Book(action.get());
+         auto ds = std::make_unique<RDFInternal::RCacheDS<ColTypes...>>(
+            MakeResultPtr(store, *fLoopManager, std::move(action)), columnList);
+         return RInterface<RLoopManager>(std::make_shared<RLoopManager>(std::move(ds), columnList));
+#else
+         throw std::runtime_error("Cache: a memory budget requires ROOT to be built with root7.");
+#endif
+      }
+
       auto colHolders = std::make_tuple(Take<ColTypes>(columnList[S])...);
       auto ds = std::make_unique<RLazyDS<ColTypes...>>(std::make_pair(columnList[S], std::get<S>(colHolders))...);
 
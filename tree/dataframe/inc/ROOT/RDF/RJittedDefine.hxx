@@ -45,6 +45,11 @@ public:
    const std::type_info &GetTypeId() const final;
    void Update(unsigned int slot, Long64_t entry) final;
    void FinaliseSlot(unsigned int slot) final;
+   std::vector<std::string> GetVariations() const final;
+   std::shared_ptr<RDefineBase> GetVariedDefine(const std::string &variationName) final;
+   void InitBulkSlot(unsigned int slot, RLoopManager &lm) final;
+   void *GetBulkValuePtr(unsigned int slot) final;
+   void UpdateBulk(unsigned int slot, const RDFInternal::REntryBulk &bulk, const char *mask) final;
 };
 
 } // ns RDF
@@ -47,6 +47,7 @@ public:
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    bool CheckFilters(unsigned int slot, Long64_t entry) final;
+   const char *CheckFiltersBulk(unsigned int slot, const ROOT::Internal::RDF::REntryBulk &bulk) final;
    void Report(ROOT::RDF::RCutFlowReport &) const final;
    void PartialReport(ROOT::RDF::RCutFlowReport &) const final;
    void FillReport(ROOT::RDF::RCutFlowReport &) const final;
@@ -59,6 +60,8 @@ public:
    void AddFilterName(std::vector<std::string> &filters) final;
    void FinaliseSlot(unsigned int slot) final;
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph();
+   std::vector<std::string> GetVariations() const final;
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variationName) final;
 };
 
 } // ns RDF
@@ -13,10 +13,12 @@
 
 #include "ROOT/RDF/RNodeBase.hxx"
 
+#include <cstddef>
 #include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
 // forward declarations
@@ -35,7 +37,9 @@ namespace RDF {
 std::vector<std::string> GetBranchNames(TTree &t, bool allowDuplicates = true);
 
 class RActionBase;
+class RBulkColumnBase;
 class GraphNode;
+struct REntryBulk;
 
 namespace GraphDrawing {
 class GraphCreatorHelper;
@@ -121,6 +125,21 @@ class RLoopManager : public RNodeBase {
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
 
+   /// Number of entries that the nodes process together in bulk mode; zero if bulk mode is disabled
+   std::size_t fBulkSize{0};
+   /// Bulk mode: per slot, the entries of the bulk that is being collected
+   std::vector<std::vector<Long64_t>> fBulkEntries;
+   /// Bulk mode: per slot, the values of the input columns read from the TTree or data source, shared by all nodes
+   std::vector<std::vector<std::unique_ptr<RDFInternal::RBulkColumnBase>>> fBulkColumns;
+   /// Bulk mode: per slot, the TTreeReader that the values of the columns are loaded with; null for data sources
+   std::vector<TTreeReader *> fBulkReaders;
+   /// Bulk mode: per slot, the entries of the TTreeReader of the entries of the bulk that is being collected
+   std::vector<std::vector<Long64_t>> fBulkReaderEntries;
+   /// Bulk mode: per slot, the number of the tree of the chain that the entries of the bulk belong to
+   std::vector<Int_t> fBulkTreeNumbers;
+   /// Bulk mode: a mask that selects all the entries of a bulk
+   std::vector<char> fBulkMaskAll;
+
    void CheckIndexedFriends();
    void RunEmptySourceMT();
    void RunEmptySource();
@@ -129,6 +148,8 @@ class RLoopManager : public RNodeBase {
    void RunDataSourceMT();
    void RunDataSource();
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   void RunAndCheckFiltersBulk(unsigned int slot);
+   void ProcessEntry(unsigned int slot, Long64_t entry);
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
    void CleanUpNodes();
@@ -141,6 +162,7 @@ public:
    RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t &defaultBranches);
    RLoopManager(const RLoopManager &) = delete;
    RLoopManager &operator=(const RLoopManager &) = delete;
+   ~RLoopManager();
 
    void JitDeclarations();
    void Jit();
@@ -158,6 +180,7 @@ public:
    void Book(RRangeBase *rangePtr);
    void Deregister(RRangeBase *rangePtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   const char *CheckFiltersBulk(unsigned int, const RDFInternal::REntryBulk &) final { return fBulkMaskAll.data(); }
    unsigned int GetNSlots() const { return fNSlots; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
@@ -166,10 +189,18 @@ public:
    void IncrChildrenCount() final { ++fNChildren; }
    void StopProcessing() final { ++fNStopsReceived; }
    void ToJitExec(const std::string &) const;
+   void ToJitDeclare(const std::string &code) const;
    void AddColumnAlias(const std::string &alias, const std::string &colName) { fAliasColumnNameMap[alias] = colName; }
    const std::map<std::string, std::string> &GetAliasMap() const { return fAliasColumnNameMap; }
    void RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f);
    unsigned int GetNRuns() const { return fNRuns; }
+   void SetBulkSize(std::size_t bulkSize);
+   std::size_t GetBulkSize() const { return fBulkSize; }
+   RDFInternal::RBulkColumnBase *
+   GetBulkColumn(unsigned int slot, const std::string &colName, const std::type_info &type) const;
+   RDFInternal::RBulkColumnBase *AddBulkColumn(unsigned int slot, std::unique_ptr<RDFInternal::RBulkColumnBase> column);
+   void LoadBulkColumns(unsigned int slot, const RDFInternal::REntryBulk &bulk, const char *mask,
+                        RDFInternal::RBulkColumnBase *const *columns, std::size_t nColumns);
    bool HasDSValuePtrs(const std::string &col) const;
    const std::map<std::string, std::vector<void *>> &GetDSValuePtrs() const { return fDSValuePtrMap; }
    void AddDSValuePtrs(const std::string &col, const std::vector<void *> ptrs);
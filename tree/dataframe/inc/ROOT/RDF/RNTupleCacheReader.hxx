@@ -0,0 +1,65 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RNTUPLECACHEREADER
+#define ROOT_RDF_RNTUPLECACHEREADER
+
+#include "ROOT/RDF/Utils.hxx" // ColumnNames_t
+#include "RtypesCore.h"       // ULong64_t
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+
+namespace Experimental {
+namespace Detail {
+class RFieldBase;
+class RFieldValue;
+class RPageSource;
+} // namespace Detail
+} // namespace Experimental
+
+namespace Internal {
+namespace RDF {
+
+/// Reads back the columns that Cache spilled to a scratch file, see RCacheOptions::fMemoryBudget.
+/// Every processing slot reads through its own page source into the values that it connected.
+/// Implemented only if ROOT is built with root7.
+class RNTupleCacheReader {
+   const ROOT::Detail::RDF::ColumnNames_t fFieldNames;
+   const std::vector<std::string> fTypeNames;
+   /// Per slot
+   std::vector<std::unique_ptr<ROOT::Experimental::Detail::RPageSource>> fSources;
+   /// Per slot, per column; unlike RFieldBase::Create(), CreateNTupleField() gives RVec columns the memory layout of RVec
+   std::vector<std::vector<std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>>> fFields;
+   /// Per slot, per column, the values that the fields read into
+   std::vector<std::vector<std::unique_ptr<ROOT::Experimental::Detail::RFieldValue>>> fValues;
+
+public:
+   RNTupleCacheReader(unsigned int nSlots, const std::string &fileName, const std::string &ntupleName,
+                      const ROOT::Detail::RDF::ColumnNames_t &fieldNames, const std::vector<std::string> &typeNames);
+   RNTupleCacheReader(const RNTupleCacheReader &) = delete;
+   RNTupleCacheReader &operator=(const RNTupleCacheReader &) = delete;
+   ~RNTupleCacheReader();
+
+   /// Bind the fields of the slot to the addresses of the values, given in the order of the columns
+   void Connect(unsigned int slot, const std::vector<void *> &values);
+   /// Read the given entry into the values of the slot
+   void Read(unsigned int slot, ULong64_t entry);
+   ULong64_t GetNEntries();
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RNTUPLECACHEREADER
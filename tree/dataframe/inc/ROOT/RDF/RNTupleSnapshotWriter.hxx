@@ -0,0 +1,92 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RNTUPLESNAPSHOTWRITER
+#define ROOT_RDF_RNTUPLESNAPSHOTWRITER
+
+#include "ROOT/RSnapshotOptions.hxx"
+#include "ROOT/RDF/Utils.hxx" // ColumnNames_t
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+
+class RDataFrame;
+
+namespace Experimental {
+class REntry;
+class RNTupleFillContext;
+class RNTupleModel;
+class RNTupleParallelWriter;
+namespace Detail {
+class RFieldBase;
+}
+} // namespace Experimental
+
+namespace Internal {
+namespace RDF {
+
+/// Create the RNTuple field for a column of the given type, as spelled by TypeID2TypeName(). Throws if the type
+/// cannot be written to RNTuple. Implemented only if ROOT is built with root7.
+std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+CreateNTupleField(const std::string &fieldName, const std::string &typeName);
+
+/// Writes the output of a Snapshot to RNTuple, see RSnapshotOptions::fOutputFormat.
+/// Every processing slot fills its own RNTupleFillContext, which compresses its pages independently of the other slots
+/// and appends them to the output file cluster by cluster. Hence the clusters of the output hold the entries of one
+/// slot each, and in multi-thread event loops the order of the entries is not defined.
+/// Implemented only if ROOT is built with root7.
+class RNTupleSnapshotWriter {
+   const std::string fFileName;
+   const std::string fNTupleName;
+   const RSnapshotOptions fOptions;
+   /// Created at booking, which checks the column types; moved to the parallel writer by Initialize()
+   std::unique_ptr<ROOT::Experimental::RNTupleModel> fModel;
+   std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> fWriter;
+   /// Per slot, created when the slot fills its first entry; must be destructed before fWriter
+   std::vector<std::unique_ptr<ROOT::Experimental::RNTupleFillContext>> fFillContexts;
+   /// Per slot, the top-level fields of the model of the fill context, in the order of the columns
+   std::vector<std::vector<ROOT::Experimental::Detail::RFieldBase *>> fFields;
+   /// Per slot, binds the fields to the column values of the current task
+   std::vector<std::unique_ptr<ROOT::Experimental::REntry>> fEntries;
+   /// The RDataFrame returned by Snapshot, if requested; it reads the output once it has been written
+   std::shared_ptr<ROOT::RDataFrame> fOutputRDF;
+
+public:
+   RNTupleSnapshotWriter(unsigned int nSlots, const std::string &fileName, const std::string &ntupleName,
+                         const ROOT::Detail::RDF::ColumnNames_t &fieldNames, const std::vector<std::string> &typeNames,
+                         const RSnapshotOptions &options);
+   RNTupleSnapshotWriter(const RNTupleSnapshotWriter &) = delete;
+   RNTupleSnapshotWriter &operator=(const RNTupleSnapshotWriter &) = delete;
+   ~RNTupleSnapshotWriter();
+
+   /// Create the output file
+   void Initialize();
+   /// Bind the fields of the slot to the addresses of the column values, given in the order of the columns.
+   /// The addresses must remain valid until the next call for the same slot.
+   void Connect(unsigned int slot, const std::vector<void *> &values);
+   /// Append the current column values of the slot
+   void Fill(unsigned int slot);
+   /// Commit the ntuple to the output file
+   void Finalize();
+
+   /// The RDataFrame that reads the output, usable once the output has been committed
+   std::shared_ptr<ROOT::RDataFrame> GetOutputRDF();
+
+   const std::string &GetFileName() const { return fFileName; }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RNTUPLESNAPSHOTWRITER
@@ -13,7 +13,9 @@
 
 #include "RtypesCore.h"
 
+#include <algorithm>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -27,6 +29,7 @@ namespace RDF {
 namespace GraphDrawing {
 class GraphNode;
 }
+struct REntryBulk;
 }
 }
 
@@ -48,6 +51,9 @@ public:
    RNodeBase(RLoopManager *lm = nullptr) : fLoopManager(lm) {}
    virtual ~RNodeBase() {}
    virtual bool CheckFilters(unsigned int, Long64_t) = 0;
+   /// Bulk mode counterpart of CheckFilters, see RLoopManager::SetBulkSize(). Return a mask with a non-zero element for
+   /// each entry of the bulk that passes the filters; the mask is valid until the next call for the same slot.
+   virtual const char *CheckFiltersBulk(unsigned int slot, const ROOT::Internal::RDF::REntryBulk &bulk) = 0;
    virtual void Report(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void PartialReport(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void IncrChildrenCount() = 0;
@@ -62,7 +68,29 @@ public:
    }
 
    virtual RLoopManager *GetLoopManagerUnchecked() { return fLoopManager; }
+
+   /// Return the names of the variations, in the form "variation:tag", that affect the selection of entries performed
+   /// by this node or by the nodes upstream.
+   virtual std::vector<std::string> GetVariations() const { return {}; }
+
+   /// Return a clone of this node that selects entries according to the values of the given variation.
+   /// Only called for the nodes whose GetVariations() contains the variation.
+   virtual std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variationName)
+   {
+      throw std::logic_error("This node cannot select entries for the variation \"" + variationName + "\".");
+   }
 };
+
+/// Return the node that selects the entries of the given variation: a varied clone of `node` if the variation
+/// affects it, `node` itself otherwise.
+template <typename NodeType>
+std::shared_ptr<RNodeBase> GetVariedNode(const std::shared_ptr<NodeType> &node, const std::string &variationName)
+{
+   const auto variations = node->GetVariations();
+   if (std::find(variations.begin(), variations.end(), variationName) == variations.end())
+      return node;
+   return node->GetVariedFilter(variationName);
+}
 } // ns RDF
 } // ns Detail
 } // ns ROOT
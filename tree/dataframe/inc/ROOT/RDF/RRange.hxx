@@ -11,11 +11,15 @@
 #ifndef ROOT_RDFRANGE
 #define ROOT_RDFRANGE
 
+#include "ROOT/RDF/RBulkColumn.hxx" // REntryBulk
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "RtypesCore.h"
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace ROOT {
 
@@ -75,6 +79,30 @@ public:
       return fLastResult;
    }
 
+   /// Bulk mode counterpart of CheckFilters: the entries of the bulk are counted in processing order
+   const char *CheckFiltersBulk(unsigned int slot, const ROOT::Internal::RDF::REntryBulk &bulk) final
+   {
+      if (bulk.GetId() != fLastCheckedBulk) {
+         fBulkMask.resize(std::max(fBulkMask.size(), bulk.fSize));
+         const char *prevMask = fHasStopped ? nullptr : fPrevData.CheckFiltersBulk(slot, bulk);
+         for (std::size_t i = 0; i < bulk.fSize; ++i) {
+            if (fHasStopped || !prevMask[i]) {
+               fBulkMask[i] = false;
+               continue;
+            }
+            ++fNProcessedEntries;
+            fBulkMask[i] = !(fNProcessedEntries <= fStart || (fStop > 0 && fNProcessedEntries > fStop) ||
+                             (fStride != 1 && fNProcessedEntries % fStride != 0));
+            if (fNProcessedEntries == fStop) {
+               fHasStopped = true;
+               fPrevData.StopProcessing();
+            }
+         }
+         fLastCheckedBulk = bulk.GetId();
+      }
+      return fBulkMask.data();
+   }
+
    // recursive chain of `Report`s
    // RRange simply forwards these calls to the previous node
    void Report(ROOT::RDF::RCutFlowReport &rep) const final { fPrevData.PartialReport(rep); }
@@ -98,6 +126,21 @@ public:
 
    /// This function must be defined by all nodes, but only the filters will add their name
    void AddFilterName(std::vector<std::string> &filters) { fPrevData.AddFilterName(filters); }
+
+   std::vector<std::string> GetVariations() const final { return fPrevData.GetVariations(); }
+
+   std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variationName) final
+   {
+      auto &variedRange = fVariedRanges[variationName];
+      if (!variedRange) {
+         auto range =
+            std::make_shared<RRange<RNodeBase>>(fStart, fStop, fStride, GetVariedNode(fPrevDataPtr, variationName));
+         fLoopManager->Book(range.get());
+         variedRange = std::move(range);
+      }
+      return variedRange;
+   }
+
    std::shared_ptr<RDFGraphDrawing::GraphNode> GetGraph()
    {
       // TODO: Ranges node have no information about custom columns, hence it is not possible now
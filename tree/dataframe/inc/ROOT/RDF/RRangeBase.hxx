@@ -14,6 +14,11 @@
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "RtypesCore.h"
 
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace ROOT {
 
 // fwd decl
@@ -36,9 +41,13 @@ protected:
    unsigned int fStride;
    Long64_t fLastCheckedEntry{-1};
    bool fLastResult{true};
+   Long64_t fLastCheckedBulk{-1};
+   std::vector<char> fBulkMask; ///< Bulk mode: the entries of the current bulk that are in the range
    ULong64_t fNProcessedEntries{0};
    bool fHasStopped{false};    ///< True if the end of the range has been reached
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
+   /// Clones of this range that select entries according to a systematic variation, by variation name
+   std::map<std::string, std::shared_ptr<RNodeBase>> fVariedRanges;
 
    void ResetCounters();
 
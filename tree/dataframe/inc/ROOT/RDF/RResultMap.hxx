@@ -0,0 +1,137 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RRESULTMAP
+#define ROOT_RDF_RRESULTMAP
+
+#include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RResultPtr.hxx"
+#include "TError.h" // R__ASSERT
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+namespace Experimental {
+
+/**
+\class ROOT::RDF::Experimental::RResultMap
+\ingroup dataframe
+\brief The results of an action for the nominal case and for each of the systematic variations that affect it.
+\tparam T Type of the action result
+
+Instances are returned by VariationsFor(). The keys are "nominal" and the names of the variations, in the form
+"variation:tag". Accessing any of the results triggers the event loop if needed: the nominal and all the varied results
+are filled in the same event loop.
+*/
+template <typename T>
+class RResultMap {
+   template <typename T1>
+   friend RResultMap<T1> VariationsFor(RResultPtr<T1> resPtr);
+
+   std::vector<std::string> fKeys;
+   std::map<std::string, std::shared_ptr<T>> fMap;
+   /// The action producing the nominal result, followed by the actions producing the varied ones
+   std::vector<std::shared_ptr<ROOT::Internal::RDF::RActionBase>> fActions;
+   /// Non-owning pointer to the RLoopManager at the root of this computation graph.
+   /// The actions keep the computation graph, and therefore the RLoopManager, alive.
+   ROOT::Detail::RDF::RLoopManager *fLoopManager;
+
+   RResultMap(std::vector<std::string> &&keys, std::map<std::string, std::shared_ptr<T>> &&results,
+              std::vector<std::shared_ptr<ROOT::Internal::RDF::RActionBase>> &&actions,
+              ROOT::Detail::RDF::RLoopManager &loopManager)
+      : fKeys(std::move(keys)), fMap(std::move(results)), fActions(std::move(actions)), fLoopManager(&loopManager)
+   {
+   }
+
+public:
+   /// Return the result for the given key, running the event loop if needed.
+   T &operator[](const std::string &key)
+   {
+      auto it = fMap.find(key);
+      if (it == fMap.end())
+         throw std::runtime_error("RResultMap: no result with key \"" + key + "\".");
+
+      const auto hasRun = [](const std::shared_ptr<ROOT::Internal::RDF::RActionBase> &a) { return a->HasRun(); };
+      if (!std::all_of(fActions.begin(), fActions.end(), hasRun))
+         fLoopManager->Run();
+      return *it->second;
+   }
+
+   /// Return the keys of the results: "nominal" followed by the names of the variations.
+   const std::vector<std::string> &GetKeys() const { return fKeys; }
+};
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Book the varied results of an action, for all the systematic variations that affect it.
+/// \param[in] resPtr The nominal result of the action, whose event loop must not have run yet.
+/// \return An RResultMap with the nominal and the varied results.
+///
+/// For each variation registered with Vary() upstream of the action, a copy of the action is booked: it reads the
+/// varied values of the columns, and the Defines and Filters in between that depend on them are evaluated once per
+/// variation. The nodes that do not depend on the variation are shared with the nominal computation and evaluated only
+/// once per entry. All the results are filled in the same event loop.
+///
+/// The varied results start as copies of the nominal one, so the result type must be copy-constructible. Actions booked
+/// through the histogram, graph, profile, Fill, Min, Max, Sum, Mean and StdDev methods support variations.
+///
+/// ### Example usage:
+/// ~~~{.cpp}
+/// auto h = df.Vary("pt", [](double pt) { return ROOT::RVec<double>{0.9 * pt, 1.1 * pt}; }, {"pt"}, {"down", "up"})
+///             .Filter([](double pt) { return pt > 10; }, {"pt"})
+///             .Histo1D<double>("pt");
+/// auto hs = ROOT::RDF::Experimental::VariationsFor(h);
+/// hs["nominal"].Draw();
+/// hs["pt:up"].Draw("SAME");
+/// ~~~
+template <typename T>
+RResultMap<T> VariationsFor(RResultPtr<T> resPtr)
+{
+   static_assert(std::is_copy_constructible<T>::value,
+                 "VariationsFor requires the result type of the action to be copy-constructible.");
+   R__ASSERT(resPtr != nullptr && "Calling VariationsFor on an empty RResultPtr");
+
+   auto &loopManager = *resPtr.fLoopManager;
+   // the variations that affect just-in-time compiled nodes are only known once these have been compiled
+   loopManager.Jit();
+
+   auto nominalAction = resPtr.fActionPtr;
+   if (nominalAction->HasRun())
+      throw std::logic_error("VariationsFor must be called before the event loop producing the result has run.");
+
+   std::vector<std::string> keys{"nominal"};
+   std::map<std::string, std::shared_ptr<T>> results{{"nominal", resPtr.fObjPtr}};
+   std::vector<std::shared_ptr<ROOT::Internal::RDF::RActionBase>> actions{nominalAction};
+   for (const auto &variationName : nominalAction->GetVariations()) {
+      // the nominal result has not been filled yet: its copy is in the state the action expects to start from
+      auto variedResult = std::make_shared<T>(*resPtr.fObjPtr);
+      std::shared_ptr<ROOT::Internal::RDF::RActionBase> variedAction =
+         nominalAction->MakeVariedAction(variationName, variedResult);
+      loopManager.Book(variedAction.get());
+      keys.emplace_back(variationName);
+      results[variationName] = std::move(variedResult);
+      actions.emplace_back(std::move(variedAction));
+   }
+
+   return RResultMap<T>(std::move(keys), std::move(results), std::move(actions), loopManager);
+}
+
+} // namespace Experimental
+} // namespace RDF
+} // namespace ROOT
+
+#endif // ROOT_RDF_RRESULTMAP
@@ -15,27 +15,114 @@
 #include <ROOT/RMakeUnique.hxx>
 #include <ROOT/RVec.hxx>
 #include <Rtypes.h>  // Long64_t, R__CLING_PTRCHECK
+#include <TBufferFile.h>
 #include <TTreeReader.h>
 #include <TTreeReaderValue.h>
 #include <TTreeReaderArray.h>
 
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <string>
+#include <typeinfo>
+#include <vector>
+
+class TBranch;
+class TTree;
 
 namespace ROOT {
 namespace Internal {
 namespace RDF {
 
+/// Basket-at-a-time reader for branches that store a single fundamental value or a fixed-size array of fundamental
+/// values per entry, such as the branches of flat ntuples.
+///
+/// Whole baskets are read with TBranch::GetBulkEntries(), which converts the byte order of all the values of the
+/// basket in a single pass.  Entries are then served directly from the basket buffer rather than one by one through
+/// TBranch::GetEntry().  GetEntry() returns nullptr if the entry cannot be served from a basket buffer, e.g. because the
+/// entry is in the middle of a basket that was not read in bulk or because the branch of the current tree does not
+/// qualify.  The caller then needs to read the entry through its TTreeReaderValue or TTreeReaderArray.
+///
+/// Readers of arrays also serve top-level std::vector branches of fundamental types that were written with the
+/// collection counts layout (see TBranchElement::HasCollectionCounts()).  The values of all the entries of such a
+/// basket are contiguous, so that they are converted in one pass as well; the number of values of every entry follows
+/// from the entry offsets of the basket.
+class RTreeBulkReader {
+   TTreeReader &fReader;
+   std::string fBranchName;
+   /// The type name of the on-disk values, e.g. "Float_t"
+   std::string fTypeName;
+   /// Holds the entries of the last basket read in bulk
+   TBufferFile fBuffer{TBuffer::kWrite, 32 * 1024};
+   /// The tree the branch belongs to, i.e. the current tree of a chain
+   TTree *fTree = nullptr;
+   Int_t fTreeNumber = -1;
+   /// Set to nullptr if the branch of the current tree cannot be read in bulk
+   TBranch *fBranch = nullptr;
+   /// Whether the reader may serve entries with a varying number of values
+   bool fReadsArrays = false;
+   /// Whether the branch of the current tree is a collection with the collection counts layout
+   bool fIsCollection = false;
+   /// The size in bytes of a single value
+   Int_t fValueSize = 0;
+   /// The number of values per entry; larger than one for fixed-size arrays, unused for collections
+   Int_t fNValuesPerEntry = 0;
+   /// The size in bytes of all the values of one entry, unused for collections
+   Int_t fEntrySize = 0;
+   /// For collections, the byte offsets of the entries in the buffer, including the end offset of the last entry
+   std::vector<Int_t> fEntryOffsets;
+   /// The number of values of the last entry returned by GetEntry()
+   Int_t fNValues = 0;
+   /// The range of local entry numbers available in the basket buffer
+   Long64_t fFirstEntry = 0;
+   Long64_t fNEntries = 0;
+
+   RTreeBulkReader(TTreeReader &r, const std::string &branchName, const std::string &typeName, bool readsArrays)
+      : fReader(r), fBranchName(branchName), fTypeName(typeName), fReadsArrays(readsArrays)
+   {
+   }
+   void Connect(TTree *tree);
+   bool ReadBasket(Long64_t entry);
+   bool ReadCollectionBasket(Long64_t entry);
+
+public:
+   /// Returns nullptr if values of the given type cannot be read in bulk.  Only readers of arrays serve entries that
+   /// consist of more than one value.
+   static std::unique_ptr<RTreeBulkReader>
+   Create(TTreeReader &r, const std::string &branchName, const std::type_info &valueType, bool readsArrays);
+
+   /// Returns the address of the values of the current entry of the tree reader in the basket buffer.  The address
+   /// is not necessarily aligned to the value type.
+   const char *GetEntry();
+   /// The number of values of the current entry; valid after GetEntry() returned a non-null address
+   Int_t GetNValues() const { return fNValues; }
+};
+
 /// RTreeColumnReader specialization for TTree values read via TTreeReaderValues
 template <typename T>
 class R__CLING_PTRCHECK(off) RTreeColumnReader final : public RColumnReaderBase {
    std::unique_ptr<TTreeReaderValue<T>> fTreeValue;
+   /// Reads flat branches of fundamental types basket by basket; entries that it cannot serve are read by fTreeValue
+   std::unique_ptr<RTreeBulkReader> fBulkReader;
+   /// Aligned copy of the current value served by the bulk reader
+   alignas(T) unsigned char fBulkValue[sizeof(T)];
+
+   void *GetImpl(Long64_t) final
+   {
+      if (fBulkReader) {
+         if (const char *values = fBulkReader->GetEntry()) {
+            std::memcpy(fBulkValue, values, sizeof(T));
+            return fBulkValue;
+         }
+      }
+      return fTreeValue->Get();
+   }
 
-   void *GetImpl(Long64_t) final { return fTreeValue->Get(); }
 public:
    /// Construct the RTreeColumnReader. Actual initialization is performed lazily by the Init method.
    RTreeColumnReader(TTreeReader &r, const std::string &colName)
-      : fTreeValue(std::make_unique<TTreeReaderValue<T>>(r, colName.c_str()))
+      : fTreeValue(std::make_unique<TTreeReaderValue<T>>(r, colName.c_str())),
+        fBulkReader(RTreeBulkReader::Create(r, colName, typeid(T), /*readsArrays=*/false))
    {
    }
 
@@ -70,8 +157,37 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<T>> final : public RColumnRe
    /// Whether we already printed a warning about performing a copy of the TTreeReaderArray contents
    bool fCopyWarningPrinted = false;
 
+   /// Reads fixed-size arrays and collections of fundamental types basket by basket; entries that it cannot serve are
+   /// read by fTreeArray
+   std::unique_ptr<RTreeBulkReader> fBulkReader;
+   /// Aligned copy of the current values served by the bulk reader, used if the basket buffer is misaligned
+   RVec<T> fBulkValues;
+
+   void *GetBulkEntry()
+   {
+      const char *values = fBulkReader->GetEntry();
+      if (!values)
+         return nullptr;
+      const auto nValues = fBulkReader->GetNValues();
+      if (reinterpret_cast<std::uintptr_t>(values) % alignof(T) == 0) {
+         RVec<T> rvec(reinterpret_cast<T *>(const_cast<char *>(values)), nValues);
+         std::swap(fRVec, rvec);
+      } else {
+         fBulkValues.resize(nValues);
+         std::memcpy(static_cast<void *>(fBulkValues.data()), values, nValues * sizeof(T));
+         RVec<T> rvec(fBulkValues.data(), nValues);
+         std::swap(fRVec, rvec);
+      }
+      return &fRVec;
+   }
+
    void *GetImpl(Long64_t) final
    {
+      if (fBulkReader) {
+         if (auto rvec = GetBulkEntry())
+            return rvec;
+      }
+
       auto &readerArray = *fTreeArray;
       // We only use TTreeReaderArrays to read columns that users flagged as type `RVec`, so we need to check
       // that the branch stores the array as contiguous memory that we can actually wrap in an `RVec`.
@@ -129,7 +245,8 @@ class R__CLING_PTRCHECK(off) RTreeColumnReader<RVec<T>> final : public RColumnRe
 
 public:
    RTreeColumnReader(TTreeReader &r, const std::string &colName)
-      : fTreeArray(std::make_unique<TTreeReaderArray<T>>(r, colName.c_str()))
+      : fTreeArray(std::make_unique<TTreeReaderArray<T>>(r, colName.c_str())),
+        fBulkReader(RTreeBulkReader::Create(r, colName, typeid(T), /*readsArrays=*/true))
    {
    }
 
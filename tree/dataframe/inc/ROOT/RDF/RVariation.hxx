@@ -0,0 +1,132 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RVARIATION
+#define ROOT_RVARIATION
+
+#include "ROOT/RDF/ColumnReaderUtils.hxx"
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
+#include "ROOT/RDF/Utils.hxx"
+#include "ROOT/RIntegerSequence.hxx"
+#include "ROOT/RStringView.hxx"
+#include "ROOT/TypeTraits.hxx"
+#include "RtypesCore.h"
+
+#include <array>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace Detail {
+namespace RDF {
+
+using namespace ROOT::TypeTraits;
+
+/// The node that computes the alternative values of a column registered with Vary().
+/// The expression takes the values of the input columns and returns an RVec with one value of the varied column per
+/// variation tag.
+template <typename F>
+class RVariation final : public RVariationBase {
+   using ColumnTypes_t = typename CallableTraits<F>::arg_types;
+   using TypeInd_t = std::make_index_sequence<ColumnTypes_t::list_size>;
+   using ret_type = typename std::decay<typename CallableTraits<F>::ret_type>::type;
+   static_assert(RDFInternal::IsRVec_t<ret_type>::value,
+                 "The expression passed to Vary must return an RVec with the values of all the variations.");
+   using value_type = typename ret_type::value_type;
+
+   F fExpression;
+   const ColumnNames_t fColumnNames;
+   /// The values of all the tags, for all the slots. Elements of a deque do not move, so that the readers of the varied
+   /// columns can keep their address; a deque also avoids the std::vector<bool> specialization.
+   std::deque<value_type> fLastResults;
+
+   /// Column readers per slot and per input column
+   std::vector<std::array<std::unique_ptr<RDFInternal::RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
+
+   /// The nth flag signals whether the nth input column is a custom column or not.
+   std::array<bool, ColumnTypes_t::list_size> fIsDefine;
+
+   template <typename... ColTypes, std::size_t... S>
+   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
+   {
+      auto results = fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
+      const auto nTags = fTags.size();
+      if (results.size() != nTags) {
+         throw std::runtime_error("The expression of the variation \"" + fVariationName + "\" of column \"" +
+                                  fColumnName + "\" returned " + std::to_string(results.size()) +
+                                  " values, but the variation has " + std::to_string(nTags) + " tags.");
+      }
+      for (std::size_t i = 0; i < nTags; ++i)
+         fLastResults[slot * nTags + i] = std::move(results[i]);
+      // silence "unused parameter" warnings in gcc
+      (void)entry;
+   }
+
+public:
+   RVariation(std::string_view colName, std::string_view variationName, const std::vector<std::string> &tags,
+              std::string_view type, F expression, const ColumnNames_t &columns, unsigned int nSlots,
+              const RDFInternal::RBookedDefines &defines,
+              const std::map<std::string, std::vector<void *>> &DSValuePtrs)
+      : RVariationBase(colName, variationName, tags, type, nSlots, defines, DSValuePtrs),
+        fExpression(std::move(expression)), fColumnNames(columns), fLastResults(fNSlots * fTags.size()),
+        fValues(fNSlots), fIsDefine()
+   {
+      const auto nColumns = fColumnNames.size();
+      for (auto i = 0u; i < nColumns; ++i)
+         fIsDefine[i] = fDefines.HasName(fColumnNames[i]);
+   }
+
+   void InitSlot(TTreeReader *r, unsigned int slot) final
+   {
+      if (!fIsInitialized[slot]) {
+         fIsInitialized[slot] = true;
+         RDFInternal::RColumnReadersInfo info{fColumnNames, fDefines, fIsDefine.data(), fDSValuePtrs};
+         fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info);
+         fLastCheckedEntry[slot] = -1;
+      }
+   }
+
+   void *GetValuePtr(unsigned int slot, std::size_t tagIdx) final
+   {
+      return static_cast<void *>(&fLastResults[slot * fTags.size() + tagIdx]);
+   }
+
+   void Update(unsigned int slot, Long64_t entry) final
+   {
+      if (entry != fLastCheckedEntry[slot]) {
+         // evaluate the expression once for all the tags, cache the results
+         UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+         fLastCheckedEntry[slot] = entry;
+      }
+   }
+
+   const std::type_info &GetTypeId() const final { return typeid(value_type); }
+
+   void FinaliseSlot(unsigned int slot) final
+   {
+      if (fIsInitialized[slot]) {
+         for (auto &v : fValues[slot])
+            v.reset();
+         fIsInitialized[slot] = false;
+      }
+   }
+};
+
+} // ns RDF
+} // ns Detail
+} // ns ROOT
+
+#endif // ROOT_RVARIATION
@@ -0,0 +1,83 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RVARIATIONBASE
+#define ROOT_RVARIATIONBASE
+
+#include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RStringView.hxx"
+#include "RtypesCore.h"
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace Detail {
+namespace RDF {
+
+namespace RDFInternal = ROOT::Internal::RDF;
+
+class RDefineBase;
+
+/// Base class for the nodes that compute the alternative values of a column registered with Vary().
+/// For each entry, the expression is evaluated once and yields the values of the column for all the tags of the
+/// variation. The nodes downstream read the value of one tag through the column returned by GetVariedColumn().
+class RVariationBase {
+protected:
+   const std::string fColumnName;                 ///< The name of the varied column
+   const std::string fVariationName;              ///< The name of the variation, e.g. "pt_scale"
+   const std::vector<std::string> fTags;          ///< The tags of the variation, e.g. {"down", "up"}
+   const std::vector<std::string> fVariationNames; ///< The full names of the variations, e.g. {"pt_scale:down", ...}
+   const std::string fType;                       ///< The type of the varied column as a text string
+   const unsigned int fNSlots;                    ///< Number of thread slots used by this node.
+   std::vector<Long64_t> fLastCheckedEntry;
+   RDFInternal::RBookedDefines fDefines;
+   std::deque<bool> fIsInitialized; // because vector<bool> is not thread-safe
+   const std::map<std::string, std::vector<void *>> &fDSValuePtrs; // reference to RLoopManager's data member
+   /// Columns that expose the values of each tag to the downstream nodes, created on demand
+   std::vector<std::shared_ptr<RDefineBase>> fVariedColumns;
+
+public:
+   RVariationBase(std::string_view colName, std::string_view variationName, const std::vector<std::string> &tags,
+                  std::string_view type, unsigned int nSlots, const RDFInternal::RBookedDefines &defines,
+                  const std::map<std::string, std::vector<void *>> &DSValuePtrs);
+   RVariationBase(const RVariationBase &) = delete;
+   RVariationBase &operator=(const RVariationBase &) = delete;
+   virtual ~RVariationBase();
+
+   virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
+   /// Return the (type-erased) address of the value of the varied column for the given slot and tag index.
+   virtual void *GetValuePtr(unsigned int slot, std::size_t tagIdx) = 0;
+   virtual const std::type_info &GetTypeId() const = 0;
+   /// Update the values at the addresses returned by GetValuePtr with the content corresponding to the given entry
+   virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Clean-up operations to be performed at the end of a task.
+   virtual void FinaliseSlot(unsigned int slot) = 0;
+
+   const std::string &GetColumnName() const { return fColumnName; }
+   const std::string &GetVariationName() const { return fVariationName; }
+   std::string GetTypeName() const { return fType; }
+   /// Return the full names of the variations, in the form "variation:tag".
+   const std::vector<std::string> &GetVariationNames() const { return fVariationNames; }
+   /// Return a column that reads the values of the varied column for the given variation ("variation:tag").
+   std::shared_ptr<RDefineBase> GetVariedColumn(const std::string &variationName);
+};
+
+} // ns RDF
+} // ns Detail
+} // ns ROOT
+
+#endif // ROOT_RVARIATIONBASE
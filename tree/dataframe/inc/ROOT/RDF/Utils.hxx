@@ -191,6 +191,9 @@ Long64_t InterpreterCalc(const std::string &code, const std::string &context = "
 /// Whether custom column with name colName is an "internal" column such as rdfentry_ or rdfslot_
 bool IsInternalColumn(std::string_view colName);
 
+/// Return the elements of `v1` followed by the elements of `v2` that are not already present, without duplicates
+std::vector<std::string> Union(const std::vector<std::string> &v1, const std::vector<std::string> &v2);
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
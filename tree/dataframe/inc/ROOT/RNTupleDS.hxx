@@ -24,6 +24,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace ROOT {
@@ -52,6 +53,18 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    std::vector<DescriptorId_t> fColumnFieldIds;
    std::vector<size_t> fActiveColumns;
 
+   /// A value range of a column used to skip clusters, see SkipClustersOutside()
+   struct RClusterCut {
+      DescriptorId_t fColumnId;
+      double fMin;
+      double fMax;
+   };
+   std::vector<RClusterCut> fClusterCuts;
+
+   /// The cluster-aligned entry ranges of the current event loop, sorted by first entry; used to tell the page
+   /// source of a slot which entries it is going to process
+   std::vector<std::pair<ULong64_t, ULong64_t>> fEntryRanges;
+
    unsigned fNSlots = 0;
    bool fHasSeenAllRanges = false;
 
@@ -66,8 +79,15 @@ public:
    std::string GetTypeName(std::string_view colName) const final;
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
 
+   void InitSlot(unsigned int slot, ULong64_t firstEntry) final;
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
 
+   /// Only provide the entries of clusters that, according to the cluster statistics, may contain values of the
+   /// given numeric column in [min, max].  Used to push down a simple cut of a subsequent Filter() into the data
+   /// source.  The data source may still provide entries outside the range, so the filter itself must still be
+   /// applied.  Requires that the ntuple was written with RNTupleWriteOptions::SetWriteColumnStats().
+   void SkipClustersOutside(std::string_view colName, double min, double max);
+
    void Initialise() final;
    void Finalise() final;
 
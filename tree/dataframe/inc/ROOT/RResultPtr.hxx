@@ -33,6 +33,15 @@ namespace RDF {
 // Fwd decl for MakeResultPtr
 template <typename T>
 class RResultPtr;
+
+namespace Experimental {
+// Fwd decl for VariationsFor
+template <typename T>
+class RResultMap;
+
+template <typename T>
+RResultMap<T> VariationsFor(RResultPtr<T> resPtr);
+} // namespace Experimental
 } // namespace RDF
 
 namespace Detail {
@@ -100,6 +109,7 @@ class RResultPtr {
    template <class T1>
    friend bool operator!=(std::nullptr_t lhs, const RResultPtr<T1> &rhs);
    friend std::unique_ptr<RDFDetail::RMergeableValue<T>> RDFDetail::GetMergeableValue<T>(RResultPtr<T> &rptr);
+   friend ROOT::RDF::Experimental::RResultMap<T> ROOT::RDF::Experimental::VariationsFor<T>(RResultPtr<T> resPtr);
 
    friend class ROOT::Internal::RDF::GraphDrawing::GraphCreatorHelper;
 
@@ -18,6 +18,13 @@
 namespace ROOT {
 
 namespace RDF {
+/// The data format of the dataset written by Snapshot
+enum class ESnapshotOutputFormat {
+   kDefault, ///< Currently TTree
+   kTTree,
+   kRNTuple ///< Requires ROOT to be built with root7, experimental
+};
+
 /// A collection of options to steer the creation of the dataset on file
 struct RSnapshotOptions {
    using ECAlgo = ROOT::ECompressionAlgorithm;
@@ -37,6 +44,9 @@ struct RSnapshotOptions {
    int fSplitLevel = 99;                       ///< Split level of output tree
    bool fLazy = false;                         ///< Do not start the event loop when Snapshot is called
    bool fOverwriteIfExists = false; ///< If fMode is "UPDATE", overwrite object in output file if it already exists
+   /// Data format of the output dataset. With kRNTuple, as with kTTree, multi-thread event loops write the entries in
+   /// an undefined order: each slot appends whole clusters as it fills them.
+   ESnapshotOutputFormat fOutputFormat = ESnapshotOutputFormat::kDefault;
 };
 } // ns RDF
 } // ns ROOT
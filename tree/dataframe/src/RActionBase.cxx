@@ -11,6 +11,8 @@
 #include "ROOT/RDF/RActionBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 
+#include <stdexcept>
+
 using namespace ROOT::Internal::RDF;
 
 RActionBase::RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const RBookedDefines &defines)
@@ -18,3 +20,11 @@ RActionBase::RActionBase(RLoopManager *lm, const ColumnNames_t &colNames, const
 
 // outlined to pin virtual table
 RActionBase::~RActionBase() {}
+
+std::unique_ptr<RActionBase>
+RActionBase::MakeVariedAction(const std::string &variationName, const std::shared_ptr<void> &variedResult)
+{
+   if (!fVariedActionFactory)
+      throw std::logic_error("This action does not support systematic variations.");
+   return fVariedActionFactory(variationName, variedResult);
+}
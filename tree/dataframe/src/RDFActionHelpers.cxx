@@ -9,6 +9,10 @@
  *************************************************************************/
 
 #include "ROOT/RDF/ActionHelpers.hxx"
+#include "TString.h"
+#include "TSystem.h"
+
+#include <atomic>
 
 namespace ROOT {
 namespace Internal {
@@ -264,6 +268,13 @@ void ValidateSnapshotOutput(const RSnapshotOptions &opts, const std::string &tre
    }
 }
 
+std::string MakeCacheFileName(const std::string &dir)
+{
+   static std::atomic<unsigned int> nFiles{0};
+   const std::string fileDir = dir.empty() ? gSystem->TempDirectory() : dir;
+   return TString::Format("%s/rdfcache_%d_%u.root", fileDir.c_str(), gSystem->GetPid(), nFiles++).Data();
+}
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
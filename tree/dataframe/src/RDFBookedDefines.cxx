@@ -1,4 +1,7 @@
 #include "ROOT/RDF/RBookedDefines.hxx"
+#include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // Union
 
 namespace ROOT {
 namespace Internal {
@@ -24,6 +27,53 @@ void RBookedDefines::AddName(std::string_view name)
    fDefinesNames = newColsNames;
 }
 
+void RBookedDefines::AddVariation(const std::shared_ptr<RDFDetail::RVariationBase> &variation)
+{
+   auto newVariations = std::make_shared<RVariationBasePtrMap_t>(GetVariations());
+   (*newVariations)[variation->GetColumnName()] = variation;
+   fVariations = newVariations;
+}
+
+RBookedDefines::ColumnNames_t RBookedDefines::GetVariationDeps(const ColumnNames_t &columns) const
+{
+   ColumnNames_t variations;
+   for (const auto &column : columns) {
+      const auto variationIt = fVariations->find(column);
+      if (variationIt != fVariations->end())
+         variations = Union(variations, variationIt->second->GetVariationNames());
+      // a defined column depends on the variations of its own input columns
+      const auto defineIt = fDefines->find(column);
+      if (defineIt != fDefines->end())
+         variations = Union(variations, defineIt->second->GetVariations());
+   }
+   return variations;
+}
+
+RBookedDefines RBookedDefines::GetVaried(const std::string &variationName) const
+{
+   auto newCols = std::make_shared<RDefineBasePtrMap_t>(GetColumns());
+   auto newColsNames = std::make_shared<ColumnNames_t>(GetNames());
+
+   for (auto &column : *newCols) {
+      const auto variations = column.second->GetVariations();
+      if (std::find(variations.begin(), variations.end(), variationName) != variations.end())
+         column.second = column.second->GetVariedDefine(variationName);
+   }
+
+   // varied columns read the values of the variation instead of the nominal ones, be they defined columns or not
+   for (const auto &variation : *fVariations) {
+      const auto &variationNames = variation.second->GetVariationNames();
+      if (std::find(variationNames.begin(), variationNames.end(), variationName) == variationNames.end())
+         continue;
+      const auto &colName = variation.first;
+      (*newCols)[colName] = variation.second->GetVariedColumn(variationName);
+      if (!HasName(colName))
+         newColsNames->emplace_back(colName);
+   }
+
+   return RBookedDefines(newCols, newColsNames, fVariations);
+}
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
@@ -17,11 +17,16 @@
 #include <TChain.h>
 #include <TClass.h>
 #include <TClassEdit.h>
+#include <TEnv.h>
+#include <TError.h> // Warning
 #include <TFriendElement.h>
 #include <TInterpreter.h>
+#include <TMD5.h>
 #include <TObject.h>
 #include <TPRegexp.h>
+#include <TROOT.h>
 #include <TString.h>
+#include <TSystem.h>
 #include <TTree.h>
 
 // pragma to disable warnings on Rcpp which have
@@ -37,11 +42,15 @@
 #endif
 
 #include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iterator>
 #include <set>
 #include <stdexcept>
 #include <string>
 #include <sstream>
 #include <typeinfo>
+#include <unordered_map>
 
 namespace ROOT {
 namespace Detail {
@@ -61,6 +70,7 @@ class RDataSource;
 
 namespace {
 using ROOT::Detail::RDF::ColumnNames_t;
+using ROOT::Detail::RDF::RLoopManager;
 
 /// A string expression such as those passed to Filter and Define, digested to a standardized form
 struct ParsedExpression {
@@ -216,9 +226,90 @@ BuildLambdaString(const std::string &expr, const ColumnNames_t &vars, const Colu
    return ss.str();
 }
 
+/// Return the static global map from the names of the jitted lambdas to their return types.
+static std::unordered_map<std::string, std::string> &GetJittedRetTypes()
+{
+   static std::unordered_map<std::string, std::string> retTypes;
+   return retTypes;
+}
+
+/// Each jitted lambda comes with a lambda_ret_t type alias for its return type.
+/// Resolve that alias and return the true type as string.
+static std::string RetTypeOfLambda(const std::string &lambdaName)
+{
+   auto &retTypes = GetJittedRetTypes();
+   const auto retTypeIt = retTypes.find(lambdaName);
+   if (retTypeIt != retTypes.end())
+      return retTypeIt->second;
+
+   auto *ti = gInterpreter->TypedefInfo_Factory((lambdaName + "_ret_t").c_str());
+   const std::string type = gInterpreter->TypedefInfo_TrueName(ti);
+   gInterpreter->TypedefInfo_Delete(ti);
+   retTypes.insert({lambdaName, type});
+   return type;
+}
+
+/// The persistent return type cache stores the return types of the jitted lambdas, which are otherwise only known
+/// after the interpreter declared them. It does not store compiled code: the lambdas are compiled in every process.
+/// It is enabled by setting RDataFrame.ReturnTypeCacheDir to the cache directory.
+/// Each entry is a file whose name is the MD5 hash of its key, the lambda expression (which includes the column
+/// types) and the ROOT version. It contains the return type on the first line, followed by the key.
+static std::string GetRetTypeCacheEntryName(const std::string &lambdaExpr, std::string &key)
+{
+   key = std::to_string(gROOT->GetVersionCode()) + ' ' + gROOT->GetGitCommit() + '\n' + lambdaExpr;
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+   md5.Final();
+   return std::string(md5.AsString()) + ".rdfrettype";
+}
+
+/// The directory might be shared with other users: a stored type is only accepted if it can be nothing but the
+/// spelling of a type, i.e. it cannot inject code into the declarations it is pasted into.
+static bool IsValidCachedRetType(const std::string &retType)
+{
+   if (retType.empty() || retType.size() > 1024)
+      return false;
+   return std::all_of(retType.begin(), retType.end(), [](char c) {
+      return std::isalnum(static_cast<unsigned char>(c)) || std::string("_:<>,*& ").find(c) != std::string::npos;
+   });
+}
+
+static bool ReadRetTypeCacheEntry(const std::string &path, const std::string &key, std::string &retType)
+{
+   std::ifstream file(path);
+   if (!file || !std::getline(file, retType))
+      return false;
+   const std::string storedKey{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+   return storedKey == key && IsValidCachedRetType(retType);
+}
+
+static void WriteRetTypeCacheEntry(const std::string &cacheDir, const std::string &path, const std::string &key,
+                                   const std::string &retType)
+{
+   // Jobs sharing the cache must never read a partially written entry
+   const auto tmpPath = path + "." + std::to_string(gSystem->GetPid()) + ".tmp";
+   gSystem->mkdir(cacheDir.c_str(), /*recursive=*/true);
+   {
+      std::ofstream file(tmpPath);
+      file << retType << '\n' << key;
+      if (!file) {
+         Warning("RDataFrame::Jit", "Cannot write to the return type cache directory %s", cacheDir.c_str());
+         gSystem->Unlink(tmpPath.c_str());
+         return;
+      }
+   }
+   if (gSystem->Rename(tmpPath.c_str(), path.c_str()) != 0)
+      gSystem->Unlink(tmpPath.c_str());
+}
+
 /// Declare a lambda expression to the interpreter in namespace __rdf, return the name of the jitted lambda.
 /// If the lambda expression is already in GetJittedExprs, return the name for the lambda that has already been jitted.
-static std::string DeclareLambda(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
+/// If the return type of the lambda is found in the return type cache, the definition of the lambda is deferred until
+/// lm jits its nodes, together with them, possibly in the background. The cached type is verified first, with a
+/// declaration of the return type that does not generate code; a stale entry is replaced and the lambda is declared
+/// right away, as without the cache.
+static std::string
+DeclareLambda(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes, RLoopManager &lm)
 {
    const auto lambdaExpr = BuildLambdaString(expr, vars, varTypes);
    auto &exprMap = GetJittedExprs();
@@ -233,27 +324,47 @@ static std::string DeclareLambda(const std::string &expr, const ColumnNames_t &v
    const auto lambdaBaseName = "lambda" + std::to_string(exprMap.size());
    const auto lambdaFullName = "__rdf::" + lambdaBaseName;
 
-   const auto toDeclare = "namespace __rdf {\nauto " + lambdaBaseName + " = " + lambdaExpr + ";\nusing " +
-                          lambdaBaseName + "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(" +
-                          lambdaBaseName + ")>::ret_type;\n}";
-   ROOT::Internal::RDF::InterpreterDeclare(toDeclare.c_str());
+   const auto lambdaDecl = "namespace __rdf {\nauto " + lambdaBaseName + " = " + lambdaExpr + ";\n";
+   const auto toDeclare = lambdaDecl + "using " + lambdaBaseName +
+                          "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(" + lambdaBaseName +
+                          ")>::ret_type;\n}";
+
+   const std::string cacheDir = gEnv->GetValue("RDataFrame.ReturnTypeCacheDir", "");
+   std::string cacheKey;
+   std::string cachePath;
+   std::string cachedRetType;
+   if (!cacheDir.empty()) {
+      cachePath = cacheDir + "/" + GetRetTypeCacheEntryName(lambdaExpr, cacheKey);
+      if (ReadRetTypeCacheEntry(cachePath, cacheKey, cachedRetType)) {
+         // The return type of a function called by the expression might have changed since the entry was written.
+         // An inline function with the body of the lambda tells the return type without generating code.
+         const auto checkName = lambdaBaseName + "_check";
+         ROOT::Internal::RDF::InterpreterDeclare(
+            "namespace __rdf {\ninline auto " + checkName + lambdaExpr.substr(2) + "\nusing " + checkName +
+            "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(&" + checkName + ")>::ret_type;\n}");
+         if (RetTypeOfLambda("__rdf::" + checkName) == cachedRetType) {
+            lm.ToJitDeclare(lambdaDecl + "using " + lambdaBaseName + "_ret_t = " + checkName + "_ret_t;\n}");
+            exprMap.insert({lambdaExpr, lambdaFullName});
+            GetJittedRetTypes().insert({lambdaFullName, cachedRetType});
+            return lambdaFullName;
+         }
+         // The entry is stale: declare the lambda now and replace the entry
+      }
+   }
+
+   ROOT::Internal::RDF::InterpreterDeclare(toDeclare);
 
    // InterpreterDeclare could throw. If it doesn't, mark the lambda as already jitted
    exprMap.insert({lambdaExpr, lambdaFullName});
 
-   return lambdaFullName;
-}
+   // Types without a name that can be spelled, e.g. those of lambdas, cannot be cached
+   const auto retType = RetTypeOfLambda(lambdaFullName);
+   if (!cachePath.empty() && retType != cachedRetType && IsValidCachedRetType(retType))
+      WriteRetTypeCacheEntry(cacheDir, cachePath, cacheKey, retType);
 
-/// Each jitted lambda comes with a lambda_ret_t type alias for its return type.
-/// Resolve that alias and return the true type as string.
-static std::string RetTypeOfLambda(const std::string &lambdaName)
-{
-   auto *ti = gInterpreter->TypedefInfo_Factory((lambdaName + "_ret_t").c_str());
-   const char *type = gInterpreter->TypedefInfo_TrueName(ti);
-   return type;
+   return lambdaFullName;
 }
 
-
 static void GetTopLevelBranchNamesImpl(TTree &t, std::set<std::string> &bNamesReg, ColumnNames_t &bNames,
                                        std::set<TTree *> &analysedTrees)
 {
@@ -336,6 +447,13 @@ HeadNode_t CreateSnapshotRDF(const ColumnNames_t &validCols,
    // create new RDF
    ::TDirectory::TContext ctxt;
    auto snapshotRDF = std::make_shared<ROOT::RDataFrame>(treeName, fileName, validCols);
+   return CreateSnapshotRDF(snapshotRDF, isLazy, loopManager, std::move(actionPtr));
+}
+
+/// Return the result of a Snapshot whose action already created the RDataFrame that reads the output
+HeadNode_t CreateSnapshotRDF(const std::shared_ptr<ROOT::RDataFrame> &snapshotRDF, bool isLazy,
+                             RLoopManager &loopManager, std::unique_ptr<RDFInternal::RActionBase> actionPtr)
+{
    auto snapshotRDFResPtr = MakeResultPtr(snapshotRDF, loopManager, std::move(actionPtr));
 
    if (!isLazy) {
@@ -451,6 +569,25 @@ void CheckDefine(std::string_view definedCol, TTree *treePtr, const ColumnNames_
    }
 }
 
+/// Throw if the values returned by the expression of a Vary do not have the type of the varied column.
+void CheckVariedType(const std::string &colName, const std::string &colTypeName, const std::type_info &variedType)
+{
+   const auto variedTypeName = TypeID2TypeName(variedType);
+   if (!variedTypeName.empty() && variedTypeName == colTypeName)
+      return;
+
+   // the column type might be spelled differently, e.g. "Double_t" for a double branch
+   try {
+      if (TypeName2TypeID(colTypeName) == variedType)
+         return;
+   } catch (const std::runtime_error &) {
+   }
+
+   const auto printedTypeName = variedTypeName.empty() ? DemangleTypeIdName(variedType) : variedTypeName;
+   throw std::runtime_error("Vary: the expression returns values of type " + printedTypeName + " but column \"" +
+                            colName + "\" has type " + colTypeName + ".");
+}
+
 void CheckTypesAndPars(unsigned int nTemplateParams, unsigned int nColumnNames)
 {
    if (nTemplateParams != nColumnNames) {
@@ -535,7 +672,8 @@ void BookFilterJit(const std::shared_ptr<RJittedFilter> &jittedFilter,
       ParseRDFExpression(std::string(expression), branches, customCols.GetNames(), dsColumns, aliasMap);
    const auto exprVarTypes =
       GetValidatedArgTypes(parsedExpr.fUsedCols, customCols, tree, ds, "Filter", /*vector2rvec=*/true);
-   const auto lambdaName = DeclareLambda(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
+   auto lm = jittedFilter->GetLoopManagerUnchecked();
+   const auto lambdaName = DeclareLambda(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes, *lm);
    const auto type = RetTypeOfLambda(lambdaName);
    if (type != "bool")
       std::runtime_error("Filter: the following expression does not evaluate to bool:\n" + std::string(expression));
@@ -564,7 +702,6 @@ void BookFilterJit(const std::shared_ptr<RJittedFilter> &jittedFilter,
                     << "reinterpret_cast<ROOT::Internal::RDF::RBookedDefines*>(" << definesOnHeapAddr << ")"
                     << ");\n";
 
-   auto lm = jittedFilter->GetLoopManagerUnchecked();
    lm->ToJitExec(filterInvocation.str());
 }
 
@@ -582,7 +719,7 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
       ParseRDFExpression(std::string(expression), branches, customCols.GetNames(), dsColumns, aliasMap);
    const auto exprVarTypes =
       GetValidatedArgTypes(parsedExpr.fUsedCols, customCols, tree, ds, "Define", /*vector2rvec=*/true);
-   const auto lambdaName = DeclareLambda(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
+   const auto lambdaName = DeclareLambda(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes, lm);
    const auto type = RetTypeOfLambda(lambdaName);
 
    auto definesCopy = new RDFInternal::RBookedDefines(customCols);
@@ -24,6 +24,7 @@
 #include "TROOT.h" // IsImplicitMTEnabled, GetThreadPoolSize
 #include "TTree.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <string>
 #include <cstring>
@@ -334,6 +335,19 @@ bool IsInternalColumn(std::string_view colName)
    return goodPrefix && '_' == colName.back();                 // also ends with '_'
 }
 
+std::vector<std::string> Union(const std::vector<std::string> &v1, const std::vector<std::string> &v2)
+{
+   std::vector<std::string> res;
+   res.reserve(v1.size() + v2.size());
+   for (const auto *v : {&v1, &v2}) {
+      for (const auto &s : *v) {
+         if (std::find(res.begin(), res.end(), s) == res.end())
+            res.emplace_back(s);
+      }
+   }
+   return res;
+}
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
@@ -70,6 +70,7 @@ Transformations are a way to manipulate the data.
 | [DefineSlotEntry](classROOT_1_1RDF_1_1RInterface.html#a4f17074d5771916e3df18f8458186de7) | Same as `DefineSlot`, but the entry number is passed in addition to the slot number. This is meant as a helper in case some dependency on the entry number needs to be honoured. |
 | [Filter](classROOT_1_1RDF_1_1RInterface.html#a70284a3bedc72b19610aaa91b5007ebd) | Filter the rows of the dataset. |
 | [Range](classROOT_1_1RDF_1_1RInterface.html#a1b36b7868831de2375e061bb06cfc225) | Creates a node that filters entries based on range of entries |
+| [Vary](classROOT_1_1RDF_1_1RInterface.html) | Registers systematic variations of a column. `ROOT::RDF::Experimental::VariationsFor` then returns the results of an action for all the variations, computed in the same event loop as the nominal one. |
 
 ### Actions
 Actions are a way to produce a result out of the data. Each one is described in more detail in the reference guide.
@@ -85,7 +86,7 @@ produce several different results in one event loop. Instant actions trigger the
 |------------------|-----------------|
 | [Aggregate](classROOT_1_1RDF_1_1RInterface.html#ae540b00addc441f9b504cbae0ef0a24d) | Execute a user-defined accumulation operation on the processed column values. |
 | [Book](classROOT_1_1RDF_1_1RInterface.html#a9b2f61f3333d1669e57055b9ae8be9d9) | Book execution of a custom action using a user-defined helper object. |
-| [Cache](classROOT_1_1RDF_1_1RInterface.html#aaaa0a7bb8eb21315d8daa08c3e25f6c9) | Caches in contiguous memory columns' entries. Custom columns can be cached as well, filtered entries are not cached. Users can specify which columns to save (default is all). |
+| [Cache](classROOT_1_1RDF_1_1RInterface.html#aaaa0a7bb8eb21315d8daa08c3e25f6c9) | Caches in contiguous memory columns' entries. Custom columns can be cached as well, filtered entries are not cached. Users can specify which columns to save (default is all), and a memory budget beyond which the cached entries are spilled to a scratch file. |
 | [Count](classROOT_1_1RDF_1_1RInterface.html#a37f9e00c2ece7f53fae50b740adc1456) | Return the number of events processed. |
 | [Display](classROOT_1_1RDF_1_1RInterface.html#aee68f4411f16f00a1d46eccb6d296f01) | Obtains the events in the dataset for the requested columns. The method returns a [RDisplay](classROOT_1_1RDF_1_1RDisplay.html) instance which can be queried to get a compressed tabular representation on the standard output or a complete representation as a string. |
 | [Fill](classROOT_1_1RDF_1_1RInterface.html#a0cac4d08297c23d16de81ff25545440a) | Fill a user-defined object with the values of the specified branches, as if by calling `Obj.Fill(branch1, branch2, ...). |
@@ -121,6 +122,7 @@ produce several different results in one event loop. Instant actions trigger the
 | [Display](classROOT_1_1RDF_1_1RInterface.html#a652f9ab3e8d2da9335b347b540a9a941) | Provides an ASCII representation of the columns types and contents of the dataset printable by the user. |
 | [SaveGraph](namespaceROOT_1_1RDF.html#adc17882b283c3d3ba85b1a236197c533) | Store the computation graph of an RDataFrame in graphviz format for easy inspection. |
 | [GetNRuns](classROOT_1_1RDF_1_1RInterface.html#adfb0562a9f7732c3afb123aefa07e0df) | Get the number of event loops run by this RDataFrame instance. |
+| [SetBulkSize](classROOT_1_1RDF_1_1RInterface.html) | Process the entries in bulks rather than one at a time, see [Bulk mode](#bulk-mode). |
 
 
 ## <a name="introduction"></a>Introduction
@@ -827,6 +829,7 @@ More specifically, the dataset will be divided in batches of entries, and thread
 processing of these batches. There are no guarantees on the order the batches are processed, i.e. no guarantees in the
 order entries of the dataset are processed. Note that this in turn means that, for multi-thread event loops, there is no
 guarantee on the order in which `Snapshot` will _write_ entries: they could be scrambled with respect to the input dataset.
+This holds for both TTree and RNTuple output.
 
 \warning RDataFrame will by default start as many threads as the hardware supports, using up **all** the resources on
 a machine. On a worker node of *e.g.* a batch cluster, this might not be desired if the machine is shared with other
@@ -856,6 +859,46 @@ will never receive the same slot at the same time.
 This extra parameter might facilitate writing safe parallel code by having each thread write/modify a different
 *processing slot*, e.g. a different element of a list. See [here](#generic-actions) for an example usage of `ForeachSlot`.
 
+### <a name="bulk-mode"></a>Bulk mode
+By default, each node of the computation graph processes one entry at a time: for every entry, each action asks the
+nodes upstream whether the entry passes their filters and reads the values of its columns, with several virtual calls
+per node. After a call to `SetBulkSize(n)`, the event loop instead collects `n` entries, then each node processes them
+at once: `Define` and `Filter` expressions are evaluated in a loop over arrays of values, filters pass a mask of the
+selected entries downstream and actions are filled with the selected entries.
+~~~{.cpp}
+ROOT::RDataFrame df("tree", "file.root");
+df.SetBulkSize(256);
+auto h = df.Define("pt", "sqrt(px*px + py*py)").Filter("pt > 10").Histo1D("pt");
+~~~
+Results do not change: expressions are only evaluated for the entries that pass the filters upstream, in the same order,
+and the branches of a TTree are only read for those entries. The values of the columns of a data source, however, are
+copied for all entries. Whether bulk mode pays off depends on the computation graph: the tutorial
+[df032_BulkMode.C](df032__BulkMode_8C.html) compares the two modes. `Snapshot` and systematic variations are not
+supported in bulk mode.
+
+### <a name="jitting"></a>Just-in-time compilation of string expressions
+`Filter` and `Define` expressions passed as strings, as well as actions whose column types are deduced at runtime, are
+compiled by the interpreter. Each expression is declared to the interpreter when it is booked, because the type of the
+column it defines is needed to book the nodes downstream; the nodes themselves are compiled all together when the event
+loop starts. Two settings in `.rootrc` change when the interpreter does this work:
+- `RDataFrame.ReturnTypeCacheDir: <directory>` enables a persistent cache of the return types of the expressions, keyed
+  by the expression, the types of the columns it uses and the ROOT version. It does not store compiled code: expressions
+  found in the cache are still compiled in every process, but together with the nodes instead of one by one when they
+  are booked. The cached type is checked against the expression when it is booked, which does not generate code: if a
+  function called by the expression changed its return type, the expression is compiled as without the cache and the
+  stale entry is replaced.
+- `RDataFrame.BackgroundJit: 1` compiles the booked nodes in a background thread while the application books further
+  nodes, opens files, etc. It requires a prior call to `ROOT::EnableThreadSafety()`. The event loop waits for the
+  compilation to complete; if part of the code fails to compile, the nodes that compiled are still added to their
+  computation graphs and the error is reported.
+~~~{.cpp}
+gEnv->SetValue("RDataFrame.ReturnTypeCacheDir", "/scratch/rdfrettypes");
+gEnv->SetValue("RDataFrame.BackgroundJit", 1);
+ROOT::EnableThreadSafety();
+ROOT::RDataFrame df("tree", "file.root");
+auto h = df.Define("pt", "sqrt(px*px + py*py)").Filter("pt > 10").Histo1D("pt");
+~~~
+
 <a name="reference"></a>
 */
 // clang-format on
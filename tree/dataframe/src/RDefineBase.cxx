@@ -12,6 +12,7 @@
 #include "ROOT/RStringView.hxx"
 #include "RtypesCore.h" // Long64_t
 
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -45,3 +46,23 @@ std::string RDefineBase::GetTypeName() const
 {
    return fType;
 }
+
+std::shared_ptr<RDefineBase> RDefineBase::GetVariedDefine(const std::string &variationName)
+{
+   throw std::logic_error("Column \"" + fName + "\" cannot be evaluated for the variation \"" + variationName + "\".");
+}
+
+void RDefineBase::InitBulkSlot(unsigned int, RLoopManager &)
+{
+   throw std::runtime_error("Column \"" + fName + "\" cannot be processed in bulk mode.");
+}
+
+void *RDefineBase::GetBulkValuePtr(unsigned int)
+{
+   throw std::logic_error("Column \"" + fName + "\" does not compute its values in bulk.");
+}
+
+void RDefineBase::UpdateBulk(unsigned int, const RDFInternal::REntryBulk &, const char *)
+{
+   throw std::logic_error("Column \"" + fName + "\" does not compute its values in bulk.");
+}
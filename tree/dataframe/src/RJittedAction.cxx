@@ -26,6 +26,12 @@ void RJittedAction::Run(unsigned int slot, Long64_t entry)
    fConcreteAction->Run(slot, entry);
 }
 
+void RJittedAction::RunBulk(unsigned int slot, const REntryBulk &bulk)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   fConcreteAction->RunBulk(slot, bulk);
+}
+
 void RJittedAction::Initialize()
 {
    R__ASSERT(fConcreteAction != nullptr);
@@ -93,3 +99,16 @@ std::unique_ptr<ROOT::Detail::RDF::RMergeableValueBase> RJittedAction::GetMergea
    R__ASSERT(fConcreteAction != nullptr);
    return fConcreteAction->GetMergeableValue();
 }
+
+std::vector<std::string> RJittedAction::GetVariations() const
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->GetVariations();
+}
+
+std::unique_ptr<ROOT::Internal::RDF::RActionBase>
+RJittedAction::MakeVariedAction(const std::string &variationName, const std::shared_ptr<void> &variedResult)
+{
+   R__ASSERT(fConcreteAction != nullptr);
+   return fConcreteAction->MakeVariedAction(variationName, variedResult);
+}
@@ -42,3 +42,33 @@ void RJittedDefine::FinaliseSlot(unsigned int slot)
    R__ASSERT(fConcreteDefine != nullptr);
    fConcreteDefine->FinaliseSlot(slot);
 }
+
+std::vector<std::string> RJittedDefine::GetVariations() const
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   return fConcreteDefine->GetVariations();
+}
+
+std::shared_ptr<RDefineBase> RJittedDefine::GetVariedDefine(const std::string &variationName)
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   return fConcreteDefine->GetVariedDefine(variationName);
+}
+
+void RJittedDefine::InitBulkSlot(unsigned int slot, RLoopManager &lm)
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   fConcreteDefine->InitBulkSlot(slot, lm);
+}
+
+void *RJittedDefine::GetBulkValuePtr(unsigned int slot)
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   return fConcreteDefine->GetBulkValuePtr(slot);
+}
+
+void RJittedDefine::UpdateBulk(unsigned int slot, const RDFInternal::REntryBulk &bulk, const char *mask)
+{
+   R__ASSERT(fConcreteDefine != nullptr);
+   fConcreteDefine->UpdateBulk(slot, bulk, mask);
+}
@@ -35,6 +35,12 @@ bool RJittedFilter::CheckFilters(unsigned int slot, Long64_t entry)
    return fConcreteFilter->CheckFilters(slot, entry);
 }
 
+const char *RJittedFilter::CheckFiltersBulk(unsigned int slot, const ROOT::Internal::RDF::REntryBulk &bulk)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->CheckFiltersBulk(slot, bulk);
+}
+
 void RJittedFilter::Report(ROOT::RDF::RCutFlowReport &cr) const
 {
    R__ASSERT(fConcreteFilter != nullptr);
@@ -112,3 +118,15 @@ std::shared_ptr<RDFGraphDrawing::GraphNode> RJittedFilter::GetGraph()
    }
    throw std::runtime_error("The Jitting should have been invoked before this method.");
 }
+
+std::vector<std::string> RJittedFilter::GetVariations() const
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetVariations();
+}
+
+std::shared_ptr<RNodeBase> RJittedFilter::GetVariedFilter(const std::string &variationName)
+{
+   R__ASSERT(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetVariedFilter(variationName);
+}
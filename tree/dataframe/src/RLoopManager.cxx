@@ -1,6 +1,7 @@
 #include "RConfigure.h" // R__USE_IMT
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RActionBase.hxx"
+#include "ROOT/RDF/RBulkColumn.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
@@ -9,10 +10,13 @@
 #include "TBranchElement.h"
 #include "TBranchObject.h"
 #include "TEntryList.h"
+#include "TEnv.h"
+#include "TError.h" // Warning
 #include "TFriendElement.h"
 #include "TInterpreter.h"
 #include "TROOT.h" // IsImplicitMTEnabled
 #include "TTreeReader.h"
+#include "TVirtualMutex.h" // gGlobalMutex
 
 #ifdef R__USE_IMT
 #include "ROOT/TThreadExecutor.hxx"
@@ -22,8 +26,10 @@
 #include <atomic>
 #include <exception>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -34,15 +40,129 @@ using namespace ROOT::Detail::RDF;
 using namespace ROOT::Internal::RDF;
 
 namespace {
-/// A helper function that returns all RDF code that is currently scheduled for just-in-time compilation.
+/// All RDF code that is currently scheduled for just-in-time compilation.
 /// This allows different RLoopManager instances to share these data.
 /// We want RLoopManagers to be able to add their code to a global "code to execute via cling",
 /// so that, lazily, we can jit everything that's needed by all RDFs in one go, which is potentially
 /// much faster than jitting each RLoopManager's code separately.
-static std::string &GetCodeToJit()
+/// If the RDataFrame.BackgroundJit setting is enabled, the code is compiled in a background task as soon as it is
+/// booked, wrapped in functions that the event loop then only has to call.
+class RJitQueue {
+   std::mutex fMutex;
+   std::string fCodeToDeclare; ///< Declarations that fCodeToJit depends on
+   std::string fCodeToJit;     ///< Statements that add the jitted nodes to their computation graphs
+   std::string fCallsToRun;    ///< Calls of the functions compiled in the background, in booking order
+   std::exception_ptr fError;  ///< The error of the background task, reported by the next call to Jit()
+   std::future<void> fTask;
+   bool fTaskRunning = false;
+   bool fWarnedThreadSafety = false;
+   unsigned int fNFunctions = 0u;
+
+   void CompileInBackground()
+   {
+      while (true) {
+         std::string toDeclare;
+         std::string code;
+         std::string funcName;
+         {
+            std::lock_guard<std::mutex> lock(fMutex);
+            if (fCodeToDeclare.empty() && fCodeToJit.empty()) {
+               fTaskRunning = false;
+               return;
+            }
+            std::swap(toDeclare, fCodeToDeclare);
+            std::swap(code, fCodeToJit);
+            funcName = "jittedCode" + std::to_string(fNFunctions++);
+         }
+         try {
+            RDFInternal::InterpreterDeclare(toDeclare + "namespace __rdf {\nvoid " + funcName + "() {\n" + code +
+                                            "}\n}");
+         } catch (...) {
+            // as for synchronous jitting, the code of this batch is lost; the functions compiled before still run
+            std::lock_guard<std::mutex> lock(fMutex);
+            fError = std::current_exception();
+            fTaskRunning = false;
+            return;
+         }
+         std::lock_guard<std::mutex> lock(fMutex);
+         fCallsToRun += "__rdf::" + funcName + "();\n";
+      }
+   }
+
+public:
+   /// The background task must not outlive the interpreter
+   ~RJitQueue() { Wait(); }
+
+   /// Wait for the background task, if any
+   void Wait()
+   {
+      std::future<void> task;
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         task = std::move(fTask);
+      }
+      if (task.valid())
+         task.wait();
+   }
+
+   void AddDeclaration(const std::string &code)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fCodeToDeclare.append(code);
+   }
+
+   void AddCode(const std::string &code)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fCodeToJit.append(code);
+      if (fTaskRunning || !gEnv->GetValue("RDataFrame.BackgroundJit", 0))
+         return;
+      // the interpreter is used concurrently by the background task and by the booking of further nodes
+      if (!gGlobalMutex) {
+         if (!fWarnedThreadSafety)
+            Warning("RDataFrame::Jit", "RDataFrame.BackgroundJit requires the thread safety of ROOT: call "
+                                       "ROOT::EnableThreadSafety() first. The code is jitted when the event loop "
+                                       "starts.");
+         fWarnedThreadSafety = true;
+         return;
+      }
+      fTaskRunning = true;
+      fTask = std::async(std::launch::async, [this] { CompileInBackground(); });
+   }
+
+   /// Wait for the background task, then jit what remains. Throws if jitting failed, after running the code that
+   /// compiled.
+   void Jit()
+   {
+      Wait();
+
+      std::string toDeclare;
+      std::string code;
+      std::string calls;
+      std::exception_ptr error;
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         std::swap(toDeclare, fCodeToDeclare);
+         std::swap(code, fCodeToJit);
+         std::swap(calls, fCallsToRun);
+         std::swap(error, fError);
+      }
+      if (!calls.empty())
+         RDFInternal::InterpreterCalc(calls, "RLoopManager::Run");
+      if (!toDeclare.empty())
+         RDFInternal::InterpreterDeclare(toDeclare);
+      if (!code.empty())
+         RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+      if (error)
+         std::rethrow_exception(error);
+   }
+};
+
+static RJitQueue &GetJitQueue()
 {
-   static std::string code;
-   return code;
+   // destroyed at exit, after waiting for the background task
+   static RJitQueue queue;
+   return queue;
 }
 
 static bool ContainsLeaf(const std::set<TLeaf *> &leaves, TLeaf *leaf)
@@ -239,6 +359,12 @@ RLoopManager::RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t
    fDataSource->SetNSlots(fNSlots);
 }
 
+RLoopManager::~RLoopManager()
+{
+   // the background task might be compiling code that refers to the nodes of this computation graph
+   GetJitQueue().Wait();
+}
+
 // ROOT-9559: we cannot handle indexed friends
 void RLoopManager::CheckIndexedFriends()
 {
@@ -285,8 +411,9 @@ void RLoopManager::RunEmptySourceMT()
       InitNodeSlots(nullptr, slot);
       try {
          for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
-            RunAndCheckFilters(slot, currEntry);
+            ProcessEntry(slot, currEntry);
          }
+         RunAndCheckFiltersBulk(slot);
       } catch (...) {
          CleanUpTask(slot);
          // Error might throw in experiment frameworks like CMSSW
@@ -309,8 +436,9 @@ void RLoopManager::RunEmptySource()
    InitNodeSlots(nullptr, 0);
    try {
       for (ULong64_t currEntry = 0; currEntry < fNEmptyEntries && fNStopsReceived < fNChildren; ++currEntry) {
-         RunAndCheckFilters(0, currEntry);
+         ProcessEntry(0, currEntry);
       }
+      RunAndCheckFiltersBulk(0);
    } catch (...) {
       CleanUpTask(0u);
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -339,8 +467,9 @@ void RLoopManager::RunTreeProcessorMT()
       try {
          // recursive call to check filters and conditionally execute actions
          while (r.Next()) {
-            RunAndCheckFilters(slot, count++);
+            ProcessEntry(slot, count++);
          }
+         RunAndCheckFiltersBulk(slot);
       } catch (...) {
          CleanUpTask(slot);
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -360,22 +489,26 @@ void RLoopManager::RunTreeReader()
    if (0 == fTree->GetEntriesFast())
       return;
    InitNodeSlots(&r, 0);
+   auto entryStatus = r.GetEntryStatus();
 
    // recursive call to check filters and conditionally execute actions
    // in the non-MT case processing can be stopped early by ranges, hence the check on fNStopsReceived
    try {
       while (r.Next() && fNStopsReceived < fNChildren) {
-         RunAndCheckFilters(0, r.GetCurrentEntry());
+         ProcessEntry(0, r.GetCurrentEntry());
       }
+      // in bulk mode, the values of the last bulk are loaded now, which moves the reader back
+      entryStatus = r.GetEntryStatus();
+      RunAndCheckFiltersBulk(0);
    } catch (...) {
       CleanUpTask(0u);
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
       throw;
    }
-   if (r.GetEntryStatus() != TTreeReader::kEntryNotFound && fNStopsReceived < fNChildren) {
+   if (entryStatus != TTreeReader::kEntryNotFound && fNStopsReceived < fNChildren) {
       // something went wrong in the TTreeReader event loop
       throw std::runtime_error("An error was encountered while processing the data. TTreeReader status code is: " +
-                               std::to_string(r.GetEntryStatus()));
+                               std::to_string(entryStatus));
    }
    CleanUpTask(0u);
 }
@@ -394,10 +527,11 @@ void RLoopManager::RunDataSource()
             auto end = range.second;
             for (auto entry = range.first; entry < end; ++entry) {
                if (fDataSource->SetEntry(0u, entry)) {
-                  RunAndCheckFilters(0u, entry);
+                  ProcessEntry(0u, entry);
                }
             }
          }
+         RunAndCheckFiltersBulk(0u);
       } catch (...) {
          CleanUpTask(0u);
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -427,9 +561,10 @@ void RLoopManager::RunDataSourceMT()
       try {
          for (auto entry = range.first; entry < end; ++entry) {
             if (fDataSource->SetEntry(slot, entry)) {
-               RunAndCheckFilters(slot, entry);
+               ProcessEntry(slot, entry);
             }
          }
+         RunAndCheckFiltersBulk(slot);
       } catch (...) {
          CleanUpTask(slot);
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -462,11 +597,123 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       callback(slot);
 }
 
+/// Execute actions and check named filters for the entries collected in the bulk of the given slot, then start a new
+/// bulk. Does nothing if bulk mode is disabled or if the bulk is empty.
+void RLoopManager::RunAndCheckFiltersBulk(unsigned int slot)
+{
+   if (fBulkSize == 0 || fBulkEntries[slot].empty())
+      return;
+   auto &entries = fBulkEntries[slot];
+   const RDFInternal::REntryBulk bulk{entries.data(), entries.size()};
+   for (auto &actionPtr : fBookedActions)
+      actionPtr->RunBulk(slot, bulk);
+   for (auto &namedFilterPtr : fBookedNamedFilters)
+      namedFilterPtr->CheckFiltersBulk(slot, bulk);
+   for (auto &callback : fCallbacks)
+      for (std::size_t i = 0; i < bulk.fSize; ++i)
+         callback(slot);
+   for (auto &column : fBulkColumns[slot])
+      column->ResetLoaded();
+   entries.clear();
+   fBulkReaderEntries[slot].clear();
+}
+
+/// Process the given entry, which must be the current entry of the data source.
+/// In bulk mode, the entry is added to the bulk of the slot, which is processed once it is full. The values of the
+/// columns of a data source are loaded right away, since data sources do not support random access to entries.
+/// Those of a TTree are only loaded when a node needs them, see LoadBulkColumns().
+void RLoopManager::ProcessEntry(unsigned int slot, Long64_t entry)
+{
+   if (fBulkSize == 0) {
+      RunAndCheckFilters(slot, entry);
+      return;
+   }
+   auto &entries = fBulkEntries[slot];
+   auto r = fBulkReaders[slot];
+   if (r == nullptr) {
+      const auto idx = entries.size();
+      entries.push_back(entry);
+      for (auto &column : fBulkColumns[slot]) {
+         column->Load(idx, entry);
+         column->SetLoaded(idx);
+      }
+      if (entries.size() == fBulkSize)
+         RunAndCheckFiltersBulk(slot);
+      return;
+   }
+
+   // a bulk never spans two trees of a chain, so that loading its values does not switch files; the bulk is processed
+   // at the last entry of each tree, hence this only happens if an entry list skips the rest of a tree
+   const auto readerEntry = r->GetCurrentEntry();
+   const auto treeNumber = r->GetTree()->GetTreeNumber();
+   if (!entries.empty() && treeNumber != fBulkTreeNumbers[slot]) {
+      RunAndCheckFiltersBulk(slot);
+      r->SetEntry(readerEntry);
+   }
+   fBulkTreeNumbers[slot] = treeNumber;
+   entries.push_back(entry);
+   fBulkReaderEntries[slot].push_back(readerEntry);
+   auto tree = r->GetTree()->GetTree();
+   if (entries.size() == fBulkSize || tree->GetReadEntry() + 1 >= tree->GetEntries()) {
+      RunAndCheckFiltersBulk(slot);
+      // go back to the current entry, which the next call to TTreeReader::Next() starts from
+      r->SetEntry(readerEntry);
+   }
+}
+
+/// Return the values of the given input column shared by the nodes of the given slot in bulk mode, or nullptr if no
+/// node reads the column with the given type yet.
+RBulkColumnBase *
+RLoopManager::GetBulkColumn(unsigned int slot, const std::string &colName, const std::type_info &type) const
+{
+   for (auto &column : fBulkColumns[slot])
+      if (column->GetColumnName() == colName && column->GetTypeId() == type)
+         return column.get();
+   return nullptr;
+}
+
+/// Register the values of an input column in bulk mode, to be shared by all the nodes of the given slot that read it.
+RBulkColumnBase *RLoopManager::AddBulkColumn(unsigned int slot, std::unique_ptr<RBulkColumnBase> column)
+{
+   fBulkColumns[slot].emplace_back(std::move(column));
+   return fBulkColumns[slot].back().get();
+}
+
+/// Load the values of the given input columns for the entries of the bulk selected by the mask, unless they were
+/// loaded for another node already. Columns may be null, e.g. for defined columns, and are then skipped.
+/// For a TTree, the TTreeReader of the slot is moved back to each entry, so that the nodes downstream of a filter only
+/// read the entries that it selects. The values of a data source are loaded by ProcessEntry() instead.
+void RLoopManager::LoadBulkColumns(unsigned int slot, const REntryBulk &bulk, const char *mask,
+                                   RBulkColumnBase *const *columns, std::size_t nColumns)
+{
+   auto r = fBulkReaders[slot];
+   if (r == nullptr)
+      return;
+   const auto &readerEntries = fBulkReaderEntries[slot];
+   for (std::size_t i = 0; i < bulk.fSize; ++i) {
+      if (!mask[i])
+         continue;
+      for (std::size_t col = 0; col < nColumns; ++col) {
+         auto column = columns[col];
+         if (column == nullptr || column->IsLoaded(i))
+            continue;
+         if (r->GetCurrentEntry() != readerEntries[i] && r->SetEntry(readerEntries[i]) != TTreeReader::kEntryValid)
+            throw std::runtime_error("Could not read entry " + std::to_string(readerEntries[i]) +
+                                     " again in bulk mode. TTreeReader status code is: " +
+                                     std::to_string(r->GetEntryStatus()));
+         column->Load(i, bulk.fEntries[i]);
+         column->SetLoaded(i);
+      }
+   }
+}
+
 /// Build TTreeReaderValues for all nodes
 /// This method loops over all filters, actions and other booked objects and
 /// calls their `InitSlot` method, to get them ready for running a task.
 void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 {
+   if (fBulkSize > 0)
+      fBulkReaders[slot] = r;
    for (auto &ptr : fBookedActions)
       ptr->InitSlot(r, slot);
    for (auto &ptr : fBookedFilters)
@@ -517,6 +764,13 @@ void RLoopManager::CleanUpNodes()
 /// Perform clean-up operations. To be called at the end of each task execution.
 void RLoopManager::CleanUpTask(unsigned int slot)
 {
+   if (fBulkSize > 0) {
+      // the bulk columns own column readers, which must not outlive the TTreeReader
+      fBulkEntries[slot].clear();
+      fBulkReaderEntries[slot].clear();
+      fBulkColumns[slot].clear();
+      fBulkReaders[slot] = nullptr;
+   }
    for (auto &ptr : fBookedActions)
       ptr->FinalizeSlot(slot);
    for (auto &ptr : fBookedFilters)
@@ -524,14 +778,10 @@ void RLoopManager::CleanUpTask(unsigned int slot)
 }
 
 /// Add RDF nodes that require just-in-time compilation to the computation graph.
-/// This method also clears the contents of GetCodeToJit().
+/// This method jits the code booked by all RLoopManagers, waiting for the background jitting if it is enabled.
 void RLoopManager::Jit()
 {
-   const std::string code = std::move(GetCodeToJit());
-   if (code.empty())
-      return;
-
-   RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+   GetJitQueue().Jit();
 }
 
 /// Trigger counting of number of children nodes for each node of the functional graph.
@@ -634,7 +884,31 @@ void RLoopManager::Report(ROOT::RDF::RCutFlowReport &rep) const
 
 void RLoopManager::ToJitExec(const std::string &code) const
 {
-   GetCodeToJit().append(code);
+   GetJitQueue().AddCode(code);
+}
+
+/// Declare code to the interpreter before the code passed to ToJitExec() is jitted, e.g. the lambdas it uses.
+void RLoopManager::ToJitDeclare(const std::string &code) const
+{
+   GetJitQueue().AddDeclaration(code);
+}
+
+/// Enable bulk mode, in which the event loop collects the given number of entries before the nodes process them.
+/// A bulk size of zero disables bulk mode. Must not be called during the event loop.
+void RLoopManager::SetBulkSize(std::size_t bulkSize)
+{
+   fBulkSize = bulkSize;
+   fBulkEntries.assign(bulkSize > 0 ? fNSlots : 0u, {});
+   for (auto &entries : fBulkEntries)
+      entries.reserve(bulkSize);
+   fBulkReaderEntries.assign(bulkSize > 0 ? fNSlots : 0u, {});
+   for (auto &entries : fBulkReaderEntries)
+      entries.reserve(bulkSize);
+   fBulkColumns.clear();
+   fBulkColumns.resize(bulkSize > 0 ? fNSlots : 0u);
+   fBulkReaders.assign(bulkSize > 0 ? fNSlots : 0u, nullptr);
+   fBulkTreeNumbers.assign(bulkSize > 0 ? fNSlots : 0u, -1);
+   fBulkMaskAll.assign(bulkSize, 1);
 }
 
 void RLoopManager::RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f)
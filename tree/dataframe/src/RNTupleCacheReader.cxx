@@ -0,0 +1,60 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RDF/RNTupleCacheReader.hxx>
+#include <ROOT/RDF/RNTupleSnapshotWriter.hxx> // CreateNTupleField
+#include <ROOT/RField.hxx>
+#include <ROOT/RFieldValue.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <utility>
+
+ROOT::Internal::RDF::RNTupleCacheReader::RNTupleCacheReader(unsigned int nSlots, const std::string &fileName,
+                                                            const std::string &ntupleName,
+                                                            const ROOT::Detail::RDF::ColumnNames_t &fieldNames,
+                                                            const std::vector<std::string> &typeNames)
+   : fFieldNames(fieldNames), fTypeNames(typeNames), fSources(nSlots), fFields(nSlots), fValues(nSlots)
+{
+   fSources[0] = ROOT::Experimental::Detail::RPageSource::Create(ntupleName, fileName);
+   fSources[0]->Attach();
+   for (unsigned int slot = 1; slot < nSlots; ++slot) {
+      fSources[slot] = fSources[0]->Clone();
+      fSources[slot]->Attach();
+   }
+}
+
+ROOT::Internal::RDF::RNTupleCacheReader::~RNTupleCacheReader() = default;
+
+void ROOT::Internal::RDF::RNTupleCacheReader::Connect(unsigned int slot, const std::vector<void *> &values)
+{
+   auto &source = *fSources[slot];
+   const auto &descriptor = source.GetDescriptor();
+   for (std::size_t i = 0; i < fFieldNames.size(); ++i) {
+      auto field = CreateNTupleField(fFieldNames[i], fTypeNames[i]);
+      ROOT::Experimental::Detail::RFieldFuse::ConnectRecursively(descriptor.FindFieldId(fFieldNames[i]), source,
+                                                                 *field);
+      fValues[slot].emplace_back(new ROOT::Experimental::Detail::RFieldValue(field->CaptureValue(values[i])));
+      fFields[slot].emplace_back(std::move(field));
+   }
+}
+
+void ROOT::Internal::RDF::RNTupleCacheReader::Read(unsigned int slot, ULong64_t entry)
+{
+   auto &fields = fFields[slot];
+   auto &values = fValues[slot];
+   for (std::size_t i = 0; i < fields.size(); ++i)
+      fields[i]->Read(entry, values[i].get());
+}
+
+ULong64_t ROOT::Internal::RDF::RNTupleCacheReader::GetNEntries()
+{
+   return fSources[0]->GetNEntries();
+}
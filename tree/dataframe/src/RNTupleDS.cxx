@@ -23,6 +23,8 @@
 
 #include <TError.h>
 
+#include <algorithm>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -60,6 +62,9 @@ RDF::RDataSource::Record_t RNTupleDS::GetColumnReadersImpl(std::string_view name
       fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), name));
    // TODO(jblomer): check expected type info like in, e.g., RRootDS.cxx
 
+   // Fields are only connected to the page sources once RDataFrame asks for a column reader.  Therefore, the active
+   // columns of the page sources, and thus the byte ranges read from storage, are exactly the ones of the columns
+   // used in the computation graph.
    std::vector<void*> ptrs;
    for (unsigned int slot = 0; slot < fNSlots; ++slot) {
       if (!fValuePtrs[slot][colIdx]) {
@@ -89,29 +94,80 @@ bool RNTupleDS::SetEntry(unsigned int slot, ULong64_t entryIndex)
    return true;
 }
 
+void RNTupleDS::SkipClustersOutside(std::string_view colName, double min, double max)
+{
+   const auto &descriptor = fSources[0]->GetDescriptor();
+   auto fieldId = descriptor.FindFieldId(colName);
+   if (fieldId == kInvalidDescriptorId)
+      throw std::runtime_error("RNTupleDS: no such column: " + std::string(colName));
+   auto columnId = descriptor.FindColumnId(fieldId, 0);
+   if (columnId == kInvalidDescriptorId)
+      throw std::runtime_error("RNTupleDS: column " + std::string(colName) + " has no values to cut on");
+   fClusterCuts.emplace_back(RClusterCut{columnId, min, max});
+}
+
+
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
-   // TODO(jblomer): use cluster boundaries for the entry ranges
    std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
    if (fHasSeenAllRanges) return ranges;
 
-   auto nEntries = fSources[0]->GetNEntries();
-   const auto chunkSize = nEntries / fNSlots;
-   const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
-   auto start = 0UL;
-   auto end = 0UL;
-   for (auto i : ROOT::TSeqU(fNSlots)) {
-      start = end;
-      end += chunkSize;
-      ranges.emplace_back(start, end);
-      (void)i;
+   // One range for every cluster that passes the cluster cuts, such that no two slots work on the same cluster
+   const auto &descriptor = fSources[0]->GetDescriptor();
+   std::vector<std::pair<ULong64_t, ULong64_t>> clusterRanges;
+   for (DescriptorId_t clusterId = 0; clusterId < descriptor.GetNClusters(); ++clusterId) {
+      const auto &clusterDesc = descriptor.GetClusterDescriptor(clusterId);
+      bool isSelected = true;
+      for (const auto &cut : fClusterCuts) {
+         if (!clusterDesc.GetColumnRange(cut.fColumnId).MayContainValues(cut.fMin, cut.fMax)) {
+            isSelected = false;
+            break;
+         }
+      }
+      if (!isSelected || (clusterDesc.GetNEntries() == 0))
+         continue;
+      clusterRanges.emplace_back(clusterDesc.GetFirstEntryIndex(),
+                                 clusterDesc.GetFirstEntryIndex() + clusterDesc.GetNEntries());
+   }
+   std::sort(clusterRanges.begin(), clusterRanges.end());
+
+   if (fNSlots > 1) {
+      ranges = clusterRanges;
+   } else {
+      // Without concurrency, consecutive clusters are merged into a single range
+      for (const auto &r : clusterRanges) {
+         if (!ranges.empty() && (ranges.back().second == r.first)) {
+            ranges.back().second = r.second;
+         } else {
+            ranges.emplace_back(r);
+         }
+      }
    }
-   ranges.back().second += reminder;
+
+   fEntryRanges = ranges;
    fHasSeenAllRanges = true;
    return ranges;
 }
 
 
+void RNTupleDS::InitSlot(unsigned int slot, ULong64_t firstEntry)
+{
+   // In the sequential event loop, InitSlot() is called only once for all the ranges
+   if (fNSlots == 1)
+      return;
+
+   // Restrict the cluster preloading of the slot's page source to the range; the following clusters are
+   // processed by other slots
+   auto itr = std::lower_bound(fEntryRanges.begin(), fEntryRanges.end(), std::make_pair(firstEntry, ULong64_t(0)));
+   Detail::RPageSource::REntryRange entryRange;
+   if ((itr != fEntryRanges.end()) && (itr->first == firstEntry)) {
+      entryRange.fFirstEntry = itr->first;
+      entryRange.fNEntries = itr->second - itr->first;
+   }
+   fSources[slot]->SetEntryRange(entryRange);
+}
+
+
 std::string RNTupleDS::GetTypeName(std::string_view colName) const
 {
    const auto index = std::distance(
@@ -0,0 +1,202 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDF/RNTupleSnapshotWriter.hxx>
+#include <ROOT/REntry.hxx>
+#include <ROOT/RField.hxx>
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleDS.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <ROOT/RVec.hxx>
+#include <Compression.h>
+#include <TClass.h>
+#include <TError.h> // Warning
+#include <TString.h>
+
+#include <cstdint>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using ROOT::Experimental::RField;
+using ROOT::Experimental::Detail::RFieldBase;
+
+namespace {
+
+/// Return the RNTuple spelling of a fundamental type or of std::string, as spelled by TypeID2TypeName(); or an empty
+/// string for other types
+std::string GetFundamentalTypeName(const std::string &typeName)
+{
+   static const std::map<std::string, std::string> typeNames{{"bool", "bool"},
+                                                             {"Bool_t", "bool"},
+                                                             {"UChar_t", "std::uint8_t"},
+                                                             {"unsigned char", "std::uint8_t"},
+                                                             {"int", "std::int32_t"},
+                                                             {"Int_t", "std::int32_t"},
+                                                             {"unsigned int", "std::uint32_t"},
+                                                             {"UInt_t", "std::uint32_t"},
+                                                             {"ULong64_t", "std::uint64_t"},
+                                                             {"float", "float"},
+                                                             {"Float_t", "float"},
+                                                             {"double", "double"},
+                                                             {"Double_t", "double"},
+                                                             {"string", "std::string"},
+                                                             {"std::string", "std::string"}};
+   const auto it = typeNames.find(typeName);
+   return it == typeNames.end() ? "" : it->second;
+}
+
+bool StartsWith(const std::string &str, const std::string &prefix)
+{
+   return str.compare(0, prefix.size(), prefix) == 0;
+}
+
+std::string GetTemplateArgument(const std::string &typeName, const std::string &prefix)
+{
+   return typeName.substr(prefix.size(), typeName.size() - prefix.size() - 1);
+}
+
+/// Whether RFieldBase::Create() can create a field for the given type
+bool IsSupportedByCreate(const std::string &typeName)
+{
+   if (!GetFundamentalTypeName(typeName).empty())
+      return true;
+   for (const std::string prefix : {"vector<", "std::vector<"}) {
+      if (StartsWith(typeName, prefix))
+         return IsSupportedByCreate(GetTemplateArgument(typeName, prefix));
+   }
+   // RFieldBase::Create() treats RVec as std::vector, whose memory layout differs
+   if (StartsWith(typeName, "ROOT::VecOps::RVec<"))
+      return false;
+   auto cl = TClass::GetClass(typeName.c_str());
+   return cl && cl->HasDictionary() && !cl->GetCollectionProxy();
+}
+
+template <typename ItemT>
+RFieldBase *CreateRVecField(const std::string &fieldName)
+{
+   return new RField<ROOT::VecOps::RVec<ItemT>>(fieldName);
+}
+
+} // anonymous namespace
+
+std::unique_ptr<RFieldBase>
+ROOT::Internal::RDF::CreateNTupleField(const std::string &fieldName, const std::string &typeName)
+{
+   const std::string rvecPrefix = "ROOT::VecOps::RVec<";
+   RFieldBase *field = nullptr;
+   if (StartsWith(typeName, rvecPrefix)) {
+      const auto itemTypeName = GetFundamentalTypeName(GetTemplateArgument(typeName, rvecPrefix));
+      if (itemTypeName == "bool")
+         field = CreateRVecField<bool>(fieldName);
+      else if (itemTypeName == "std::uint8_t")
+         field = CreateRVecField<std::uint8_t>(fieldName);
+      else if (itemTypeName == "std::int32_t")
+         field = CreateRVecField<std::int32_t>(fieldName);
+      else if (itemTypeName == "std::uint32_t")
+         field = CreateRVecField<std::uint32_t>(fieldName);
+      else if (itemTypeName == "std::uint64_t")
+         field = CreateRVecField<std::uint64_t>(fieldName);
+      else if (itemTypeName == "float")
+         field = CreateRVecField<float>(fieldName);
+      else if (itemTypeName == "double")
+         field = CreateRVecField<double>(fieldName);
+      else if (itemTypeName == "std::string")
+         field = CreateRVecField<std::string>(fieldName);
+   } else if (IsSupportedByCreate(typeName)) {
+      field = RFieldBase::Create(fieldName, typeName);
+   }
+   if (!field)
+      throw std::runtime_error("Column \"" + fieldName + "\" of type " + typeName + " cannot be written to RNTuple.");
+   return std::unique_ptr<RFieldBase>(field);
+}
+
+ROOT::Internal::RDF::RNTupleSnapshotWriter::RNTupleSnapshotWriter(unsigned int nSlots, const std::string &fileName,
+                                                                  const std::string &ntupleName,
+                                                                  const ROOT::Detail::RDF::ColumnNames_t &fieldNames,
+                                                                  const std::vector<std::string> &typeNames,
+                                                                  const RSnapshotOptions &options)
+   : fFileName(fileName), fNTupleName(ntupleName), fOptions(options), fFillContexts(nSlots), fFields(nSlots),
+     fEntries(nSlots)
+{
+   TString mode = fOptions.fMode;
+   mode.ToLower();
+   if (mode != "recreate")
+      throw std::runtime_error("Snapshot: RNTuple output only supports the RECREATE mode.");
+   if (fNTupleName.find('/') != std::string::npos)
+      throw std::runtime_error("Snapshot: RNTuple output cannot be written to a TDirectory.");
+
+   fModel = ROOT::Experimental::RNTupleModel::Create();
+   for (std::size_t i = 0; i < fieldNames.size(); ++i)
+      fModel->AddField(CreateNTupleField(fieldNames[i], typeNames[i]));
+}
+
+ROOT::Internal::RDF::RNTupleSnapshotWriter::~RNTupleSnapshotWriter() = default;
+
+void ROOT::Internal::RDF::RNTupleSnapshotWriter::Initialize()
+{
+   ROOT::Experimental::RNTupleWriteOptions writeOptions;
+   writeOptions.SetCompression(ROOT::CompressionSettings(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel));
+   fWriter = ROOT::Experimental::RNTupleParallelWriter::Recreate(std::move(fModel), fNTupleName, fFileName,
+                                                                 writeOptions);
+}
+
+void ROOT::Internal::RDF::RNTupleSnapshotWriter::Connect(unsigned int slot, const std::vector<void *> &values)
+{
+   auto &fillContext = fFillContexts[slot];
+   auto &fields = fFields[slot];
+   if (!fillContext) {
+      // The fill context lives until the end of the event loop, so that its clusters span several tasks
+      fillContext = fWriter->CreateFillContext();
+      auto fieldZero = fillContext->GetModel()->GetFieldZero();
+      for (auto &field : *fieldZero) {
+         if (field.GetParent() == fieldZero)
+            fields.emplace_back(&field);
+      }
+   }
+
+   auto entry = std::make_unique<ROOT::Experimental::REntry>();
+   for (std::size_t i = 0; i < fields.size(); ++i)
+      entry->CaptureValue(fields[i]->CaptureValue(values[i]));
+   fEntries[slot] = std::move(entry);
+}
+
+void ROOT::Internal::RDF::RNTupleSnapshotWriter::Fill(unsigned int slot)
+{
+   auto &fillContext = *fFillContexts[slot];
+   fillContext.Fill(*fEntries[slot]);
+   if (fOptions.fAutoFlush > 0 && fillContext.GetNEntries() % fOptions.fAutoFlush == 0)
+      fillContext.CommitCluster();
+}
+
+void ROOT::Internal::RDF::RNTupleSnapshotWriter::Finalize()
+{
+   if (!fWriter) {
+      Warning("Snapshot", "A lazy Snapshot action was booked but never triggered.");
+      return;
+   }
+   // The fill contexts commit their last clusters, then the writer commits the ntuple
+   fEntries.clear();
+   fFillContexts.clear();
+   fWriter.reset();
+   if (fOutputRDF)
+      *fOutputRDF = ROOT::Experimental::MakeNTupleDataFrame(fNTupleName, fFileName);
+}
+
+std::shared_ptr<ROOT::RDataFrame> ROOT::Internal::RDF::RNTupleSnapshotWriter::GetOutputRDF()
+{
+   // Replaced by an RDataFrame that reads the output at the end of the event loop
+   if (!fOutputRDF)
+      fOutputRDF = std::make_shared<ROOT::RDataFrame>(0ull);
+   return fOutputRDF;
+}
@@ -20,6 +20,7 @@ RRangeBase::RRangeBase(RLoopManager *implPtr, unsigned int start, unsigned int s
 void RRangeBase::ResetCounters()
 {
    fLastCheckedEntry = -1;
+   fLastCheckedBulk = -1;
    fNProcessedEntries = 0;
    fHasStopped = false;
 }
@@ -0,0 +1,181 @@
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RDF/RTreeColumnReader.hxx>
+#include <TBasket.h>
+#include <TBranch.h>
+#include <TBranchElement.h>
+#include <TClass.h>
+#include <TDataType.h>
+#include <TLeaf.h>
+#include <TMath.h>
+#include <TObjArray.h>
+#include <TTree.h>
+#include <TVirtualCollectionProxy.h>
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <typeinfo>
+
+std::unique_ptr<ROOT::Internal::RDF::RTreeBulkReader>
+ROOT::Internal::RDF::RTreeBulkReader::Create(TTreeReader &r, const std::string &branchName,
+                                             const std::type_info &valueType, bool readsArrays)
+{
+   // The types for which the TLeaf classes implement ReadBasketFast()
+   switch (TDataType::GetType(valueType)) {
+   case kChar_t:
+   case kUChar_t:
+   case kShort_t:
+   case kUShort_t:
+   case kInt_t:
+   case kUInt_t:
+   case kFloat_t:
+   case kLong64_t:
+   case kULong64_t:
+   case kDouble_t: break;
+   default: return nullptr;
+   }
+   return std::unique_ptr<RTreeBulkReader>(
+      new RTreeBulkReader(r, branchName, TDataType::GetTypeName(TDataType::GetType(valueType)), readsArrays));
+}
+
+/// Checks whether the branch of the given tree can be read in bulk.  We only consider branches of the tree itself (not
+/// of friend trees, whose entry numbers are different).  These are either plain TBranch objects with a single leaf of
+/// the expected type and a fixed number of values per entry or, for readers of arrays, std::vector branches of the
+/// expected value type with the collection counts layout.
+void ROOT::Internal::RDF::RTreeBulkReader::Connect(TTree *tree)
+{
+   fTree = tree;
+   fTreeNumber = fReader.GetTree()->GetTreeNumber();
+   fBranch = nullptr;
+   fIsCollection = false;
+   fFirstEntry = 0;
+   fNEntries = 0;
+
+   auto branch = tree->GetBranch(fBranchName.c_str());
+   if (!branch || branch->GetTree() != tree)
+      return;
+
+   if (branch->IsA() == TBranchElement::Class()) {
+      auto branchElement = static_cast<TBranchElement *>(branch);
+      if (!fReadsArrays || !branchElement->CanHaveCollectionCounts())
+         return;
+      auto proxy = branchElement->GetClass()->GetCollectionProxy();
+      if (fTypeName != TDataType::GetTypeName(static_cast<EDataType>(proxy->GetType())))
+         return;
+      fBranch = branch;
+      fIsCollection = true;
+      fValueSize = proxy->GetIncrement();
+      return;
+   }
+
+   if (branch->IsA() != TBranch::Class() || !branch->SupportsBulkRead())
+      return;
+   auto leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->UncheckedAt(0));
+   if (leaf->GetLeafCount() || fTypeName != leaf->GetTypeName())
+      return;
+   if (!fReadsArrays && leaf->GetLenStatic() != 1)
+      return;
+
+   fBranch = branch;
+   fNValuesPerEntry = leaf->GetLenStatic();
+   fEntrySize = fNValuesPerEntry * leaf->GetLenType();
+}
+
+/// Reads the basket that starts with the given local entry number.  Only whole baskets can be read in bulk.
+bool ROOT::Internal::RDF::RTreeBulkReader::ReadBasket(Long64_t entry)
+{
+   const auto nBaskets = fBranch->GetWriteBasket() + 1;
+   const auto basketEntries = fBranch->GetBasketEntry();
+   const auto basketIdx = TMath::BinarySearch(Long64_t(nBaskets), basketEntries, entry);
+   if (basketIdx < 0 || basketEntries[basketIdx] != entry)
+      return false;
+   // A basket that is already in memory, e.g. because another reader of the same branch read it entry by entry, would
+   // be byte-swapped in place by the bulk read.
+   if (fBranch->GetListOfBaskets()->UncheckedAt(basketIdx))
+      return false;
+
+   const auto nEntries = fBranch->GetBulkRead().GetBulkEntries(entry, fBuffer);
+   if (nEntries <= 0) {
+      // Read the rest of this tree entry by entry
+      fBranch = nullptr;
+      return false;
+   }
+   fFirstEntry = entry;
+   fNEntries = nEntries;
+   return true;
+}
+
+/// Reads the basket that contains the given local entry number of a collection branch.  Unlike the bulk read of
+/// TBranch::GetBulkEntries(), the basket remains untouched and can still be used by TBranch::GetEntry(); its values
+/// are copied to our buffer and converted there.  Baskets written without the collection counts layout, e.g. in a
+/// tree merged from inputs with different IO features, are read entry by entry.
+bool ROOT::Internal::RDF::RTreeBulkReader::ReadCollectionBasket(Long64_t entry)
+{
+   const auto nBaskets = fBranch->GetWriteBasket() + 1;
+   const auto basketEntries = fBranch->GetBasketEntry();
+   const auto basketIdx = TMath::BinarySearch(Long64_t(nBaskets), basketEntries, entry);
+   if (basketIdx < 0)
+      return false;
+   auto basket = fBranch->GetBasket(basketIdx);
+   if (!basket) {
+      fBranch = nullptr;
+      return false;
+   }
+   // Skip the basket that is still being filled
+   auto basketBuffer = basket->GetBufferRef();
+   auto entryOffsets = basket->GetEntryOffset();
+   if (!basketBuffer || !basketBuffer->IsReading() || !entryOffsets || basket->GetDisplacement())
+      return false;
+   if (!basket->TestIOBit(TBasket::EIOBits::kCollectionCounts))
+      return false;
+
+   const auto nEntries = basket->GetNevBuf();
+   const auto begin = entryOffsets[0];
+   const auto nBytes = basket->GetLast() - begin;
+   if (fBuffer.BufferSize() < nBytes)
+      fBuffer.Expand(nBytes, kFALSE);
+   std::memcpy(fBuffer.Buffer(), basketBuffer->Buffer() + begin, nBytes);
+   fBuffer.SetBufferOffset(0);
+   switch (fValueSize) {
+   case 2: fBuffer.ByteSwapBuffer(nBytes / 2, kUShort_t); break;
+   case 4: fBuffer.ByteSwapBuffer(nBytes / 4, kUInt_t); break;
+   case 8: fBuffer.ByteSwapBuffer(nBytes / 8, kULong64_t); break;
+   }
+
+   fEntryOffsets.resize(nEntries + 1);
+   for (Int_t i = 0; i < nEntries; ++i)
+      fEntryOffsets[i] = entryOffsets[i] - begin;
+   fEntryOffsets[nEntries] = nBytes;
+   fFirstEntry = basketEntries[basketIdx];
+   fNEntries = nEntries;
+   return true;
+}
+
+const char *ROOT::Internal::RDF::RTreeBulkReader::GetEntry()
+{
+   auto tree = fReader.GetTree()->GetTree();
+   if (tree != fTree || fReader.GetTree()->GetTreeNumber() != fTreeNumber)
+      Connect(tree);
+   if (!fBranch)
+      return nullptr;
+
+   const auto entry = tree->GetReadEntry();
+   if (entry < fFirstEntry || entry >= fFirstEntry + fNEntries) {
+      if (!(fIsCollection ? ReadCollectionBasket(entry) : ReadBasket(entry)))
+         return nullptr;
+   }
+   if (fIsCollection) {
+      const auto idx = entry - fFirstEntry;
+      fNValues = (fEntryOffsets[idx + 1] - fEntryOffsets[idx]) / fValueSize;
+      return fBuffer.Buffer() + fEntryOffsets[idx];
+   }
+   fNValues = fNValuesPerEntry;
+   return fBuffer.GetCurrent() + (entry - fFirstEntry) * fEntrySize;
+}
@@ -0,0 +1,85 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
+#include "ROOT/RStringView.hxx"
+#include "RtypesCore.h" // Long64_t
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ROOT::Detail::RDF::RDefineBase;
+using ROOT::Detail::RDF::RVariationBase;
+namespace RDFInternal = ROOT::Internal::RDF;
+
+namespace {
+
+std::vector<std::string> GetFullVariationNames(std::string_view variationName, const std::vector<std::string> &tags)
+{
+   std::vector<std::string> names;
+   names.reserve(tags.size());
+   for (const auto &tag : tags)
+      names.emplace_back(std::string(variationName) + ":" + tag);
+   return names;
+}
+
+/// A column that exposes the values of one tag of a variation to the nodes downstream.
+/// In the collection of defined columns of a varied node, it takes the place of the nominal column.
+class RVariedColumn final : public RDefineBase {
+   RVariationBase &fVariation;
+   const std::size_t fTagIdx;
+
+public:
+   RVariedColumn(RVariationBase &variation, std::size_t tagIdx, unsigned int nSlots,
+                 const RDFInternal::RBookedDefines &defines,
+                 const std::map<std::string, std::vector<void *>> &DSValuePtrs)
+      : RDefineBase(variation.GetColumnName(), variation.GetTypeName(), nSlots, defines, DSValuePtrs),
+        fVariation(variation), fTagIdx(tagIdx)
+   {
+   }
+
+   void InitSlot(TTreeReader *r, unsigned int slot) final { fVariation.InitSlot(r, slot); }
+   void *GetValuePtr(unsigned int slot) final { return fVariation.GetValuePtr(slot, fTagIdx); }
+   const std::type_info &GetTypeId() const final { return fVariation.GetTypeId(); }
+   void Update(unsigned int slot, Long64_t entry) final { fVariation.Update(slot, entry); }
+   void FinaliseSlot(unsigned int slot) final { fVariation.FinaliseSlot(slot); }
+};
+
+} // anonymous namespace
+
+RVariationBase::RVariationBase(std::string_view colName, std::string_view variationName,
+                               const std::vector<std::string> &tags, std::string_view type, unsigned int nSlots,
+                               const RDFInternal::RBookedDefines &defines,
+                               const std::map<std::string, std::vector<void *>> &DSValuePtrs)
+   : fColumnName(colName), fVariationName(variationName), fTags(tags),
+     fVariationNames(GetFullVariationNames(variationName, tags)), fType(type), fNSlots(nSlots),
+     fLastCheckedEntry(fNSlots, -1), fDefines(defines), fIsInitialized(nSlots, false), fDSValuePtrs(DSValuePtrs),
+     fVariedColumns(tags.size())
+{
+}
+
+// pin vtable. Work around cling JIT issue.
+RVariationBase::~RVariationBase() {}
+
+std::shared_ptr<RDefineBase> RVariationBase::GetVariedColumn(const std::string &variationName)
+{
+   const auto it = std::find(fVariationNames.begin(), fVariationNames.end(), variationName);
+   if (it == fVariationNames.end())
+      throw std::logic_error("Column \"" + fColumnName + "\" has no variation \"" + variationName + "\".");
+
+   const auto tagIdx = std::distance(fVariationNames.begin(), it);
+   auto &variedColumn = fVariedColumns[tagIdx];
+   if (!variedColumn)
+      variedColumn = std::make_shared<RVariedColumn>(*this, tagIdx, fNSlots, fDefines, fDSValuePtrs);
+   return variedColumn;
+}
@@ -0,0 +1,253 @@
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RVec.hxx"
+#include "TChain.h"
+#include "TEntryList.h"
+#include "TFile.h"
+#include "TROOT.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ROOT;
+using ROOT::VecOps::RVec;
+
+namespace {
+/// Sum of the squares of the even entries smaller than 500, through a chain of defines and filters
+double SumOfSquares(RDataFrame &df)
+{
+   return *df.DefineSlotEntry("x", [](unsigned int, ULong64_t e) { return double(e); })
+              .Filter([](double x) { return x < 500.; }, {"x"})
+              .Define("x2", [](double x) { return x * x; }, {"x"})
+              .Filter([](ULong64_t e) { return e % 2 == 0; }, {"rdfentry_"})
+              .Sum<double>("x2");
+}
+} // anonymous namespace
+
+TEST(RDFBulk, EmptySource)
+{
+   RDataFrame df(1000);
+   const auto expected = SumOfSquares(df);
+   // the last bulk is not full
+   df.SetBulkSize(64);
+   EXPECT_DOUBLE_EQ(SumOfSquares(df), expected);
+   df.SetBulkSize(1);
+   EXPECT_DOUBLE_EQ(SumOfSquares(df), expected);
+}
+
+TEST(RDFBulk, DefinesOnlyEvaluatedForSelectedEntries)
+{
+   RDataFrame df(100);
+   df.SetBulkSize(16);
+   unsigned int nCalls = 0u;
+   auto f = df.Filter([](ULong64_t e) { return e < 10; }, {"rdfentry_"})
+               .Define("y",
+                       [&nCalls](ULong64_t e) {
+                          ++nCalls;
+                          return e;
+                       },
+                       {"rdfentry_"});
+   // both actions request the values of y, which are only computed once
+   auto count = f.Count();
+   auto sum = f.Sum<ULong64_t>("y");
+   auto max = f.Max<ULong64_t>("y");
+   EXPECT_EQ(*count, 10ull);
+   EXPECT_EQ(*sum, 45ull);
+   EXPECT_EQ(*max, 9ull);
+   EXPECT_EQ(nCalls, 10u);
+}
+
+TEST(RDFBulk, TreeColumns)
+{
+   TTree t("t", "t");
+   int i = 0;
+   std::vector<float> v;
+   t.Branch("i", &i);
+   t.Branch("v", &v);
+   for (i = 0; i < 100; ++i) {
+      v.assign(i % 5, float(i));
+      t.Fill();
+   }
+
+   RDataFrame df(t);
+   auto makeResults = [&df]() {
+      auto f = df.Filter([](int x) { return x % 3 == 0; }, {"i"});
+      return std::make_pair(f.Take<int>("i"), f.Define("vsum", [](const RVec<float> &x) { return Sum(x); }, {"v"})
+                                                 .Take<float>("vsum"));
+   };
+   auto expected = makeResults();
+   df.SetBulkSize(7);
+   auto bulk = makeResults();
+   EXPECT_EQ(*bulk.first, *expected.first);
+   EXPECT_EQ(*bulk.second, *expected.second);
+}
+
+TEST(RDFBulk, TreeColumnsOnlyReadForSelectedEntries)
+{
+   TTree t("t", "t");
+   int i = 0;
+   std::vector<float> v;
+   t.Branch("i", &i);
+   t.Branch("v", &v);
+   for (i = 0; i < 100; ++i) {
+      v.assign(3, float(i));
+      t.Fill();
+   }
+
+   RDataFrame df(t);
+   df.SetBulkSize(7);
+   auto f = df.Filter([](int x) { return x < 50; }, {"i"});
+   // two nodes read v, which is loaded once per entry
+   auto sum = f.Define("vsum", [](const RVec<float> &x) { return Sum(x); }, {"v"}).Sum<float>("vsum");
+   auto max = f.Max<RVec<float>>("v");
+   EXPECT_FLOAT_EQ(*sum, 3675.f);
+   EXPECT_FLOAT_EQ(*max, 49.f);
+   // v is only read for the entries that pass the filter
+   EXPECT_EQ(t.GetBranch("v")->GetReadEntry(), 49);
+   EXPECT_EQ(t.GetBranch("i")->GetReadEntry(), 99);
+}
+
+TEST(RDFBulk, Chain)
+{
+   const std::vector<std::string> fileNames{"dataframe_bulk_chain_0.root", "dataframe_bulk_chain_1.root"};
+   const std::vector<int> nEntries{10, 13};
+   int n = 0;
+   for (auto f = 0u; f < fileNames.size(); ++f) {
+      TFile file(fileNames[f].c_str(), "RECREATE");
+      TTree t("t", "t");
+      int i = 0;
+      t.Branch("i", &i);
+      for (auto e = 0; e < nEntries[f]; ++e) {
+         i = n++;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TChain c("t");
+   for (const auto &fileName : fileNames)
+      c.Add(fileName.c_str());
+   RDataFrame df(c);
+   auto takeValues = [&df]() { return *df.Filter([](int i) { return i % 3 != 0; }, {"i"}).Take<int>("i"); };
+   const auto expected = takeValues();
+   EXPECT_EQ(expected.size(), 15u);
+   // bulks do not span the two files
+   df.SetBulkSize(4);
+   EXPECT_EQ(takeValues(), expected);
+
+   // the entry list skips the last entries of the first file
+   TEntryList entryList;
+   for (auto e : {0, 1, 2, 3, 4, 5, 10, 11, 12, 20, 21, 22})
+      entryList.Enter(e, &c);
+   c.SetEntryList(&entryList);
+   RDataFrame dfList(c);
+   dfList.SetBulkSize(4);
+   EXPECT_EQ(*dfList.Filter([](int i) { return i % 3 != 0; }, {"i"}).Take<int>("i"),
+             std::vector<int>({1, 2, 4, 5, 10, 11, 20, 22}));
+   c.SetEntryList(nullptr);
+
+   for (const auto &fileName : fileNames)
+      gSystem->Unlink(fileName.c_str());
+}
+
+TEST(RDFBulk, Jitted)
+{
+   RDataFrame df(100);
+   df.SetBulkSize(32);
+   auto f = df.Define("x", "double(rdfentry_)").Filter("x > 89.5").Define("y", "x * 2");
+   auto sum = f.Sum<double>("y");
+   auto count = f.Count();
+   EXPECT_DOUBLE_EQ(*sum, 1890.);
+   EXPECT_EQ(*count, 10ull);
+}
+
+TEST(RDFBulk, Ranges)
+{
+   RDataFrame df(100);
+   auto takeEntries = [&df]() {
+      return *df.Filter([](ULong64_t e) { return e % 2 == 0; }, {"rdfentry_"})
+                 .Range(5, 20, 3)
+                 .Take<ULong64_t>("rdfentry_");
+   };
+   const auto expected = takeEntries();
+   EXPECT_EQ(expected.size(), 5u);
+   df.SetBulkSize(16);
+   EXPECT_EQ(takeEntries(), expected);
+}
+
+TEST(RDFBulk, Report)
+{
+   RDataFrame df(50);
+   df.SetBulkSize(8);
+   auto f = df.Filter([](ULong64_t e) { return e < 20; }, {"rdfentry_"}, "lt20")
+               .Filter([](ULong64_t e) { return e % 4 == 0; }, {"rdfentry_"}, "div4");
+   auto report = f.Report();
+   auto count = f.Count();
+   EXPECT_EQ(*count, 5ull);
+   EXPECT_EQ(report->At("lt20").GetAll(), 50ull);
+   EXPECT_EQ(report->At("lt20").GetPass(), 20ull);
+   EXPECT_EQ(report->At("div4").GetAll(), 20ull);
+   EXPECT_EQ(report->At("div4").GetPass(), 5ull);
+}
+
+TEST(RDFBulk, Callbacks)
+{
+   RDataFrame df(10);
+   df.SetBulkSize(4);
+   auto count = df.Count();
+   unsigned int nCalls = 0u;
+   count.OnPartialResult(1, [&nCalls](ULong64_t) { ++nCalls; });
+   EXPECT_EQ(*count, 10ull);
+   EXPECT_EQ(nCalls, 10u);
+}
+
+TEST(RDFBulk, UnsupportedNodes)
+{
+   RDataFrame df(10);
+   df.SetBulkSize(4);
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fLazy = true;
+   const auto fileName = "dataframe_bulk_unsupported.root";
+   auto snapshot = df.Define("x", [] { return 1; }).Snapshot<int>("t", fileName, {"x"}, opts);
+   EXPECT_THROW(*snapshot, std::runtime_error);
+   gSystem->Unlink(fileName);
+
+   RDataFrame df2(10);
+   df2.SetBulkSize(4);
+   auto sum = df2.Define("x", [] { return 1.; })
+                 .Vary("x", [](double x) { return RVec<double>{x - 1., x + 1.}; }, {"x"}, 2)
+                 .Sum<double>("x");
+   auto sums = ROOT::RDF::Experimental::VariationsFor(sum);
+   EXPECT_THROW(sums["x:0"], std::runtime_error);
+}
+
+#ifdef R__USE_IMT
+TEST(RDFBulk, MultiThread)
+{
+   ROOT::EnableImplicitMT(4);
+   {
+      RDataFrame df(10000);
+      std::atomic<unsigned int> nCalls{0u};
+      auto f = df.Define("x",
+                         [&nCalls](ULong64_t e) {
+                            ++nCalls;
+                            return double(e);
+                         },
+                         {"rdfentry_"})
+                  .Filter([](double x) { return x < 5000.; }, {"x"});
+      df.SetBulkSize(100);
+      auto sum = f.Sum<double>("x");
+      auto count = f.Count();
+      EXPECT_DOUBLE_EQ(*sum, 12497500.);
+      EXPECT_EQ(*count, 5000ull);
+      EXPECT_EQ(nCalls.load(), 10000u);
+   }
+   ROOT::DisableImplicitMT();
+}
+#endif
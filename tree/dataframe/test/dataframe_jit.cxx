@@ -0,0 +1,171 @@
+#include "ROOT/RDataFrame.hxx"
+#include "TEnv.h"
+#include "TROOT.h"
+#include "TString.h"
+#include "TSystem.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+using namespace ROOT;
+
+namespace {
+std::string ReadFile(const std::string &path)
+{
+   std::ifstream file(path);
+   return std::string{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+/// Count the entries of the return type cache in the given directory whose content contains the given text
+int CountRetTypeCacheEntries(const std::string &cacheDir, const std::string &text = "")
+{
+   auto dir = gSystem->OpenDirectory(cacheDir.c_str());
+   if (!dir)
+      return 0;
+   int nEntries = 0;
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      if (TString(entry).EndsWith(".rdfrettype") &&
+          ReadFile(cacheDir + "/" + entry).find(text) != std::string::npos)
+         ++nEntries;
+   }
+   gSystem->FreeDirectory(dir);
+   return nEntries;
+}
+
+/// Replace the return type stored by the entries of the return type cache whose content contains the given text
+void SetCachedRetType(const std::string &cacheDir, const std::string &text, const std::string &retType)
+{
+   auto dir = gSystem->OpenDirectory(cacheDir.c_str());
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      const auto path = cacheDir + "/" + entry;
+      const auto content = ReadFile(path);
+      if (!TString(entry).EndsWith(".rdfrettype") || content.find(text) == std::string::npos)
+         continue;
+      std::ofstream file(path);
+      file << retType << content.substr(content.find('\n'));
+   }
+   gSystem->FreeDirectory(dir);
+}
+
+/// Return the return type stored by the first entry of the return type cache whose content contains the given text
+std::string GetCachedRetType(const std::string &cacheDir, const std::string &text)
+{
+   std::string retType;
+   auto dir = gSystem->OpenDirectory(cacheDir.c_str());
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      const auto content = ReadFile(cacheDir + "/" + entry);
+      if (TString(entry).EndsWith(".rdfrettype") && content.find(text) != std::string::npos) {
+         retType = content.substr(0, content.find('\n'));
+         break;
+      }
+   }
+   gSystem->FreeDirectory(dir);
+   return retType;
+}
+
+void RemoveRetTypeCache(const std::string &cacheDir)
+{
+   auto dir = gSystem->OpenDirectory(cacheDir.c_str());
+   if (!dir)
+      return;
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      if (TString(entry).EndsWith(".rdfrettype"))
+         gSystem->Unlink((cacheDir + "/" + entry).c_str());
+   }
+   gSystem->FreeDirectory(dir);
+   gSystem->Unlink(cacheDir.c_str());
+}
+
+/// Run an event loop with jitted expressions that no other test uses, then exit with 0 if the result is correct, 1 if
+/// it is not, 2 if jitting failed. Run in a child process, the expressions are declared to a fresh interpreter.
+void RunAnalysisAndExit()
+{
+   int status = 0;
+   try {
+      RDataFrame df(10);
+      auto sum = df.Define("z", "rdfentry_ * 5ull + 7654321ull").Filter("z % 2ull == 1ull").Sum("z");
+      status = *sum == 5. * 7654321. + 5. * (0 + 2 + 4 + 6 + 8) ? 0 : 1;
+   } catch (const std::runtime_error &e) {
+      std::cerr << e.what() << std::endl;
+      status = 2;
+   }
+   std::exit(status);
+}
+} // anonymous namespace
+
+TEST(RDFJit, RetTypeCacheEntriesAreWritten)
+{
+   const std::string cacheDir = "dataframe_jit_cache";
+   RemoveRetTypeCache(cacheDir);
+   gEnv->SetValue("RDataFrame.ReturnTypeCacheDir", cacheDir.c_str());
+
+   RDataFrame df(10);
+   auto f = df.Define("x", "rdfentry_ * 3ull + 1234567ull").Filter("x % 2ull == 0ull");
+   auto sum = f.Sum<ULong64_t>("x");
+   // the same expression is only jitted, and cached, once
+   auto count = df.Define("y", "rdfentry_ * 3ull + 1234567ull").Count();
+   EXPECT_EQ(*sum, 5u * 1234567ull + 3ull * (1 + 3 + 5 + 7 + 9));
+   EXPECT_EQ(*count, 10ull);
+   EXPECT_EQ(CountRetTypeCacheEntries(cacheDir), 2);
+
+   gEnv->SetValue("RDataFrame.ReturnTypeCacheDir", "");
+   RemoveRetTypeCache(cacheDir);
+}
+
+TEST(RDFJit, RetTypeCacheWarmAndStale)
+{
+   const std::string cacheDir = "dataframe_jit_warm_cache";
+   RemoveRetTypeCache(cacheDir);
+   gEnv->SetValue("RDataFrame.ReturnTypeCacheDir", cacheDir.c_str());
+
+   // cold cache: the return types of the Define and the Filter are stored
+   EXPECT_EXIT(RunAnalysisAndExit(), ::testing::ExitedWithCode(0), "");
+   EXPECT_EQ(CountRetTypeCacheEntries(cacheDir), 2);
+   // warm cache: the expressions are declared together with the nodes, the result is the same
+   EXPECT_EXIT(RunAnalysisAndExit(), ::testing::ExitedWithCode(0), "");
+   EXPECT_EQ(CountRetTypeCacheEntries(cacheDir), 2);
+
+   const auto retType = GetCachedRetType(cacheDir, "7654321ull");
+
+   // a stale entry does not make the analysis fail: the expression is declared as with a cold cache, and the entry
+   // is replaced
+   SetCachedRetType(cacheDir, "7654321ull", "long long");
+   EXPECT_EXIT(RunAnalysisAndExit(), ::testing::ExitedWithCode(0), "");
+   EXPECT_EQ(CountRetTypeCacheEntries(cacheDir, "7654321ull"), 1);
+   EXPECT_EQ(GetCachedRetType(cacheDir, "7654321ull"), retType);
+
+   // an entry that is not the spelling of a type is never pasted into the declared code
+   SetCachedRetType(cacheDir, "7654321ull", "int>::value); abort(); //");
+   EXPECT_EXIT(RunAnalysisAndExit(), ::testing::ExitedWithCode(0), "");
+   EXPECT_EQ(GetCachedRetType(cacheDir, "7654321ull"), retType);
+
+   gEnv->SetValue("RDataFrame.ReturnTypeCacheDir", "");
+   RemoveRetTypeCache(cacheDir);
+}
+
+TEST(RDFJit, Background)
+{
+   ROOT::EnableThreadSafety();
+   gEnv->SetValue("RDataFrame.BackgroundJit", 1);
+
+   RDataFrame df1(100);
+   RDataFrame df2(50);
+   auto sum1 = df1.Define("x", "double(rdfentry_) * 0.5").Filter("x < 10.").Sum("x");
+   auto max2 = df2.Define("y", "int(rdfentry_) - 7").Max<int>("y");
+   auto mean2 = df2.Filter("rdfentry_ > 24").Mean("rdfentry_");
+   EXPECT_DOUBLE_EQ(*sum1, 95.);
+   EXPECT_EQ(*max2, 42);
+   EXPECT_DOUBLE_EQ(*mean2, 37.);
+
+   // nodes booked after the first event loop are jitted in a new background task
+   auto count1 = df1.Filter("rdfentry_ % 10 == 0").Count();
+   EXPECT_EQ(*count1, 10ull);
+
+   gEnv->SetValue("RDataFrame.BackgroundJit", 0);
+}
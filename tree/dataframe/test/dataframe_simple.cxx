@@ -952,6 +952,95 @@ TEST_P(RDFSimpleTests, ChainWithDifferentTreeNames)
    gSystem->Unlink(fname2);
 }
 
+// Flat branches of fundamental types are read basket by basket
+TEST_P(RDFSimpleTests, BulkReadFlatBranches)
+{
+   const auto fname1 = "test_bulkreadflatbranches_1.root";
+   const auto fname2 = "test_bulkreadflatbranches_2.root";
+   const int nEntries = 1000;
+   for (auto fname : {fname1, fname2}) {
+      TFile f(fname, "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(100);
+      float x;
+      int y;
+      double arr[3];
+      t.Branch("x", &x)->SetBasketSize(512);
+      t.Branch("y", &y)->SetBasketSize(1024);
+      t.Branch("arr", arr, "arr[3]/D");
+      for (int i = 0; i < nEntries; ++i) {
+         x = i;
+         y = -i;
+         arr[0] = i;
+         arr[1] = 2 * i;
+         arr[2] = 3 * i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TChain c("t");
+   c.Add(fname1);
+   c.Add(fname2);
+   ROOT::RDataFrame df(c);
+   const double expected = 2 * (nEntries * (nEntries - 1) / 2.);
+   auto sumX = df.Sum<float>("x");
+   auto sumY = df.Sum<int>("y");
+   auto sumArr = df.Define("s", [](const RVec<double> &a) { return Sum(a); }, {"arr"}).Sum<double>("s");
+   // Entries skipped by the filter are not read at all
+   auto nSelected = df.Filter([](int y) { return y % 3 == 0; }, {"y"})
+                       .Filter([](float x, const RVec<double> &a) { return a[1] == 2 * x; }, {"x", "arr"})
+                       .Count();
+   EXPECT_DOUBLE_EQ(expected, *sumX);
+   EXPECT_DOUBLE_EQ(-expected, *sumY);
+   EXPECT_DOUBLE_EQ(6 * expected, *sumArr);
+   EXPECT_EQ(2U * 334U, *nSelected);
+
+   gSystem->Unlink(fname1);
+   gSystem->Unlink(fname2);
+}
+
+TEST_P(RDFSimpleTests, BulkReadCollectionCounts)
+{
+   const auto fname = "test_bulkreadcollectioncounts.root";
+   const int nEntries = 1000;
+   {
+      TFile f(fname, "RECREATE");
+      TTree t("t", "t");
+      ROOT::TIOFeatures features;
+      features.Set(ROOT::Experimental::EIOFeatures::kCollectionCounts);
+      t.SetIOFeatures(features);
+      t.SetAutoFlush(100);
+      std::vector<float> v;
+      t.Branch("v", &v);
+      for (int i = 0; i < nEntries; ++i) {
+         v.assign(i % 4, float(i));
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   ROOT::RDataFrame df("t", fname);
+   auto sumV = df.Define("s", [](const RVec<float> &v) { return double(Sum(v)); }, {"v"}).Sum<double>("s");
+   auto sizes = df.Define("n", [](const RVec<float> &v) { return int(v.size()); }, {"v"}).Sum<int>("n");
+   // Entries skipped by the first filter are not read, so that baskets are also entered in the middle
+   auto nMatching = df.Filter([](ULong64_t e) { return e % 7 == 0; }, {"rdfentry_"})
+                       .Filter([](ULong64_t e, const RVec<float> &v) { return v.size() == e % 4 && (v.empty() || v[0] == e); },
+                               {"rdfentry_", "v"})
+                       .Count();
+   double expected = 0;
+   int expectedSizes = 0;
+   for (int i = 0; i < nEntries; ++i) {
+      expected += (i % 4) * float(i);
+      expectedSizes += i % 4;
+   }
+   EXPECT_DOUBLE_EQ(expected, *sumV);
+   EXPECT_EQ(expectedSizes, *sizes);
+   EXPECT_EQ(143U, *nMatching);
+
+   gSystem->Unlink(fname);
+}
+
 // run single-thread tests
 INSTANTIATE_TEST_SUITE_P(Seq, RDFSimpleTests, ::testing::Values(false));
 
@@ -0,0 +1,114 @@
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RVec.hxx"
+#include "TH1D.h"
+
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+
+using namespace ROOT;
+using ROOT::RDF::Experimental::VariationsFor;
+using ROOT::VecOps::RVec;
+
+namespace {
+ROOT::RDF::RNode MakeVariedDF(RDataFrame &df)
+{
+   return df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+      .Vary("x", [](double x) { return RVec<double>{x - 1., x + 1.}; }, {"x"}, {"down", "up"});
+}
+} // anonymous namespace
+
+TEST(RDFVary, SimpleSum)
+{
+   RDataFrame df(10);
+   auto sum = MakeVariedDF(df).Sum<double>("x");
+   auto sums = VariationsFor(sum);
+
+   EXPECT_EQ(sums.GetKeys(), std::vector<std::string>({"nominal", "x:down", "x:up"}));
+   EXPECT_DOUBLE_EQ(sums["nominal"], 45.);
+   EXPECT_DOUBLE_EQ(sums["x:down"], 35.);
+   EXPECT_DOUBLE_EQ(sums["x:up"], 55.);
+   EXPECT_DOUBLE_EQ(*sum, 45.);
+   EXPECT_THROW(sums["x:sideways"], std::runtime_error);
+}
+
+TEST(RDFVary, OnlyAffectedNodesAreReevaluated)
+{
+   RDataFrame df(10);
+   unsigned int nIndependent = 0u;
+   unsigned int nDependent = 0u;
+   auto sum = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                 .Define("y",
+                         [&nIndependent](ULong64_t e) {
+                            ++nIndependent;
+                            return double(e);
+                         },
+                         {"rdfentry_"})
+                 .Vary("x", [](double x) { return RVec<double>{x - 1., x + 1.}; }, {"x"}, 2, "shift")
+                 .Define("z",
+                         [&nDependent](double x, double y) {
+                            ++nDependent;
+                            return x + y;
+                         },
+                         {"x", "y"})
+                 .Filter([](double z) { return z > 5.; }, {"z"})
+                 .Sum<double>("z");
+   auto sums = VariationsFor(sum);
+
+   EXPECT_DOUBLE_EQ(sums["nominal"], 84.);
+   EXPECT_DOUBLE_EQ(sums["shift:0"], 72.);
+   EXPECT_DOUBLE_EQ(sums["shift:1"], 91.);
+   // a single event loop, in which the nodes that do not depend on the variation are evaluated once per entry
+   EXPECT_EQ(df.GetNRuns(), 1u);
+   EXPECT_EQ(nIndependent, 10u);
+   EXPECT_EQ(nDependent, 30u);
+}
+
+TEST(RDFVary, JittedNodes)
+{
+   RDataFrame df(10);
+   auto h = MakeVariedDF(df).Filter("x > 2").Histo1D({"h", "h", 20, -5., 15.}, "x");
+   auto hs = VariationsFor(h);
+
+   EXPECT_EQ(hs["nominal"].GetEntries(), 7);
+   EXPECT_EQ(hs["x:down"].GetEntries(), 6);
+   EXPECT_EQ(hs["x:up"].GetEntries(), 8);
+   EXPECT_DOUBLE_EQ(hs["x:up"].GetMean(), hs["nominal"].GetMean() + 0.5);
+}
+
+TEST(RDFVary, NoVariations)
+{
+   RDataFrame df(10);
+   auto sum = MakeVariedDF(df).Sum<ULong64_t>("rdfentry_");
+   auto sums = VariationsFor(sum);
+
+   EXPECT_EQ(sums.GetKeys(), std::vector<std::string>({"nominal"}));
+   EXPECT_EQ(sums["nominal"], 45u);
+}
+
+TEST(RDFVary, WrongNumberOfVariations)
+{
+   RDataFrame df(10);
+   auto sum = df.Define("x", [] { return 1.; })
+                 .Vary("x", [](double x) { return RVec<double>{x}; }, {"x"}, {"down", "up"})
+                 .Sum<double>("x");
+   auto sums = VariationsFor(sum);
+   EXPECT_THROW(sums["nominal"], std::runtime_error);
+}
+
+TEST(RDFVary, WrongVariedType)
+{
+   RDataFrame df(10);
+   auto d = df.Define("x", [] { return 1.; });
+   EXPECT_THROW(d.Vary("x", [](double x) { return RVec<float>{float(x)}; }, {"x"}, {"up"}), std::runtime_error);
+   EXPECT_THROW(d.Vary("x", [](double x) { return RVec<int>{int(x)}; }, {"x"}, {"up"}), std::runtime_error);
+   EXPECT_NO_THROW(d.Vary("x", [](double x) { return RVec<double>{x}; }, {"x"}, {"up"}));
+}
+
+TEST(RDFVary, AfterEventLoop)
+{
+   RDataFrame df(10);
+   auto sum = MakeVariedDF(df).Sum<double>("x");
+   EXPECT_DOUBLE_EQ(*sum, 45.);
+   EXPECT_THROW(VariationsFor(sum), std::logic_error);
+}
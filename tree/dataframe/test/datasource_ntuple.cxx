@@ -1,12 +1,23 @@
+#include <ROOT/RCacheOptions.hxx>
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/RNTupleDS.hxx>
 
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RPageStorage.hxx>
+#include <ROOT/RSnapshotOptions.hxx>
+#include <ROOT/RVec.hxx>
+#include <TROOT.h>
+#include <TSystem.h>
 
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 using ROOT::Experimental::RNTupleDS;
 using ROOT::Experimental::RNTupleWriter;
 using ROOT::Experimental::RNTupleModel;
@@ -56,3 +67,158 @@ TEST_F(RNTupleDSTest, ColTypeNames)
    EXPECT_STREQ("std::string", tds.GetTypeName("tag").c_str());
    EXPECT_STREQ("float", tds.GetTypeName("energy").c_str());
 }
+
+namespace {
+/// Snapshot a few columns to RNTuple, check the output and return its number of clusters
+std::size_t SnapshotToRNTuple(const std::string &fileName)
+{
+   ROOT::RDataFrame df(100);
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   opts.fAutoFlush = 10;
+   auto out = df.Define("i", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                 .Define("x", [](int i) { return float(i) * 0.5f; }, {"i"})
+                 .Define("v", [](int i) { return ROOT::RVec<double>(i % 3, double(i)); }, {"i"})
+                 .Snapshot<int, float, ROOT::RVec<double>>("ntuple", fileName, {"i", "x", "v"}, opts);
+
+   double expectedVSum = 0.;
+   for (int i = 0; i < 100; ++i)
+      expectedVSum += (i % 3) * i;
+   // the entries of different slots might be interleaved, hence only check sums
+   auto count = out->Count();
+   auto iSum = out->Sum<std::int32_t>("i");
+   auto xSum = out->Sum<float>("x");
+   // RVec columns are read as std::vector
+   auto vSum = out->Define("vsum", [](const std::vector<double> &v) { return std::accumulate(v.begin(), v.end(), 0.); },
+                           {"v"})
+                  .Sum<double>("vsum");
+   EXPECT_EQ(*count, 100ull);
+   EXPECT_EQ(*iSum, 4950);
+   EXPECT_DOUBLE_EQ(*xSum, 2475.);
+   EXPECT_DOUBLE_EQ(*vSum, expectedVSum);
+
+   return ROOT::Experimental::RNTupleReader::Open("ntuple", fileName)->GetDescriptor().GetNClusters();
+}
+} // anonymous namespace
+
+TEST(RNTupleDSSnapshot, Sequential)
+{
+   const std::string fileName = "RNTupleDS_snapshot.root";
+   // one cluster every fAutoFlush entries
+   EXPECT_EQ(SnapshotToRNTuple(fileName), 10u);
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDSSnapshot, UnsupportedOptions)
+{
+   ROOT::RDataFrame df(1);
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   opts.fLazy = true;
+   auto withLong = df.Define("l", [] { return Long64_t(1); });
+   EXPECT_THROW(withLong.Snapshot<Long64_t>("ntuple", "RNTupleDS_snapshot_unsupported.root", {"l"}, opts),
+                std::runtime_error);
+   opts.fMode = "UPDATE";
+   auto withInt = df.Define("i", [] { return 1; });
+   EXPECT_THROW(withInt.Snapshot<int>("ntuple", "RNTupleDS_snapshot_unsupported.root", {"i"}, opts),
+                std::runtime_error);
+}
+
+#ifdef R__USE_IMT
+TEST(RNTupleDSSnapshot, MultiThread)
+{
+   ROOT::EnableImplicitMT(4);
+   const std::string fileName = "RNTupleDS_snapshot_mt.root";
+   // the slots fill clusters independently, and each commits a partial cluster at the end
+   EXPECT_GE(SnapshotToRNTuple(fileName), 10u);
+   std::remove(fileName.c_str());
+   ROOT::DisableImplicitMT();
+}
+#endif
+
+namespace {
+unsigned int CountFiles(const std::string &dir)
+{
+   unsigned int nFiles = 0;
+   auto dirp = gSystem->OpenDirectory(dir.c_str());
+   while (auto entry = gSystem->GetDirEntry(dirp)) {
+      if (std::string(entry).find("rdfcache_") == 0)
+         ++nFiles;
+   }
+   gSystem->FreeDirectory(dirp);
+   return nFiles;
+}
+
+/// Cache a few columns within the given memory budget, check the cached values and return the number of scratch files
+unsigned int CacheWithBudget(std::size_t memoryBudget)
+{
+   const std::string scratchDir = "RNTupleDS_cache";
+   gSystem->mkdir(scratchDir.c_str());
+   ROOT::RDF::RCacheOptions opts;
+   opts.fMemoryBudget = memoryBudget;
+   opts.fScratchDir = scratchDir;
+
+   double expectedXSum = 0.;
+   double expectedVSum = 0.;
+   for (int i = 0; i < 100000; i += 2) {
+      expectedXSum += i;
+      expectedVSum += (i % 3) * i;
+   }
+   const double expectedBSum = 25000. * 49998.;
+
+   unsigned int nFiles = 0;
+   {
+      ROOT::RDataFrame df(100000);
+      auto cached = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                       .Filter([](double x) { return int(x) % 2 == 0; }, {"x"})
+                       .Define("v", [](double x) { return ROOT::RVec<double>(int(x) % 3, x); }, {"x"})
+                       .Define("b", [](double x) { return int(x) % 4 == 0; }, {"x"})
+                       .Cache<double, ROOT::RVec<double>, bool>({"x", "v", "b"}, opts);
+      // every event loop reads the cached values again
+      for (int i = 0; i < 2; ++i) {
+         auto count = cached.Count();
+         auto xSum = cached.Sum<double>("x");
+         auto vSum =
+            cached.Define("vsum", [](const ROOT::RVec<double> &v) { return ROOT::VecOps::Sum(v); }, {"v"})
+               .Sum<double>("vsum");
+         // bool columns are copied rather than read in place
+         auto bSum = cached.Filter([](bool b) { return b; }, {"b"}).Sum<double>("x");
+         EXPECT_EQ(*count, 50000ull);
+         EXPECT_DOUBLE_EQ(*xSum, expectedXSum);
+         EXPECT_DOUBLE_EQ(*vSum, expectedVSum);
+         EXPECT_DOUBLE_EQ(*bSum, expectedBSum);
+      }
+      nFiles = CountFiles(scratchDir);
+   }
+   // the scratch file is removed together with the cached dataframe
+   EXPECT_EQ(CountFiles(scratchDir), 0u);
+   gSystem->Unlink(scratchDir.c_str());
+   return nFiles;
+}
+} // anonymous namespace
+
+TEST(RNTupleDSCache, InMemory)
+{
+   EXPECT_EQ(CacheWithBudget(1ull << 30), 0u);
+}
+
+TEST(RNTupleDSCache, Spill)
+{
+   EXPECT_EQ(CacheWithBudget(1), 1u);
+}
+
+#ifdef R__USE_IMT
+TEST(RNTupleDSCache, InMemoryMultiThread)
+{
+   ROOT::EnableImplicitMT(4);
+   EXPECT_EQ(CacheWithBudget(1ull << 30), 0u);
+   ROOT::DisableImplicitMT();
+}
+
+TEST(RNTupleDSCache, SpillMultiThread)
+{
+   ROOT::EnableImplicitMT(4);
+   EXPECT_EQ(CacheWithBudget(1), 1u);
+   ROOT::DisableImplicitMT();
+}
+#endif
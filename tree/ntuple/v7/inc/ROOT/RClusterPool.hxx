@@ -41,7 +41,12 @@ class RPageSource;
 \ingroup NTuple
 \brief Managed a set of clusters containing compressed and packed pages
 
-The cluster pool steers the preloading of (partial) clusters.
+The cluster pool steers the preloading of (partial) clusters. There is a two-step pipeline: in a first step,
+compressed pages are read from clusters into a memory buffer. The second pipeline step decompresses the pages
+and pushes them into the page pool. The actual logic of reading and unzipping is implemented by the page source.
+The cluster pool only orchestrates the work queues for reading and unzipping. It uses two threads, one for
+each pipeline step. The I/O thread for reading waits for data from storage and generates no CPU load.
+The unzip thread hands out the decompression of the individual pages to the page source's task scheduler.
 */
 // clang-format on
 class RClusterPool {
@@ -57,7 +62,14 @@ private:
       RPageSource::ColumnSet_t fColumns;
    };
 
-   /// Clusters that are currently being processed by the I/O thread.  Every in-flight cluster has a corresponding
+   /// Clusters that arrived from storage and are handed over to the unzip thread.  An empty fCluster pointer
+   /// signals the unzip thread to terminate.
+   struct RUnzipItem {
+      std::unique_ptr<RCluster> fCluster;
+      std::promise<std::unique_ptr<RCluster>> fPromise;
+   };
+
+   /// Clusters that are currently being processed by the pipeline.  Every in-flight cluster has a corresponding
    /// work item.
    struct RInFlightCluster {
       std::future<std::unique_ptr<RCluster>> fFuture;
@@ -94,10 +106,21 @@ private:
    /// The communication channel to the I/O thread
    std::queue<RWorkItem> fWorkQueue;
 
-   /// The I/O thread calls RPageSource::LoadCluster() asynchronously.  The thread is mostly waiting for the
-   /// data to arrive (blocked by the kernel) and therefore can safely run in addition to the application
-   /// main threads.
+   /// The unzip queue is only shared between the I/O thread and the unzip thread
+   std::mutex fLockUnzipQueue;
+   /// Signals a non-empty unzip queue
+   std::condition_variable fCvHasUnzipWork;
+   /// The communication channel between the I/O thread and the unzip thread
+   std::queue<RUnzipItem> fUnzipQueue;
+
+   /// The I/O thread calls RPageSource::LoadClusterAsync() for all the queued work items before it waits for the
+   /// first of them, such that the reads of several clusters can be in flight at the same time.  The thread is mostly
+   /// waiting for the data to arrive (blocked by the kernel) and therefore can safely run in addition to the
+   /// application main threads.
    std::thread fThreadIo;
+   /// The unzip thread takes a loaded cluster and passes it to fPageSource.UnzipCluster() on it. If implicit
+   /// multi-threading is turned off, the UnzipCluster() call is a no-op.
+   std::thread fThreadUnzip;
 
    /// Every cluster id has at most one corresponding RCluster pointer in the pool
    RCluster *FindInPool(DescriptorId_t clusterId) const;
@@ -106,6 +129,9 @@ private:
    size_t FindFreeSlot() const;
    /// The I/O thread routine, there is exactly one I/O thread in-flight for every cluster pool
    void ExecLoadClusters();
+   /// The unzip thread routine which takes a loaded cluster and passes it to fPageSource.UnzipCluster (which
+   /// might be a no-op if IMT is off). Marks the cluster as ready to be picked up by the main thread.
+   void ExecUnzipClusters();
    /// Returns the given cluster from the pool, which needs to contain at least the columns `columns`.
    /// Executed at the end of GetCluster when all missing data pieces have been sent to the load queue.
    /// Ideally, the function returns without blocking if the cluster is already in the pool.
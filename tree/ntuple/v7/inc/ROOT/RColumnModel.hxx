@@ -48,6 +48,14 @@ enum class EColumnType {
    kInt64,
    kInt32,
    kInt16,
+   // Encoded variants of the above types; in memory, they have the layout of their base type.  On storage, the bytes
+   // of the elements of a page are split ("shuffled"), such that all the first bytes come first, followed by all the
+   // second bytes, and so on.  Index columns are delta encoded and integer columns are zigzag encoded before splitting.
+   kSplitIndex,
+   kSplitReal64,
+   kSplitReal32,
+   kSplitInt64,
+   kSplitInt32,
 };
 
 // clang-format off
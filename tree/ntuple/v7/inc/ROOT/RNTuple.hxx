@@ -25,8 +25,10 @@
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <functional>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <utility>
 
@@ -38,10 +40,33 @@ namespace Experimental {
 class REntry;
 class RNTupleModel;
 
+class TTaskGroup;
+
 namespace Detail {
 class RPageSink;
 class RPageSource;
-}
+
+#ifdef R__USE_IMT
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RNTupleImtTaskScheduler
+\ingroup NTuple
+\brief Runs the page (de)compression tasks of a page storage in the implicit multi-threading task arena
+*/
+// clang-format on
+class RNTupleImtTaskScheduler : public RPageStorage::RTaskScheduler {
+private:
+   std::unique_ptr<TTaskGroup> fTaskGroup;
+
+public:
+   RNTupleImtTaskScheduler();
+   virtual ~RNTupleImtTaskScheduler();
+   void Reset() final;
+   void AddTask(const std::function<void(void)> &taskFunc) final;
+   void Wait() final;
+};
+#endif
+} // namespace Detail
 
 
 /**
@@ -76,6 +101,10 @@ Individual fields can be read as well by instantiating a tree view.
 // clang-format on
 class RNTupleReader {
 private:
+   /// Set as the page source's scheduler for parallel page decompression if IMT is on
+   /// Needs to be destructed after the page source is destructed (and thus be declared before)
+   std::unique_ptr<Detail::RPageStorage::RTaskScheduler> fUnzipTasks;
+
    std::unique_ptr<Detail::RPageSource> fSource;
    /// Needs to be destructed before fSource
    std::unique_ptr<RNTupleModel> fModel;
@@ -87,6 +116,7 @@ private:
 
    void ConnectModel(const RNTupleModel &model);
    RNTupleReader *GetDisplayReader();
+   void InitPageSource();
 
 public:
    // Browse through the entries
@@ -232,6 +262,94 @@ public:
    void CommitCluster();
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleFillContext
+\ingroup NTuple
+\brief A per-thread context to fill entries into an ntuple that is written by an RNTupleParallelWriter
+
+The fill context has its own clone of the writer's model and its own buffered page sink.  Filling entries and
+compressing pages is done independently from other fill contexts.  Only when a cluster is committed, the sealed pages
+are handed over to the writer's page sink under a lock.  A fill context must only be used by one thread at a time,
+and it must be destructed before the writer that created it.  Destructing the fill context commits the outstanding
+entries.
+*/
+// clang-format on
+class RNTupleFillContext {
+   friend class RNTupleParallelWriter;
+
+private:
+   static constexpr NTupleSize_t kDefaultClusterSizeEntries = 64000;
+   /// Set as the page sink's scheduler for parallel page compression if IMT is on
+   /// Needs to be destructed after the page sink is destructed (and thus be declared before)
+   std::unique_ptr<Detail::RPageStorage::RTaskScheduler> fZipTasks;
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// Needs to be destructed before fSink
+   std::unique_ptr<RNTupleModel> fModel;
+   NTupleSize_t fClusterSizeEntries;
+   NTupleSize_t fLastCommitted;
+   NTupleSize_t fNEntries;
+
+   RNTupleFillContext(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+
+public:
+   RNTupleFillContext(const RNTupleFillContext&) = delete;
+   RNTupleFillContext& operator=(const RNTupleFillContext&) = delete;
+   ~RNTupleFillContext();
+
+   /// The fill context's clone of the writer's model, used to get the fill context's default entry and fields
+   RNTupleModel *GetModel() { return fModel.get(); }
+   /// Number of entries filled through this fill context
+   NTupleSize_t GetNEntries() const { return fNEntries; }
+
+   void Fill() { Fill(*fModel->GetDefaultEntry()); }
+   /// The entry must have been created from the fill context's model
+   void Fill(REntry &entry) {
+      for (auto& value : entry) {
+         value.GetField()->Append(value);
+      }
+      fNEntries++;
+      if ((fNEntries % fClusterSizeEntries) == 0)
+         CommitCluster();
+   }
+   /// Seals the pages of the entries filled so far and appends them as a new cluster to the writer's page sink
+   void CommitCluster();
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief An RNTuple that gets filled concurrently from multiple threads
+
+Every thread obtains its own RNTupleFillContext through CreateFillContext() and fills entries into it.  The fill
+contexts write complete clusters to the common page sink, so that the entries of one cluster stem from a single fill
+context.  The order of the entries between fill contexts is not defined.  The data set is committed when the parallel
+writer is destructed; by that time, all the fill contexts must have been destructed.
+*/
+// clang-format on
+class RNTupleParallelWriter {
+private:
+   /// Protects the page sink against concurrent cluster commits of the fill contexts
+   std::mutex fSinkLock;
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// The model that the fill contexts clone; needs to be destructed before fSink
+   std::unique_ptr<RNTupleModel> fModel;
+
+public:
+   static std::unique_ptr<RNTupleParallelWriter> Recreate(std::unique_ptr<RNTupleModel> model,
+                                                          std::string_view ntupleName,
+                                                          std::string_view storage,
+                                                          const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+   RNTupleParallelWriter(const RNTupleParallelWriter&) = delete;
+   RNTupleParallelWriter& operator=(const RNTupleParallelWriter&) = delete;
+   ~RNTupleParallelWriter();
+
+   /// Thread-safe; every filling thread should use its own fill context
+   std::unique_ptr<RNTupleFillContext> CreateFillContext();
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::RCollectionNTuple
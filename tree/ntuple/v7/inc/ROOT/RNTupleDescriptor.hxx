@@ -177,18 +177,27 @@ public:
       /// The usual format for ROOT compression settings (see Compression.h).
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// Optionally, the minimum and maximum value of the column elements in the cluster, for columns of arithmetic
+      /// type (see RNTupleWriteOptions::SetWriteColumnStats()).  Integers that are not representable as double
+      /// are rounded outwards, such that [fMin, fMax] always includes all the values.
+      bool fHasStats = false;
+      double fMin = 0.0;
+      double fMax = 0.0;
 
       bool operator==(const RColumnRange &other) const {
          return fColumnId == other.fColumnId && fFirstElementIndex == other.fFirstElementIndex &&
-                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
+                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
+                fHasStats == other.fHasStats && fMin == other.fMin && fMax == other.fMax;
       }
 
       bool Contains(NTupleSize_t index) const {
          return (fFirstElementIndex <= index && (fFirstElementIndex + fNElements) > index);
       }
+
+      /// Returns false only if the statistics prove that no element of the column range is within [min, max]
+      bool MayContainValues(double min, double max) const {
+         return !fHasStats || ((fNElements > 0) && (fMin <= max) && (fMax >= min));
+      }
    };
 
    /// Records the parition of data into pages for a particular column in a particular cluster
@@ -235,7 +244,7 @@ private:
 
 public:
    /// In order to handle changes to the serialization routine in future ntuple versions
-   static constexpr std::uint16_t kFrameVersionCurrent = 0;
+   static constexpr std::uint16_t kFrameVersionCurrent = 1;
    static constexpr std::uint16_t kFrameVersionMin = 0;
 
    RClusterDescriptor() = default;
@@ -46,6 +46,13 @@ All page sink classes need to support the common options.
 class RNTupleWriteOptions {
   int fCompression{RCompressionSetting::EDefaults::kUseAnalysis};
   ENTupleContainerFormat fContainerFormat{ENTupleContainerFormat::kTFile};
+  /// Store integer, index, and floating point columns with byte split (and delta or zigzag) encoding, which
+  /// typically compresses better.  Columns with split encoding need to be unpacked on reading, so their pages
+  /// cannot be used in place from a memory mapped file.  Off by default.
+  bool fUseSplitEncoding{false};
+  /// Store the minimum and maximum value of every arithmetic column in every cluster, which lets readers skip
+  /// clusters that cannot pass a cut on the column's values.
+  bool fWriteColumnStats{false};
 
 public:
   int GetCompression() const { return fCompression; }
@@ -56,6 +63,12 @@ public:
 
   ENTupleContainerFormat GetContainerFormat() const { return fContainerFormat; }
   void SetContainerFormat(ENTupleContainerFormat val) { fContainerFormat = val; }
+
+  bool GetUseSplitEncoding() const { return fUseSplitEncoding; }
+  void SetUseSplitEncoding(bool val) { fUseSplitEncoding = val; }
+
+  bool GetWriteColumnStats() const { return fWriteColumnStats; }
+  void SetWriteColumnStats(bool val) { fWriteColumnStats = val; }
 };
 
 
@@ -78,10 +91,16 @@ public:
 
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
+   /// Memory map local files.  Pages that are neither compressed nor packed are then used in place, i.e. the page
+   /// buffers point directly into the mapped file.  The cluster cache is not used for memory mapped files.
+   bool fUseMmap = false;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
+
+   bool GetUseMmap() const { return fUseMmap; }
+   void SetUseMmap(bool val) { fUseMmap = val; }
 };
 
 } // namespace Experimental
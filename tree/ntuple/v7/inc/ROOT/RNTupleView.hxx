@@ -18,8 +18,10 @@
 
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -145,7 +147,17 @@ The view owns a field and its underlying columns in order to fill an ntuple valu
 accessed by index. For top-level fields, the index refers to the entry number. Fields that are part of
 nested collections have global index numbers that are derived from their parent indexes.
 
-Fields of simple types with a Map() method will use that and thus expose zero-copy access.
+Fields of simple types with a Map() method will use that and thus expose zero-copy access.  For such fields,
+GetBulk() returns the values of a range of consecutive elements as a span into the current page, such that loops over
+the values do not need a call per element:
+
+~~~ {.cpp}
+for (NTupleSize_t i = 0; i < nEntries; ) {
+   auto values = view.GetBulk(i, nEntries - i);
+   for (auto v : values) { ... }
+   i += values.size();
+}
+~~~
 */
 // clang-format on
 template <typename T>
@@ -197,6 +209,25 @@ public:
       fField.Read(clusterIndex, &fValue);
       return *fValue.Get<T>();
    }
+
+   /// Returns the values of up to maxItems consecutive elements starting at globalIndex.  The span ends early at the
+   /// boundary of the page that contains globalIndex; it is never empty for a valid index.  The span points into the
+   /// page and remains valid until the view is used with an index that is not part of this page.
+   template <typename C = T>
+   typename std::enable_if_t<Internal::IsMappable<FieldT>::value, std::span<const C>>
+   GetBulk(NTupleSize_t globalIndex, NTupleSize_t maxItems) {
+      NTupleSize_t nItems;
+      auto values = fField.MapV(globalIndex, nItems);
+      return std::span<const C>(values, std::min(nItems, maxItems));
+   }
+
+   template <typename C = T>
+   typename std::enable_if_t<Internal::IsMappable<FieldT>::value, std::span<const C>>
+   GetBulk(const RClusterIndex &clusterIndex, NTupleSize_t maxItems) {
+      NTupleSize_t nItems;
+      auto values = fField.MapV(clusterIndex, nItems);
+      return std::span<const C>(values, std::min(nItems, maxItems));
+   }
 };
 
 
@@ -252,6 +283,18 @@ public:
       return RNTupleViewCollection(fieldId, fSource);
    }
 
+   /// Bulk access to the offsets of up to maxItems collections starting at globalIndex, ending early at the page
+   /// boundary.  Offsets are cluster-local: the items of collection i in the returned span are in the range
+   /// [(i == 0) ? collectionStart->GetIndex() : offsets[i - 1], offsets[i]) of the cluster of collectionStart.
+   /// The items themselves can be read in bulk through the views of the nested fields.
+   std::span<const ClusterSize_t> GetBulkOffsets(NTupleSize_t globalIndex, NTupleSize_t maxItems,
+                                                 RClusterIndex *collectionStart)
+   {
+      ClusterSize_t size;
+      fField.GetCollectionInfo(globalIndex, collectionStart, &size);
+      return GetBulk(globalIndex, maxItems);
+   }
+
    ClusterSize_t operator()(NTupleSize_t globalIndex) {
       ClusterSize_t size;
       RClusterIndex collectionStart;
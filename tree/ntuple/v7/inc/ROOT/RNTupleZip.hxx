@@ -94,12 +94,20 @@ public:
    /// Returns the size of the compressed data block. The data is written into the zip buffer.
    /// This works only for small input buffer up to 16MB
    size_t operator() (const void *from, size_t nbytes, int compression) {
+      return Zip(from, nbytes, compression, fZipBuffer->data());
+   }
+
+   /// Returns the size of the compressed data block written into `to`, which needs to provide space for at least
+   /// `nbytes`.  Uncompressible data is copied verbatim.  As opposed to the operator(), this method does not use the
+   /// internal zip buffer and can be called concurrently from multiple threads.
+   static size_t Zip(const void *from, size_t nbytes, int compression, void *to) {
       R__ASSERT(from != nullptr);
+      R__ASSERT(to != nullptr);
       R__ASSERT(nbytes <= kMAXZIPBUF);
 
       auto cxLevel = compression % 100;
       if (cxLevel == 0) {
-         memcpy(fZipBuffer->data(), from, nbytes);
+         memcpy(to, from, nbytes);
          return nbytes;
       }
 
@@ -107,18 +115,18 @@ public:
       int szSource = nbytes;
       char *source = const_cast<char *>(static_cast<const char *>(from));
       int szTarget = nbytes;
-      char *target = reinterpret_cast<char *>(fZipBuffer->data());
+      char *target = reinterpret_cast<char *>(to);
       int szOut = 0;
       R__zipMultipleAlgorithm(cxLevel, &szSource, source, &szTarget, target, &szOut, cxAlgorithm);
       R__ASSERT(szOut >= 0);
       if ((szOut > 0) && (static_cast<unsigned int>(szOut) < nbytes))
          return szOut;
 
-      memcpy(fZipBuffer->data(), from, nbytes);
+      memcpy(to, from, nbytes);
       return nbytes;
    }
 
-   const void *GetZipBuffer() { return fZipBuffer->data(); }
+   void *GetZipBuffer() { return fZipBuffer->data(); }
 };
 
 
@@ -144,6 +152,23 @@ public:
     * The block is uncompressed iff nbytes == dataLen.
     */
    void operator() (const void *from, size_t nbytes, size_t dataLen, void *to) {
+      Unzip(from, nbytes, dataLen, to);
+   }
+
+   /**
+    * In-place decompression via unzip buffer
+    */
+   void operator() (void *fromto, size_t nbytes, size_t dataLen) {
+      R__ASSERT(dataLen <= kMAXZIPBUF);
+      Unzip(fromto, nbytes, dataLen, fUnzipBuffer->data());
+      memcpy(fromto, fUnzipBuffer->data(), dataLen);
+   }
+
+   /**
+    * Out-of-place decompression that does not need the unzip buffer; it can therefore be used concurrently,
+    * e.g. by multiple page unzip tasks.
+    */
+   static void Unzip(const void *from, size_t nbytes, size_t dataLen, void *to) {
       if (dataLen == nbytes) {
          memcpy(to, from, nbytes);
          return;
@@ -173,15 +198,6 @@ public:
       } while (szRemaining > 0);
       R__ASSERT(szRemaining == 0);
    }
-
-   /**
-    * In-place decompression via unzip buffer
-    */
-   void operator() (void *fromto, size_t nbytes, size_t dataLen) {
-      R__ASSERT(dataLen <= kMAXZIPBUF);
-      operator()(fromto, nbytes, dataLen, fUnzipBuffer->data());
-      memcpy(fromto, fUnzipBuffer->data(), dataLen);
-   }
 };
 
 } // namespace Detail
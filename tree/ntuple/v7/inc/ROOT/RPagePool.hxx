@@ -21,6 +21,7 @@
 #include <ROOT/RNTupleUtil.hxx>
 
 #include <cstddef>
+#include <mutex>
 #include <vector>
 
 namespace ROOT {
@@ -39,8 +40,9 @@ pages is thread-safe. The page pool does not allocate the memory -- allocation a
 page storage, which might do it in a way optimized to the backing store (e.g., mmap()).
 Multiple page caches can coexist.
 
-TODO(jblomer): it should be possible to register pages and to find them by column and index; this would
-facilitate pre-filling a cache, e.g. by read-ahead.
+Pages can be preloaded into the pool, e.g. by the background unzipping of clusters. Preloaded pages have a reference
+counter of zero until they are requested by GetPage(). Preloaded pages that are never requested are released by
+EvictCluster() once their cluster is dropped from the cluster cache, or else when the page pool is destructed.
 */
 // clang-format on
 class RPagePool {
@@ -53,16 +55,23 @@ private:
    std::vector<RPage> fPages;
    std::vector<std::uint32_t> fReferences;
    std::vector<RPageDeleter> fDeleters;
+   /// The number of preloaded pages that have not been requested yet, i.e. the pages with a reference counter of zero
+   std::size_t fNIdlePages = 0;
+   /// Pages are registered and returned concurrently by the reader thread and by the cluster unzip tasks
+   std::mutex fLock;
 
 public:
    RPagePool() = default;
    RPagePool(const RPagePool&) = delete;
    RPagePool& operator =(const RPagePool&) = delete;
-   ~RPagePool() = default;
+   ~RPagePool();
 
    /// Adds a new page to the pool together with the function to free its space. Upon registration,
    /// the page pool takes ownership of the page's memory. The new page has its reference counter set to 1.
    void RegisterPage(const RPage &page, const RPageDeleter &deleter);
+   /// Like RegisterPage() but the reference counter is initialized to 0, i.e. the page is only kept in the pool
+   /// for a future GetPage() call
+   void PreloadPage(const RPage &page, const RPageDeleter &deleter);
    /// Tries to find the page corresponding to column and index in the cache. If the page is found, its reference
    /// counter is increased
    RPage GetPage(ColumnId_t columnId, NTupleSize_t globalIndex);
@@ -71,6 +80,9 @@ public:
    /// this page. If the reference counter drops to zero, the page pool might decide to call the deleter given in
    /// during registration.
    void ReturnPage(const RPage &page);
+   /// Releases the preloaded pages of the given cluster that have not been requested
+   void EvictCluster(DescriptorId_t clusterId);
+   std::size_t GetNIdlePages();
 };
 
 } // namespace Detail
@@ -0,0 +1,94 @@
+/// \file ROOT/RPageSinkBuf.hxx
+/// \ingroup NTuple ROOT7
+/// \author The ROOT Team
+/// \date 2026-10-17
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RPageSinkBuf
+#define ROOT7_RPageSinkBuf
+
+#include <ROOT/RNTupleMetrics.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RStringView.hxx>
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RPageSinkBuf
+\ingroup NTuple
+\brief Wrapper sink that buffers and seals the pages of an entire cluster before handing them to another sink
+
+Committed pages are copied and kept in memory until the cluster is committed.  If a task scheduler is set, the pages
+are packed and compressed in parallel tasks; otherwise they are sealed on commit.  On CommitCluster(), the sealed pages
+of all columns are forwarded in one go to the inner sink while holding the inner sink's lock.  Therefore, several
+buffered sinks that are filled from different threads can share the same inner sink.  All the buffered sinks must be
+created from clones of the model that was used to create the inner sink, such that column ids match.
+
+The inner sink issues the cluster and entry numbers.  The entries of a cluster from a buffered sink are appended to the
+entries already committed to the inner sink.
+*/
+// clang-format on
+class RPageSinkBuf : public RPageSink {
+private:
+   /// A page of the currently open cluster together with its sealed representation
+   struct RBufferedPage {
+      /// Copy of the committed page; released once the page is sealed into its own buffer
+      RPage fPage;
+      std::unique_ptr<unsigned char[]> fBuffer;
+      RSealedPage fSealedPage;
+   };
+
+   RNTupleMetrics fMetrics;
+   RPageSink &fInnerSink;
+   /// Serializes the cluster commits of all the buffered sinks that share the inner sink
+   std::mutex &fInnerLock;
+   /// The pages of the currently open cluster, indexed by column id.  Elements of a deque don't move when new pages
+   /// are appended, so that pages can be sealed by tasks while further pages are added.
+   std::vector<std::deque<RBufferedPage>> fBufferedColumns;
+
+   void SealBufferedPage(const RColumnElementBase &element, RBufferedPage &bufPage);
+
+protected:
+   void CreateImpl(const RNTupleModel &model) final;
+   RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
+   RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) final;
+   RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) final;
+   void CommitDatasetImpl() final;
+
+public:
+   /// The inner sink must have been created from the same model (or a clone of it) before.  The inner sink and
+   /// its lock must outlive the buffered sink.
+   RPageSinkBuf(RPageSink &innerSink, std::mutex &innerLock);
+   RPageSinkBuf(const RPageSinkBuf&) = delete;
+   RPageSinkBuf& operator=(const RPageSinkBuf&) = delete;
+   virtual ~RPageSinkBuf();
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements = 0) final;
+   void ReleasePage(RPage &page) final;
+
+   RNTupleMetrics &GetMetrics() final { return fMetrics; }
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
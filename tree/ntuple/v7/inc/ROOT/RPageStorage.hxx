@@ -16,6 +16,7 @@
 #ifndef ROOT7_RPageStorage
 #define ROOT7_RPageStorage
 
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
@@ -25,8 +26,13 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -58,8 +64,23 @@ an ntuple.  Concrete implementations can use a TFile, a raw file, an object stor
 */
 // clang-format on
 class RPageStorage {
+public:
+   /// The interface of a task scheduler to schedule page (de)compression tasks
+   class RTaskScheduler {
+   public:
+      virtual ~RTaskScheduler() = default;
+      /// Start a new set of tasks
+      virtual void Reset() = 0;
+      /// Take a callable that represents a task
+      virtual void AddTask(const std::function<void(void)> &taskFunc) = 0;
+      /// Blocks until all scheduled tasks finished
+      virtual void Wait() = 0;
+   };
+
 protected:
    std::string fNTupleName;
+   /// For parallel (de)compression of pages; not owned by the page storage. If unset, no tasks are scheduled.
+   RTaskScheduler *fTaskScheduler = nullptr;
 
 public:
    explicit RPageStorage(std::string_view name);
@@ -69,6 +90,7 @@ public:
 
    /// Whether the concrete implementation is a sink or a source
    virtual EPageStorageType GetType() = 0;
+   const std::string &GetNTupleName() const { return fNTupleName; }
 
    struct RColumnHandle {
       DescriptorId_t fId = kInvalidDescriptorId;
@@ -94,6 +116,8 @@ public:
 
    /// Returns an empty metrics.  Page storage implementations usually have their own metrics.
    virtual RNTupleMetrics &GetMetrics();
+
+   void SetTaskScheduler(RTaskScheduler *taskScheduler) { fTaskScheduler = taskScheduler; }
 };
 
 // clang-format off
@@ -108,6 +132,17 @@ up to the given entry number are committed.
 */
 // clang-format on
 class RPageSink : public RPageStorage {
+public:
+   /// A packed and possibly compressed page, ready to be written to storage.  The sealed page does not own its buffer.
+   struct RSealedPage {
+      const void *fBuffer = nullptr;
+      std::size_t fSize = 0;
+      std::uint32_t fNElements = 0;
+
+      RSealedPage() = default;
+      RSealedPage(const void *b, std::size_t s, std::uint32_t n) : fBuffer(b), fSize(s), fNElements(n) {}
+   };
+
 protected:
    RNTupleWriteOptions fOptions;
 
@@ -121,10 +156,14 @@ protected:
    std::vector<RClusterDescriptor::RColumnRange> fOpenColumnRanges;
    /// Keeps track of the written pages in the currently open cluster. Indexed by column id.
    std::vector<RClusterDescriptor::RPageRange> fOpenPageRanges;
+   /// Packs the pages of a column into their on-storage representation, which can differ from the in-memory
+   /// column element, e.g. for split encoding.  Indexed by column id.
+   std::vector<std::unique_ptr<RColumnElementBase>> fOnStorageElements;
    RNTupleDescriptorBuilder fDescriptorBuilder;
 
    virtual void CreateImpl(const RNTupleModel &model) = 0;
    virtual RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) = 0;
+   virtual RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) = 0;
    virtual RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) = 0;
    virtual void CommitDatasetImpl() = 0;
 
@@ -135,6 +174,7 @@ public:
    static std::unique_ptr<RPageSink> Create(std::string_view ntupleName, std::string_view location,
                                             const RNTupleWriteOptions &options = RNTupleWriteOptions());
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
+   const RNTupleWriteOptions &GetWriteOptions() const { return fOptions; }
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
    void DropColumn(ColumnHandle_t /*columnHandle*/) final {}
@@ -145,10 +185,23 @@ public:
    void Create(RNTupleModel &model);
    /// Write a page to the storage. The column must have been added before.
    void CommitPage(ColumnHandle_t columnHandle, const RPage &page);
+   /// Write a preprocessed page to storage. The column must have been added before.
+   void CommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage);
+   /// Merges value statistics into the column range of the open cluster, e.g. for sealed pages whose statistics were
+   /// computed by another sink.  CommitPage() calls it if RNTupleWriteOptions::GetWriteColumnStats() is set.
+   void UpdateColumnStats(DescriptorId_t columnId, double min, double max);
    /// Finalize the current cluster and create a new one for the following data.
    void CommitCluster(NTupleSize_t nEntries);
    /// Finalize the current cluster and the entrire data set.
    void CommitDataset() { CommitDatasetImpl(); }
+   /// The number of entries in all the clusters committed so far
+   NTupleSize_t GetNEntriesCommitted() const { return fPrevClusterNEntries; }
+
+   /// Packs and, if compressionSetting is not zero, compresses the page.  The result is written into buf, which must
+   /// provide space for at least the packed page.  If neither packing nor compression is needed, the sealed page
+   /// points directly to the page's buffer.  Thread-safe, so that pages of different columns can be sealed in parallel.
+   static RSealedPage SealPage(const RPage &page, const RColumnElementBase &element, int compressionSetting,
+                               void *buf);
 
    /// Get a new, empty page for the given column that can be filled with up to nElements.  If nElements is zero,
    /// the page sink picks an appropriate size.
@@ -170,13 +223,46 @@ public:
    /// Derived from the model (fields) that are actually being requested at a given point in time
    using ColumnSet_t = std::unordered_set<DescriptorId_t>;
 
+   /// Handle to a cluster whose pages are possibly still being read from storage, returned by LoadClusterAsync()
+   class RClusterLoadHandle {
+   public:
+      virtual ~RClusterLoadHandle() = default;
+      /// Blocks until the pages of the cluster arrived and hands out the cluster; must be called at most once
+      virtual std::unique_ptr<RCluster> Wait() = 0;
+   };
+
+   /// The range of entries that a reader is going to process, see SetEntryRange()
+   struct REntryRange {
+      NTupleSize_t fFirstEntry = 0;
+      NTupleSize_t fNEntries = kInvalidNTupleIndex;
+
+      /// Returns true if the given cluster has entries within the entry range
+      bool IntersectsWith(const RClusterDescriptor &clusterDesc) const;
+   };
+
 protected:
    RNTupleReadOptions fOptions;
    RNTupleDescriptor fDescriptor;
-   /// The active columns are implicitly defined by the model fields or views
+   /// By default, all the entries are going to be read
+   REntryRange fEntryRange;
+   /// The active columns are implicitly defined by the model fields or views.  Only the pages of the active columns
+   /// are read from storage.
    ColumnSet_t fActiveColumns;
+   /// Several fields or views can be connected to the same column, e.g. a model field and a view on the same field.
+   /// A column remains active until the last of its users drops it.
+   std::unordered_map<DescriptorId_t, std::size_t> fActiveColumnRefs;
+   /// Unpacks the pages of the active columns according to the column type stored in the descriptor, which can differ
+   /// from the in-memory column element, e.g. for split encoding.  Indexed by column id.
+   std::unordered_map<DescriptorId_t, std::unique_ptr<RColumnElementBase>> fOnStorageElements;
 
    virtual RNTupleDescriptor AttachImpl() = 0;
+   /// Decompresses and unpacks the pages of the cluster and puts them in the page pool.  Called by UnzipCluster()
+   /// only if a task scheduler is set.  The default implementation does nothing, such that pages are unzipped
+   /// on demand by PopulatePage().
+   virtual void UnzipClusterImpl(RCluster * /* cluster */) {}
+   /// Releases the pages that UnzipClusterImpl() preloaded for the cluster and that were never requested.  Called by
+   /// EvictCluster().  The default implementation does nothing.
+   virtual void EvictClusterImpl(DescriptorId_t /* clusterId */) {}
 
 public:
    RPageSource(std::string_view ntupleName, const RNTupleReadOptions &fOptions);
@@ -189,6 +275,13 @@ public:
 
    EPageStorageType GetType() final { return EPageStorageType::kSource; }
    const RNTupleDescriptor &GetDescriptor() const { return fDescriptor; }
+   /// The columns of the currently connected fields and views, which define the byte ranges read from storage
+   const ColumnSet_t &GetActiveColumns() const { return fActiveColumns; }
+   /// Promises that only the entries of the given range are going to be read, until the range is changed again.
+   /// The cluster cache does not preload clusters outside the range.  Used, e.g., if the entries are processed
+   /// in chunks by multiple readers, each one with its own clone of the page source.
+   void SetEntryRange(const REntryRange &range) { fEntryRange = range; }
+   REntryRange GetEntryRange() const { return fEntryRange; }
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
    void DropColumn(ColumnHandle_t columnHandle) final;
 
@@ -211,6 +304,20 @@ public:
    /// LoadCluster() is typically called from the I/O thread of a cluster pool, i.e. the method runs
    /// concurrently to other methods of the page source.
    virtual std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) = 0;
+   /// Like LoadCluster() but returns as soon as the read requests for the cluster are issued.  This allows
+   /// the cluster pool to keep multiple cluster reads in flight.  Page sources that cannot read asynchronously
+   /// use the default implementation, which calls LoadCluster() and returns an already completed handle.
+   virtual std::unique_ptr<RClusterLoadHandle> LoadClusterAsync(DescriptorId_t clusterId, const ColumnSet_t &columns);
+
+   /// Parallel decompression and unpacking of the pages in the given cluster. The unzipped pages are supposed
+   /// to be preloaded in a page pool attached to the source. The method is triggered by the cluster pool's
+   /// unzip thread. It is an optional optimization, the method can safely do nothing. In particular, the
+   /// actual implementation will only run if a task scheduler is set. In practice, a task scheduler is set
+   /// if implicit multi-threading is turned on.
+   void UnzipCluster(RCluster *cluster);
+   /// Called by the cluster pool when it drops the given cluster from its cache.  Pages that were preloaded by
+   /// UnzipCluster() for that cluster but never requested are released, so that they don't pile up in the page pool.
+   void EvictCluster(DescriptorId_t clusterId) { EvictClusterImpl(clusterId); }
 };
 
 } // namespace Detail
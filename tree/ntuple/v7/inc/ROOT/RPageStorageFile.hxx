@@ -20,26 +20,25 @@
 #include <ROOT/RMiniFile.hxx>
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RRawFile.hxx>
 #include <ROOT/RStringView.hxx>
 
 #include <array>
 #include <cstdio>
 #include <memory>
 #include <string>
+#include <vector>
 
 class TFile;
 
 namespace ROOT {
 
-namespace Internal {
-class RRawFile;
-}
-
 namespace Experimental {
 namespace Detail {
 
 class RCluster;
 class RClusterPool;
+class RColumnElementBase;
 class RPageAllocatorHeap;
 class RPagePool;
 
@@ -69,9 +68,12 @@ private:
    /// Helper for zipping keys and header / footer; comprises a 16MB zip buffer
    RNTupleCompressor fCompressor;
 
+   RClusterDescriptor::RLocator WriteSealedPage(const RSealedPage &sealedPage, std::size_t bytesPacked);
+
 protected:
    void CreateImpl(const RNTupleModel &model) final;
    RClusterDescriptor::RLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final;
+   RClusterDescriptor::RLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) final;
    RClusterDescriptor::RLocator CommitClusterImpl(NTupleSize_t nEntries) final;
    void CommitDatasetImpl() final;
 
@@ -122,14 +124,17 @@ private:
       RNTupleAtomicCounter &fNRead;
       RNTupleAtomicCounter &fSzReadPayload ;
       RNTupleAtomicCounter &fSzReadOverhead;
-      RNTuplePlainCounter  &fSzUnzip;
+      RNTupleAtomicCounter &fSzUnzip;
       RNTupleAtomicCounter &fNClusterLoaded;
       RNTuplePlainCounter  &fNPageLoaded;
       RNTuplePlainCounter  &fNPagePopulated;
+      RNTupleAtomicCounter &fNPagePreloaded;
+      RNTupleAtomicCounter &fNPageIdle;
+      RNTuplePlainCounter  &fNPageMapped;
       RNTupleAtomicCounter &fTimeWallRead;
-      RNTuplePlainCounter  &fTimeWallUnzip;
+      RNTupleAtomicCounter &fTimeWallUnzip;
       RNTupleTickCounter<RNTupleAtomicCounter> &fTimeCpuRead;
-      RNTupleTickCounter<RNTuplePlainCounter>  &fTimeCpuUnzip;
+      RNTupleTickCounter<RNTupleAtomicCounter> &fTimeCpuUnzip;
    };
    std::unique_ptr<RCounters> fCounters;
    /// Wraps the I/O counters and is observed by the RNTupleReader metrics
@@ -149,13 +154,30 @@ private:
    Internal::RMiniFileReader fReader;
    /// The cluster pool asynchronously preloads the next few clusters
    std::unique_ptr<RClusterPool> fClusterPool;
+   /// If RNTupleReadOptions::GetUseMmap() is set and the file supports it, the entire file is mapped on Attach().
+   /// Pages that can be used in place point into the mapping, which is released after the page pool.
+   unsigned char *fMappedFile = nullptr;
+   std::size_t fMappedSize = 0;
 
    RPageSourceFile(std::string_view ntupleName, const RNTupleReadOptions &options);
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterDescriptor &clusterDescriptor,
                                  ClusterSize_t::ValueType clusterIndex);
+   /// Maps the entire file if requested by the read options and supported by the raw file
+   void MapFile();
+   /// Decompresses and unpacks an on-disk page of nElements elements into a newly allocated, heap allocated buffer
+   /// of the in-memory page.  The sealed page buffer is not modified.  Used concurrently by the unzip tasks.
+   unsigned char *UnsealPage(const void *sealedPage, std::size_t bytesOnStorage, const RColumnElementBase &element,
+                             ClusterSize_t::ValueType nElements);
+   /// Creates the cluster with the on-disk page map of the given columns and fills `readRequests` with the
+   /// coalesced byte ranges that need to be read into the cluster's (not yet populated) page buffer.
+   /// Used by LoadCluster() and LoadClusterAsync(), which differ only in how the read requests are issued.
+   std::unique_ptr<RCluster> PrepareLoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns,
+                                                std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests);
 
 protected:
    RNTupleDescriptor AttachImpl() final;
+   void UnzipClusterImpl(RCluster *cluster) final;
+   void EvictClusterImpl(DescriptorId_t clusterId) final;
 
 public:
    RPageSourceFile(std::string_view ntupleName, std::string_view path, const RNTupleReadOptions &options);
@@ -169,6 +191,9 @@ public:
    void ReleasePage(RPage &page) final;
 
    std::unique_ptr<RCluster> LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns) final;
+   /// Submits the vector read of the cluster pages through RRawFile::ReadVAsync(), which does not block if
+   /// the underlying file supports asynchronous I/O (e.g., local files with io_uring)
+   std::unique_ptr<RClusterLoadHandle> LoadClusterAsync(DescriptorId_t clusterId, const ColumnSet_t &columns) final;
 
    RNTupleMetrics &GetMetrics() final { return fMetrics; }
 };
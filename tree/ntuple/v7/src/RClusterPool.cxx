@@ -51,6 +51,7 @@ ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource,
    : fPageSource(pageSource)
    , fPool(size)
    , fThreadIo(&RClusterPool::ExecLoadClusters, this)
+   , fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
 {
    R__ASSERT(size > 0);
    fWindowPre = 0;
@@ -71,6 +72,39 @@ ROOT::Experimental::Detail::RClusterPool::~RClusterPool()
       fCvHasWork.notify_one();
    }
    fThreadIo.join();
+
+   {
+      // Controlled shutdown of the unzip thread
+      std::unique_lock<std::mutex> lock(fLockUnzipQueue);
+      fUnzipQueue.emplace(RUnzipItem());
+      fCvHasUnzipWork.notify_one();
+   }
+   fThreadUnzip.join();
+}
+
+void ROOT::Experimental::Detail::RClusterPool::ExecUnzipClusters()
+{
+   while (true) {
+      std::vector<RUnzipItem> unzipItems;
+      {
+         std::unique_lock<std::mutex> lock(fLockUnzipQueue);
+         fCvHasUnzipWork.wait(lock, [&]{ return !fUnzipQueue.empty(); });
+         while (!fUnzipQueue.empty()) {
+            unzipItems.emplace_back(std::move(fUnzipQueue.front()));
+            fUnzipQueue.pop();
+         }
+      }
+
+      for (auto &item : unzipItems) {
+         if (!item.fCluster)
+            return;
+
+         fPageSource.UnzipCluster(item.fCluster.get());
+
+         // Afterwards the GetCluster() method in the main thread can pick-up the cluster
+         item.fPromise.set_value(std::move(item.fCluster));
+      }
+   } // while (true)
 }
 
 void ROOT::Experimental::Detail::RClusterPool::ExecLoadClusters()
@@ -86,12 +120,22 @@ void ROOT::Experimental::Detail::RClusterPool::ExecLoadClusters()
          }
       }
 
+      // Issue the reads of all the work items before waiting for the first one, so that multiple cluster reads
+      // are in flight if the page source supports asynchronous I/O
+      bool isTerminating = false;
+      std::vector<std::unique_ptr<RPageSource::RClusterLoadHandle>> loadHandles;
       for (auto &item : workItems) {
-         if (item.fClusterId == kInvalidDescriptorId)
-            return;
+         if (item.fClusterId == kInvalidDescriptorId) {
+            isTerminating = true;
+            break;
+         }
+         loadHandles.emplace_back(fPageSource.LoadClusterAsync(item.fClusterId, item.fColumns));
+      }
 
-         // TODO(jblomer): the page source needs to be capable of loading multiple clusters in one go
-         auto cluster = fPageSource.LoadCluster(item.fClusterId, item.fColumns);
+      for (unsigned int i = 0; i < loadHandles.size(); ++i) {
+         auto &item = workItems[i];
+         auto cluster = loadHandles[i]->Wait();
+         loadHandles[i].reset();
 
          // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
          // need the cluster anymore, in which case we simply discard it right away, before moving it to the pool
@@ -105,11 +149,19 @@ void ROOT::Experimental::Detail::RClusterPool::ExecLoadClusters()
                break;
             }
          }
-         if (discard)
-            cluster.reset();
+         if (discard) {
+            item.fPromise.set_value(nullptr);
+            continue;
+         }
 
-         item.fPromise.set_value(std::move(cluster));
+         // Hand over the loaded cluster to the unzip thread
+         std::unique_lock<std::mutex> lock(fLockUnzipQueue);
+         fUnzipQueue.emplace(RUnzipItem{std::move(cluster), std::move(item.fPromise)});
+         fCvHasUnzipWork.notify_one();
       }
+
+      if (isTerminating)
+         return;
    } // while (true)
 }
 
@@ -200,10 +252,14 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
    // TODO(jblomer): instead of a fixed-sized window, eventually we should determine the window size based on
    // a user-defined memory limit.  The size of the preloaded data can be determined at the beginning of
    // GetCluster from the descriptor and the current contents of fPool.
+   const auto entryRange = fPageSource.GetEntryRange();
    for (unsigned int i = 1; i < fWindowPost; ++i) {
       next = desc.FindNextClusterId(next);
       if (next == kInvalidDescriptorId)
          break;
+      // Clusters beyond the page source's entry range are processed elsewhere, if at all
+      if (!entryRange.IntersectsWith(desc.GetClusterDescriptor(next)))
+         break;
       provide.Insert(next, columns);
    }
 
@@ -215,6 +271,7 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
          continue;
       if (keep.count(cptr->GetId()) > 0)
          continue;
+      fPageSource.EvictCluster(cptr->GetId());
       cptr.reset();
    }
 
@@ -241,6 +298,9 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
          auto cptr = itr->fFuture.get();
          // If cptr is nullptr, the cluster expired previously and was released by the I/O thread
          if (!cptr || itr->fIsExpired) {
+            // An expired cluster has been unzipped nevertheless; release its preloaded pages
+            if (cptr)
+               fPageSource.EvictCluster(cptr->GetId());
             cptr.reset();
             itr = fInFlightClusters.erase(itr);
             continue;
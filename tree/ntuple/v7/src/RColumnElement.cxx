@@ -14,69 +14,551 @@
  *************************************************************************/
 
 #include <ROOT/RColumnElement.hxx>
+#include <ROOT/RConfig.hxx>
 
 #include <TError.h>
 
 #include <algorithm>
-#include <bitset>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
 
-ROOT::Experimental::Detail::RColumnElementBase
+// Runtime dispatch of the packing kernels to SIMD variants follows the approach of the builtin zlib: the SIMD kernels
+// are compiled with a target attribute and selected according to the CPU features at first use.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && defined(R__BYTESWAP)
+#define R__NTUPLE_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace {
+
+/// Packs bools into bits, the first bool going into the least significant bit of the first byte
+void PackBitsScalar(unsigned char *dst, const bool *src, std::size_t count)
+{
+   std::size_t i = 0;
+#ifdef R__BYTESWAP
+   // On little endian machines, a multiplication moves the 0/1 bytes of 8 bools into the most significant byte
+   for (; i + 8 <= count; i += 8) {
+      std::uint64_t bools;
+      memcpy(&bools, src + i, 8);
+      dst[i / 8] = static_cast<unsigned char>((bools * 0x0102040810204080ULL) >> 56);
+   }
+#endif
+   unsigned char packed = 0;
+   for (; i < count; ++i) {
+      packed |= static_cast<unsigned char>(src[i]) << (i % 8);
+      if (i % 8 == 7) {
+         dst[i / 8] = packed;
+         packed = 0;
+      }
+   }
+   if (i % 8 != 0)
+      dst[i / 8] = packed;
+}
+
+void UnpackBitsScalar(bool *dst, const unsigned char *src, std::size_t count)
+{
+   std::size_t i = 0;
+#ifdef R__BYTESWAP
+   // Broadcast the byte, keep bit j in byte j and turn the non-zero bytes into 0x01
+   for (; i + 8 <= count; i += 8) {
+      std::uint64_t bools = (src[i / 8] * 0x0101010101010101ULL) & 0x8040201008040201ULL;
+      bools = ((bools + 0x7F7F7F7F7F7F7F7FULL) >> 7) & 0x0101010101010101ULL;
+      memcpy(dst + i, &bools, 8);
+   }
+#endif
+   for (; i < count; ++i)
+      dst[i] = (src[i / 8] >> (i % 8)) & 1;
+}
+
+/// Writes n elements of size N such that all the first bytes come first, followed by all the second bytes, and so on.
+/// The byte planes are stride bytes apart.
+template <std::size_t N>
+void SplitScalar(unsigned char *dst, std::size_t stride, const unsigned char *src, std::size_t n)
+{
+   for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t b = 0; b < N; ++b)
+         dst[b * stride + i] = src[i * N + b];
+   }
+}
+
+/// Inverse of SplitScalar()
+template <std::size_t N>
+void UnsplitScalar(unsigned char *dst, const unsigned char *src, std::size_t stride, std::size_t n)
+{
+   for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t b = 0; b < N; ++b)
+         dst[i * N + b] = src[b * stride + i];
+   }
+}
+
+#ifdef R__NTUPLE_X86_KERNELS
+__attribute__((target("avx2")))
+void PackBitsAvx2(unsigned char *dst, const bool *src, std::size_t count)
+{
+   std::size_t i = 0;
+   for (; i + 32 <= count; i += 32) {
+      auto bools = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+      // Move the 0/1 bit of every byte to the byte's most significant bit, which is collected by movemask
+      std::uint32_t bits = _mm256_movemask_epi8(_mm256_slli_epi16(bools, 7));
+      memcpy(dst + i / 8, &bits, 4);
+   }
+   PackBitsScalar(dst + i / 8, src + i, count - i);
+}
+
+__attribute__((target("avx2")))
+void UnpackBitsAvx2(bool *dst, const unsigned char *src, std::size_t count)
+{
+   // Replicate every one of four input bytes eight times and test a different bit in each replica
+   const auto shuffle = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                                         2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+   const auto bitMask = _mm256_set1_epi64x(0x8040201008040201LL);
+   const auto ones = _mm256_set1_epi8(1);
+   std::size_t i = 0;
+   for (; i + 32 <= count; i += 32) {
+      std::int32_t packed;
+      memcpy(&packed, src + i / 8, 4);
+      auto bytes = _mm256_shuffle_epi8(_mm256_set1_epi32(packed), shuffle);
+      auto bools = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_and_si256(bytes, bitMask), bitMask), ones);
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), bools);
+   }
+   UnpackBitsScalar(dst + i, src + i / 8, count - i);
+}
+
+/// Transposes four 4x4 blocks of 32bit words, stored in the rows r0 to r3
+__attribute__((target("ssse3")))
+inline void Transpose4x4Epi32(__m128i &r0, __m128i &r1, __m128i &r2, __m128i &r3)
+{
+   auto t0 = _mm_unpacklo_epi32(r0, r1);
+   auto t1 = _mm_unpackhi_epi32(r0, r1);
+   auto t2 = _mm_unpacklo_epi32(r2, r3);
+   auto t3 = _mm_unpackhi_epi32(r2, r3);
+   r0 = _mm_unpacklo_epi64(t0, t2);
+   r1 = _mm_unpackhi_epi64(t0, t2);
+   r2 = _mm_unpacklo_epi64(t1, t3);
+   r3 = _mm_unpackhi_epi64(t1, t3);
+}
+
+/// Transposes an 8x8 block of 16bit words, stored in the rows r[0] to r[7]
+__attribute__((target("ssse3")))
+inline void Transpose8x8Epi16(__m128i *r)
+{
+   __m128i a[8];
+   for (int k = 0; k < 4; ++k) {
+      a[2 * k] = _mm_unpacklo_epi16(r[2 * k], r[2 * k + 1]);
+      a[2 * k + 1] = _mm_unpackhi_epi16(r[2 * k], r[2 * k + 1]);
+   }
+   __m128i b[8];
+   b[0] = _mm_unpacklo_epi32(a[0], a[2]);
+   b[1] = _mm_unpackhi_epi32(a[0], a[2]);
+   b[2] = _mm_unpacklo_epi32(a[1], a[3]);
+   b[3] = _mm_unpackhi_epi32(a[1], a[3]);
+   b[4] = _mm_unpacklo_epi32(a[4], a[6]);
+   b[5] = _mm_unpackhi_epi32(a[4], a[6]);
+   b[6] = _mm_unpacklo_epi32(a[5], a[7]);
+   b[7] = _mm_unpackhi_epi32(a[5], a[7]);
+   for (int k = 0; k < 4; ++k) {
+      r[2 * k] = _mm_unpacklo_epi64(b[k], b[k + 4]);
+      r[2 * k + 1] = _mm_unpackhi_epi64(b[k], b[k + 4]);
+   }
+}
+
+__attribute__((target("ssse3")))
+void Split4Ssse3(unsigned char *dst, std::size_t stride, const unsigned char *src, std::size_t n)
+{
+   // Within a register of four elements, group the bytes by significance; this 4x4 byte transposition is its own
+   // inverse.  Then transpose the groups across four registers.
+   const auto shuffle = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+   std::size_t i = 0;
+   for (; i + 16 <= n; i += 16) {
+      __m128i r[4];
+      for (int k = 0; k < 4; ++k) {
+         r[k] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 4 * i + 16 * k));
+         r[k] = _mm_shuffle_epi8(r[k], shuffle);
+      }
+      Transpose4x4Epi32(r[0], r[1], r[2], r[3]);
+      for (int b = 0; b < 4; ++b)
+         _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + b * stride + i), r[b]);
+   }
+   SplitScalar<4>(dst + i, stride, src + 4 * i, n - i);
+}
+
+__attribute__((target("ssse3")))
+void Unsplit4Ssse3(unsigned char *dst, const unsigned char *src, std::size_t stride, std::size_t n)
+{
+   const auto shuffle = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+   std::size_t i = 0;
+   for (; i + 16 <= n; i += 16) {
+      __m128i r[4];
+      for (int b = 0; b < 4; ++b)
+         r[b] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + b * stride + i));
+      Transpose4x4Epi32(r[0], r[1], r[2], r[3]);
+      for (int k = 0; k < 4; ++k)
+         _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 4 * i + 16 * k), _mm_shuffle_epi8(r[k], shuffle));
+   }
+   UnsplitScalar<4>(dst + 4 * i, src + i, stride, n - i);
+}
+
+__attribute__((target("ssse3")))
+void Split8Ssse3(unsigned char *dst, std::size_t stride, const unsigned char *src, std::size_t n)
+{
+   // Within a register of two elements, interleave the bytes of equal significance into 16bit words.  Then transpose
+   // the words across eight registers.
+   const auto shuffle = _mm_setr_epi8(0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15);
+   std::size_t i = 0;
+   for (; i + 16 <= n; i += 16) {
+      __m128i r[8];
+      for (int k = 0; k < 8; ++k) {
+         r[k] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 8 * i + 16 * k));
+         r[k] = _mm_shuffle_epi8(r[k], shuffle);
+      }
+      Transpose8x8Epi16(r);
+      for (int b = 0; b < 8; ++b)
+         _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + b * stride + i), r[b]);
+   }
+   SplitScalar<8>(dst + i, stride, src + 8 * i, n - i);
+}
+
+__attribute__((target("ssse3")))
+void Unsplit8Ssse3(unsigned char *dst, const unsigned char *src, std::size_t stride, std::size_t n)
+{
+   const auto shuffle = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+   std::size_t i = 0;
+   for (; i + 16 <= n; i += 16) {
+      __m128i r[8];
+      for (int b = 0; b < 8; ++b)
+         r[b] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + b * stride + i));
+      Transpose8x8Epi16(r);
+      for (int k = 0; k < 8; ++k)
+         _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 8 * i + 16 * k), _mm_shuffle_epi8(r[k], shuffle));
+   }
+   UnsplitScalar<8>(dst + 8 * i, src + i, stride, n - i);
+}
+#endif // R__NTUPLE_X86_KERNELS
+
+/// The packing kernels in use, the fastest ones supported by the CPU
+struct RPackingKernels {
+   using PackBits_t = void (*)(unsigned char *, const bool *, std::size_t);
+   using UnpackBits_t = void (*)(bool *, const unsigned char *, std::size_t);
+   using Split_t = void (*)(unsigned char *, std::size_t, const unsigned char *, std::size_t);
+   using Unsplit_t = void (*)(unsigned char *, const unsigned char *, std::size_t, std::size_t);
+
+   PackBits_t fPackBits = PackBitsScalar;
+   UnpackBits_t fUnpackBits = UnpackBitsScalar;
+   Split_t fSplit4 = SplitScalar<4>;
+   Unsplit_t fUnsplit4 = UnsplitScalar<4>;
+   Split_t fSplit8 = SplitScalar<8>;
+   Unsplit_t fUnsplit8 = UnsplitScalar<8>;
+
+   RPackingKernels()
+   {
+#ifdef R__NTUPLE_X86_KERNELS
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("ssse3")) {
+         fSplit4 = Split4Ssse3;
+         fUnsplit4 = Unsplit4Ssse3;
+         fSplit8 = Split8Ssse3;
+         fUnsplit8 = Unsplit8Ssse3;
+      }
+      if (__builtin_cpu_supports("avx2")) {
+         fPackBits = PackBitsAvx2;
+         fUnpackBits = UnpackBitsAvx2;
+      }
+#endif
+   }
+
+   static const RPackingKernels &Get()
+   {
+      static const RPackingKernels kernels;
+      return kernels;
+   }
+
+   template <std::size_t N>
+   Split_t GetSplit() const
+   {
+      static_assert(N == 4 || N == 8, "no split kernel for this element size");
+      return (N == 4) ? fSplit4 : fSplit8;
+   }
+
+   template <std::size_t N>
+   Unsplit_t GetUnsplit() const
+   {
+      static_assert(N == 4 || N == 8, "no split kernel for this element size");
+      return (N == 4) ? fUnsplit4 : fUnsplit8;
+   }
+};
+
+/// Maps signed integers of small magnitude to small unsigned integers: 0, -1, 1, -2, ... become 0, 1, 2, 3, ...
+template <typename T>
+typename std::make_unsigned<T>::type ZigzagEncode(T value)
+{
+   using U = typename std::make_unsigned<T>::type;
+   return (static_cast<U>(value) << 1) ^ static_cast<U>(value >> (sizeof(T) * 8 - 1));
+}
+
+template <typename T>
+T ZigzagDecode(typename std::make_unsigned<T>::type value)
+{
+   using U = typename std::make_unsigned<T>::type;
+   return static_cast<T>((value >> 1) ^ (~(value & 1) + U(1)));
+}
+
+template <typename T>
+void PackSplit(void *dst, void *src, std::size_t count)
+{
+   RPackingKernels::Get().GetSplit<sizeof(T)>()(
+      reinterpret_cast<unsigned char *>(dst), count, reinterpret_cast<const unsigned char *>(src), count);
+}
+
+template <typename T>
+void UnpackSplit(void *dst, void *src, std::size_t count)
+{
+   RPackingKernels::Get().GetUnsplit<sizeof(T)>()(
+      reinterpret_cast<unsigned char *>(dst), reinterpret_cast<const unsigned char *>(src), count, count);
+}
+
+/// Transforms the elements by fnEncode(src, i) in blocks on the stack before splitting them
+template <typename T, typename FnEncodeT>
+void PackSplitEncoded(void *dst, void *src, std::size_t count, FnEncodeT fnEncode)
+{
+   constexpr std::size_t kBlockSize = 256;
+   T block[kBlockSize];
+   auto split = RPackingKernels::Get().GetSplit<sizeof(T)>();
+   auto typedArray = reinterpret_cast<const T *>(src);
+   for (std::size_t i = 0; i < count; i += kBlockSize) {
+      const auto n = std::min(kBlockSize, count - i);
+      for (std::size_t j = 0; j < n; ++j)
+         block[j] = fnEncode(typedArray, i + j);
+      split(reinterpret_cast<unsigned char *>(dst) + i, count, reinterpret_cast<const unsigned char *>(block), n);
+   }
+}
+
+template <typename T>
+void PackSplitZigzag(void *dst, void *src, std::size_t count)
+{
+   using U = typename std::make_unsigned<T>::type;
+   PackSplitEncoded<U>(dst, src, count,
+                       [](const U *v, std::size_t i) { return ZigzagEncode(static_cast<T>(v[i])); });
+}
+
+template <typename T>
+void UnpackSplitZigzag(void *dst, void *src, std::size_t count)
+{
+   using U = typename std::make_unsigned<T>::type;
+   UnpackSplit<U>(dst, src, count);
+   auto typedArray = reinterpret_cast<U *>(dst);
+   for (std::size_t i = 0; i < count; ++i)
+      typedArray[i] = static_cast<U>(ZigzagDecode<T>(typedArray[i]));
+}
+
+/// Converts value to double such that the result is not larger (bRoundUp == false) or not smaller (bRoundUp == true)
+/// than the value.  Only integers with more bits than the double mantissa may need rounding.
+template <typename T>
+double ToDoubleOutward(T value, bool bRoundUp)
+{
+   auto result = static_cast<double>(value);
+   if (std::numeric_limits<T>::digits <= std::numeric_limits<double>::digits)
+      return result;
+   constexpr double kMaxExact = double(std::uint64_t(1) << std::numeric_limits<double>::digits);
+   if ((result < kMaxExact) && (result > -kMaxExact))
+      return result;
+   return std::nextafter(result, bRoundUp ? std::numeric_limits<double>::infinity()
+                                          : -std::numeric_limits<double>::infinity());
+}
+
+template <typename T>
+bool GetMinMaxImpl(const void *source, std::size_t count, double &min, double &max)
+{
+   if (count == 0)
+      return false;
+   auto typedArray = reinterpret_cast<const T *>(source);
+   // NaN values are skipped: they compare false to any value and thus never pass a range cut
+   using Limits_t = std::numeric_limits<T>;
+   T vMin = Limits_t::has_infinity ? Limits_t::infinity() : Limits_t::max();
+   T vMax = Limits_t::has_infinity ? -Limits_t::infinity() : Limits_t::lowest();
+   for (std::size_t i = 0; i < count; ++i) {
+      vMin = (typedArray[i] < vMin) ? typedArray[i] : vMin;
+      vMax = (typedArray[i] > vMax) ? typedArray[i] : vMax;
+   }
+   min = ToDoubleOutward(vMin, false /* bRoundUp */);
+   max = ToDoubleOutward(vMax, true /* bRoundUp */);
+   return true;
+}
+
+} // anonymous namespace
+
+std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
 ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
    switch (type) {
    case EColumnType::kReal32:
-      return RColumnElement<float, EColumnType::kReal32>(nullptr);
+      return std::make_unique<RColumnElement<float, EColumnType::kReal32>>(nullptr);
    case EColumnType::kReal64:
-      return RColumnElement<double, EColumnType::kReal64>(nullptr);
+      return std::make_unique<RColumnElement<double, EColumnType::kReal64>>(nullptr);
    case EColumnType::kByte:
-      return RColumnElement<std::uint8_t, EColumnType::kByte>(nullptr);
+      return std::make_unique<RColumnElement<std::uint8_t, EColumnType::kByte>>(nullptr);
    case EColumnType::kInt32:
-      return RColumnElement<std::int32_t, EColumnType::kInt32>(nullptr);
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kInt32>>(nullptr);
    case EColumnType::kInt64:
-      return RColumnElement<std::int64_t, EColumnType::kInt64>(nullptr);
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kInt64>>(nullptr);
    case EColumnType::kBit:
-      return RColumnElement<bool, EColumnType::kBit>(nullptr);
+      return std::make_unique<RColumnElement<bool, EColumnType::kBit>>(nullptr);
    case EColumnType::kIndex:
-      return RColumnElement<ClusterSize_t, EColumnType::kIndex>(nullptr);
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kIndex>>(nullptr);
    case EColumnType::kSwitch:
-      return RColumnElement<RColumnSwitch, EColumnType::kSwitch>(nullptr);
+      return std::make_unique<RColumnElement<RColumnSwitch, EColumnType::kSwitch>>(nullptr);
+   case EColumnType::kSplitIndex:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kSplitIndex>>(nullptr);
+   case EColumnType::kSplitReal64:
+      return std::make_unique<RColumnElement<double, EColumnType::kSplitReal64>>(nullptr);
+   case EColumnType::kSplitReal32:
+      return std::make_unique<RColumnElement<float, EColumnType::kSplitReal32>>(nullptr);
+   case EColumnType::kSplitInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kSplitInt64>>(nullptr);
+   case EColumnType::kSplitInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitInt32>>(nullptr);
    default:
       R__ASSERT(false);
    }
    // never here
-   return RColumnElementBase();
+   return nullptr;
+}
+
+ROOT::Experimental::EColumnType
+ROOT::Experimental::Detail::RColumnElementBase::GetSplitType(EColumnType type)
+{
+   switch (type) {
+   case EColumnType::kIndex: return EColumnType::kSplitIndex;
+   case EColumnType::kReal64: return EColumnType::kSplitReal64;
+   case EColumnType::kReal32: return EColumnType::kSplitReal32;
+   case EColumnType::kInt64: return EColumnType::kSplitInt64;
+   case EColumnType::kInt32: return EColumnType::kSplitInt32;
+   default: return type;
+   }
 }
 
 void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit>::Pack(
   void *dst, void *src, std::size_t count) const
 {
-   bool *boolArray = reinterpret_cast<bool *>(src);
-   char *charArray = reinterpret_cast<char *>(dst);
-   std::bitset<8> bitSet;
-   std::size_t i = 0;
-   for (; i < count; ++i) {
-      bitSet.set(i % 8, boolArray[i]);
-      if (i % 8 == 7) {
-         char packed = bitSet.to_ulong();
-         charArray[i / 8] = packed;
-      }
-   }
-   if (i % 8 != 0) {
-      char packed = bitSet.to_ulong();
-      charArray[i / 8] = packed;
-   }
+   RPackingKernels::Get().fPackBits(reinterpret_cast<unsigned char *>(dst), reinterpret_cast<const bool *>(src), count);
 }
 
 void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit>::Unpack(
   void *dst, void *src, std::size_t count) const
 {
-   bool *boolArray = reinterpret_cast<bool *>(dst);
-   char *charArray = reinterpret_cast<char *>(src);
-   std::bitset<8> bitSet;
-   for (std::size_t i = 0; i < count; i += 8) {
-      bitSet = charArray[i / 8];
-      for (std::size_t j = i; j < std::min(count, i + 8); ++j) {
-         boolArray[j] = bitSet[j % 8];
-      }
-   }
+   RPackingKernels::Get().fUnpackBits(reinterpret_cast<bool *>(dst), reinterpret_cast<const unsigned char *>(src),
+                                      count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+                                               ROOT::Experimental::EColumnType::kSplitIndex>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   // The offsets are monotonic within a cluster; the deltas are the collection sizes and thus small
+   using Value_t = ClusterSize_t::ValueType;
+   PackSplitEncoded<Value_t>(dst, src, count,
+                             [](const Value_t *v, std::size_t i) { return i ? v[i] - v[i - 1] : v[0]; });
+}
+
+void ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+                                               ROOT::Experimental::EColumnType::kSplitIndex>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   using Value_t = ClusterSize_t::ValueType;
+   UnpackSplit<Value_t>(dst, src, count);
+   auto offsetArray = reinterpret_cast<Value_t *>(dst);
+   for (std::size_t i = 1; i < count; ++i)
+      offsetArray[i] += offsetArray[i - 1];
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackSplit<double>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackSplit<double>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackSplit<float>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackSplit<float>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackSplitZigzag<std::int64_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kSplitInt64>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackSplitZigzag<std::int64_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Pack(
+  void *dst, void *src, std::size_t count) const
+{
+   PackSplitZigzag<std::int32_t>(dst, src, count);
+}
+
+void ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32>::Unpack(
+  void *dst, void *src, std::size_t count) const
+{
+   UnpackSplitZigzag<std::int32_t>(dst, src, count);
+}
+
+bool ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal32>::GetMinMax(
+  const void *source, std::size_t count, double &min, double &max) const
+{
+   return GetMinMaxImpl<float>(source, count, min, max);
+}
+
+bool ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kReal64>::GetMinMax(
+  const void *source, std::size_t count, double &min, double &max) const
+{
+   return GetMinMaxImpl<double>(source, count, min, max);
+}
+
+bool ROOT::Experimental::Detail::RColumnElement<std::uint8_t, ROOT::Experimental::EColumnType::kByte>::GetMinMax(
+  const void *source, std::size_t count, double &min, double &max) const
+{
+   return GetMinMaxImpl<std::uint8_t>(source, count, min, max);
+}
+
+bool ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kInt32>::GetMinMax(
+  const void *source, std::size_t count, double &min, double &max) const
+{
+   return GetMinMaxImpl<std::int32_t>(source, count, min, max);
+}
+
+bool ROOT::Experimental::Detail::RColumnElement<std::uint32_t, ROOT::Experimental::EColumnType::kInt32>::GetMinMax(
+  const void *source, std::size_t count, double &min, double &max) const
+{
+   return GetMinMaxImpl<std::uint32_t>(source, count, min, max);
+}
+
+bool ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kInt64>::GetMinMax(
+  const void *source, std::size_t count, double &min, double &max) const
+{
+   return GetMinMaxImpl<std::int64_t>(source, count, min, max);
+}
+
+bool ROOT::Experimental::Detail::RColumnElement<std::uint64_t, ROOT::Experimental::EColumnType::kInt64>::GetMinMax(
+  const void *source, std::size_t count, double &min, double &max) const
+{
+   return GetMinMaxImpl<std::uint64_t>(source, count, min, max);
 }
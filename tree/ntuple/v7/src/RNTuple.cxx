@@ -17,8 +17,12 @@
 
 #include "ROOT/RFieldVisitor.hxx"
 #include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RPageSinkBuf.hxx"
 #include "ROOT/RPageStorage.hxx"
 #include "ROOT/RPageStorageFile.hxx"
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#endif
 
 #include <algorithm>
 #include <exception>
@@ -31,6 +35,33 @@
 
 #include <TError.h>
 #include <TFile.h> // for RNTupleWriter::Append
+#include <TROOT.h> // for IsImplicitMTEnabled()
+
+#ifdef R__USE_IMT
+ROOT::Experimental::Detail::RNTupleImtTaskScheduler::RNTupleImtTaskScheduler()
+{
+   Reset();
+}
+
+ROOT::Experimental::Detail::RNTupleImtTaskScheduler::~RNTupleImtTaskScheduler()
+{
+}
+
+void ROOT::Experimental::Detail::RNTupleImtTaskScheduler::Reset()
+{
+   fTaskGroup = std::make_unique<TTaskGroup>();
+}
+
+void ROOT::Experimental::Detail::RNTupleImtTaskScheduler::AddTask(const std::function<void(void)> &taskFunc)
+{
+   fTaskGroup->Run(taskFunc);
+}
+
+void ROOT::Experimental::Detail::RNTupleImtTaskScheduler::Wait()
+{
+   fTaskGroup->Wait();
+}
+#endif
 
 
 void ROOT::Experimental::RNTupleReader::ConnectModel(const RNTupleModel &model) {
@@ -45,6 +76,18 @@ void ROOT::Experimental::RNTupleReader::ConnectModel(const RNTupleModel &model)
    }
 }
 
+void ROOT::Experimental::RNTupleReader::InitPageSource()
+{
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled()) {
+      fUnzipTasks = std::make_unique<Detail::RNTupleImtTaskScheduler>();
+      fSource->SetTaskScheduler(fUnzipTasks.get());
+   }
+#endif
+   fSource->Attach();
+   fMetrics.ObserveMetrics(fSource->GetMetrics());
+}
+
 ROOT::Experimental::RNTupleReader::RNTupleReader(
    std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
    std::unique_ptr<ROOT::Experimental::Detail::RPageSource> source)
@@ -52,9 +95,8 @@ ROOT::Experimental::RNTupleReader::RNTupleReader(
    , fModel(std::move(model))
    , fMetrics("RNTupleReader")
 {
-   fSource->Attach();
+   InitPageSource();
    ConnectModel(*fModel);
-   fMetrics.ObserveMetrics(fSource->GetMetrics());
 }
 
 ROOT::Experimental::RNTupleReader::RNTupleReader(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> source)
@@ -62,8 +104,7 @@ ROOT::Experimental::RNTupleReader::RNTupleReader(std::unique_ptr<ROOT::Experimen
    , fModel(nullptr)
    , fMetrics("RNTupleReader")
 {
-   fSource->Attach();
-   fMetrics.ObserveMetrics(fSource->GetMetrics());
+   InitPageSource();
 }
 
 ROOT::Experimental::RNTupleReader::~RNTupleReader()
@@ -262,6 +303,81 @@ void ROOT::Experimental::RNTupleWriter::CommitCluster()
 //------------------------------------------------------------------------------
 
 
+ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(
+   std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
+   std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
+   : fSink(std::move(sink))
+   , fModel(std::move(model))
+   , fClusterSizeEntries(kDefaultClusterSizeEntries)
+   , fLastCommitted(0)
+   , fNEntries(0)
+{
+#ifdef R__USE_IMT
+   if (IsImplicitMTEnabled()) {
+      fZipTasks = std::make_unique<Detail::RNTupleImtTaskScheduler>();
+      fSink->SetTaskScheduler(fZipTasks.get());
+   }
+#endif
+   fSink->Create(*fModel.get());
+}
+
+ROOT::Experimental::RNTupleFillContext::~RNTupleFillContext()
+{
+   CommitCluster();
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitCluster()
+{
+   if (fNEntries == fLastCommitted) return;
+   for (auto& field : *fModel->GetFieldZero()) {
+      field.Flush();
+      field.CommitCluster();
+   }
+   fSink->CommitCluster(fNEntries);
+   fLastCommitted = fNEntries;
+}
+
+
+//------------------------------------------------------------------------------
+
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(
+   std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
+   std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
+   : fSink(std::move(sink))
+   , fModel(std::move(model))
+{
+   fSink->Create(*fModel.get());
+}
+
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   fSink->CommitDataset();
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> ROOT::Experimental::RNTupleParallelWriter::Recreate(
+   std::unique_ptr<RNTupleModel> model,
+   std::string_view ntupleName,
+   std::string_view storage,
+   const RNTupleWriteOptions &options)
+{
+   return std::make_unique<RNTupleParallelWriter>(std::move(model),
+                                                  Detail::RPageSink::Create(ntupleName, storage, options));
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleFillContext>
+ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   std::lock_guard<std::mutex> guard(fSinkLock);
+   auto model = std::unique_ptr<RNTupleModel>(fModel->Clone());
+   auto sink = std::make_unique<Detail::RPageSinkBuf>(*fSink, fSinkLock);
+   return std::unique_ptr<RNTupleFillContext>(new RNTupleFillContext(std::move(model), std::move(sink)));
+}
+
+
+//------------------------------------------------------------------------------
+
+
 ROOT::Experimental::RCollectionNTuple::RCollectionNTuple(std::unique_ptr<REntry> defaultEntry)
    : fOffset(0), fDefaultEntry(std::move(defaultEntry))
 {
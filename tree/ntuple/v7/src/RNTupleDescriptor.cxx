@@ -27,7 +27,9 @@
 #include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -156,6 +158,23 @@ std::uint32_t DeserializeClusterSize(const void *buffer, ROOT::Experimental::Clu
    return nbytes;
 }
 
+/// Doubles are stored as their IEEE 754 bit pattern in the same byte order as 64bit integers
+std::uint32_t SerializeDouble(double val, void *buffer)
+{
+   std::uint64_t bits;
+   static_assert(sizeof(bits) == sizeof(val), "unexpected size of double");
+   memcpy(&bits, &val, sizeof(bits));
+   return SerializeUInt64(bits, buffer);
+}
+
+std::uint32_t DeserializeDouble(const void *buffer, double *val)
+{
+   std::uint64_t bits;
+   auto nbytes = DeserializeUInt64(buffer, &bits);
+   memcpy(val, &bits, sizeof(bits));
+   return nbytes;
+}
+
 std::uint32_t SerializeString(const std::string &val, void *buffer)
 {
    if (buffer != nullptr) {
@@ -446,7 +465,9 @@ std::uint32_t SerializeColumn(const ROOT::Experimental::RColumnDescriptor &val,
    return size;
 }
 
-std::uint32_t SerializeClusterSummary(const ROOT::Experimental::RClusterDescriptor &val, void *buffer)
+/// The cluster summary includes the value statistics of the given columns, if there are any
+std::uint32_t SerializeClusterSummary(const ROOT::Experimental::RClusterDescriptor &val,
+                                      const std::vector<ROOT::Experimental::DescriptorId_t> &columnIds, void *buffer)
 {
    auto base = reinterpret_cast<unsigned char *>((buffer != nullptr) ? buffer : 0);
    auto pos = base;
@@ -462,6 +483,20 @@ std::uint32_t SerializeClusterSummary(const ROOT::Experimental::RClusterDescript
    pos += SerializeUInt64(val.GetNEntries(), *where);
    pos += SerializeLocator(val.GetLocator(), *where);
 
+   // Since frame version 1
+   std::uint32_t nStats = 0;
+   for (auto columnId : columnIds)
+      nStats += val.GetColumnRange(columnId).fHasStats;
+   pos += SerializeUInt32(nStats, *where);
+   for (auto columnId : columnIds) {
+      const auto &columnRange = val.GetColumnRange(columnId);
+      if (!columnRange.fHasStats)
+         continue;
+      pos += SerializeUInt64(columnId, *where);
+      pos += SerializeDouble(columnRange.fMin, *where);
+      pos += SerializeDouble(columnRange.fMax, *where);
+   }
+
    auto size = pos - base;
    SerializeUInt32(size, ptrSize);
    return size;
@@ -595,10 +630,14 @@ std::uint32_t ROOT::Experimental::RNTupleDescriptor::SerializeFooter(void* buffe
       RNTupleDescriptor::kFrameVersionCurrent, RNTupleDescriptor::kFrameVersionMin, *where, &ptrSize);
    pos += SerializeUInt64(0, *where); // reserved; can be at some point used, e.g., for compression flags
 
+   std::vector<DescriptorId_t> columnIds;
+   for (const auto& column : fColumnDescriptors)
+      columnIds.emplace_back(column.first);
+
    pos += SerializeUInt64(fClusterDescriptors.size(), *where);
    for (const auto& cluster : fClusterDescriptors) {
       pos += SerializeUuid(fOwnUuid, *where); // in order to verify that header and footer belong together
-      pos += SerializeClusterSummary(cluster.second, *where);
+      pos += SerializeClusterSummary(cluster.second, columnIds, *where);
 
       pos += SerializeUInt32(fColumnDescriptors.size(), *where);
       for (const auto& column : fColumnDescriptors) {
@@ -901,6 +940,21 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
       pos += DeserializeLocator(pos, &locator);
       SetClusterLocator(clusterId, locator);
 
+      // Value statistics are only present in frames written by version 1 or newer
+      std::unordered_map<std::uint64_t, std::pair<double, double>> columnStats;
+      if (pos < clusterBase + frameSize) {
+         std::uint32_t nStats;
+         pos += DeserializeUInt32(pos, &nStats);
+         for (std::uint32_t j = 0; j < nStats; ++j) {
+            std::uint64_t columnId;
+            double min, max;
+            pos += DeserializeUInt64(pos, &columnId);
+            pos += DeserializeDouble(pos, &min);
+            pos += DeserializeDouble(pos, &max);
+            columnStats[columnId] = std::make_pair(min, max);
+         }
+      }
+
       pos = clusterBase + frameSize;
 
       std::uint32_t nColumns;
@@ -912,6 +966,12 @@ void ROOT::Experimental::RNTupleDescriptorBuilder::AddClustersFromFooter(void* f
          RClusterDescriptor::RColumnRange columnRange;
          columnRange.fColumnId = columnId;
          pos += DeserializeColumnRange(pos, &columnRange);
+         auto itrStats = columnStats.find(columnId);
+         if (itrStats != columnStats.end()) {
+            columnRange.fHasStats = true;
+            columnRange.fMin = itrStats->second.first;
+            columnRange.fMax = itrStats->second.second;
+         }
          AddClusterColumnRange(clusterId, columnRange);
 
          RClusterDescriptor::RPageRange pageRange;
@@ -20,16 +20,63 @@
 
 #include <cstdlib>
 
+ROOT::Experimental::Detail::RPagePool::~RPagePool()
+{
+   // Only preloaded pages that were never used should be left
+   for (unsigned i = 0; i < fPages.size(); ++i) {
+      if (fReferences[i] == 0)
+         fDeleters[i](fPages[i]);
+   }
+}
+
 void ROOT::Experimental::Detail::RPagePool::RegisterPage(const RPage &page, const RPageDeleter &deleter)
 {
+   std::lock_guard<std::mutex> lockGuard(fLock);
    fPages.emplace_back(page);
    fReferences.emplace_back(1);
    fDeleters.emplace_back(deleter);
 }
 
+void ROOT::Experimental::Detail::RPagePool::PreloadPage(const RPage &page, const RPageDeleter &deleter)
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   fPages.emplace_back(page);
+   fReferences.emplace_back(0);
+   fDeleters.emplace_back(deleter);
+   fNIdlePages++;
+}
+
+void ROOT::Experimental::Detail::RPagePool::EvictCluster(DescriptorId_t clusterId)
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   unsigned int N = fPages.size();
+   for (unsigned i = 0; i < N;) {
+      if (fReferences[i] != 0 || fPages[i].GetClusterInfo().GetId() != clusterId) {
+         ++i;
+         continue;
+      }
+      fDeleters[i](fPages[i]);
+      fPages[i] = fPages[N-1];
+      fReferences[i] = fReferences[N-1];
+      fDeleters[i] = fDeleters[N-1];
+      N--;
+      fNIdlePages--;
+   }
+   fPages.resize(N);
+   fReferences.resize(N);
+   fDeleters.resize(N);
+}
+
+std::size_t ROOT::Experimental::Detail::RPagePool::GetNIdlePages()
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   return fNIdlePages;
+}
+
 void ROOT::Experimental::Detail::RPagePool::ReturnPage(const RPage& page)
 {
    if (page.IsNull()) return;
+   std::lock_guard<std::mutex> lockGuard(fLock);
 
    unsigned int N = fPages.size();
    for (unsigned i = 0; i < N; ++i) {
@@ -52,12 +99,13 @@ void ROOT::Experimental::Detail::RPagePool::ReturnPage(const RPage& page)
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage(
    ColumnId_t columnId, NTupleSize_t globalIndex)
 {
+   std::lock_guard<std::mutex> lockGuard(fLock);
    unsigned int N = fPages.size();
    for (unsigned int i = 0; i < N; ++i) {
-      if (fReferences[i] == 0) continue;
       if (fPages[i].GetColumnId() != columnId) continue;
       if (!fPages[i].Contains(globalIndex)) continue;
-      fReferences[i]++;
+      if (fReferences[i]++ == 0)
+         fNIdlePages--;
       return fPages[i];
    }
    return RPage();
@@ -66,12 +114,13 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage
 ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage(
    ColumnId_t columnId, const RClusterIndex &clusterIndex)
 {
+   std::lock_guard<std::mutex> lockGuard(fLock);
    unsigned int N = fPages.size();
    for (unsigned int i = 0; i < N; ++i) {
-      if (fReferences[i] == 0) continue;
       if (fPages[i].GetColumnId() != columnId) continue;
       if (!fPages[i].Contains(clusterIndex)) continue;
-      fReferences[i]++;
+      if (fReferences[i]++ == 0)
+         fNIdlePages--;
       return fPages[i];
    }
    return RPage();
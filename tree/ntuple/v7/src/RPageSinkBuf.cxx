@@ -0,0 +1,159 @@
+/// \file RPageSinkBuf.cxx
+/// \ingroup NTuple ROOT7
+/// \author The ROOT Team
+/// \date 2026-10-17
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2021, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RColumn.hxx>
+#include <ROOT/RColumnElement.hxx>
+#include <ROOT/RPageAllocator.hxx>
+#include <ROOT/RPageSinkBuf.hxx>
+
+#include <cstring>
+
+namespace {
+constexpr std::size_t kDefaultElementsPerPage = 10000;
+} // anonymous namespace
+
+ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(RPageSink &innerSink, std::mutex &innerLock)
+   : RPageSink(innerSink.GetNTupleName(), innerSink.GetWriteOptions())
+   , fMetrics("RPageSinkBuf")
+   , fInnerSink(innerSink)
+   , fInnerLock(innerLock)
+{
+}
+
+ROOT::Experimental::Detail::RPageSinkBuf::~RPageSinkBuf()
+{
+   if (fTaskScheduler)
+      fTaskScheduler->Wait();
+   for (auto &column : fBufferedColumns) {
+      for (auto &bufPage : column)
+         RPageAllocatorHeap::DeletePage(bufPage.fPage);
+   }
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkBuf::CreateImpl(const RNTupleModel & /* model */)
+{
+   fBufferedColumns.resize(fLastColumnId);
+   if (fTaskScheduler)
+      fTaskScheduler->Reset();
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkBuf::SealBufferedPage(const RColumnElementBase &element,
+                                                                RBufferedPage &bufPage)
+{
+   const auto compression = fOptions.GetCompression();
+   if ((compression == 0) && element.IsMappable()) {
+      // The sealed page is the page itself
+      bufPage.fSealedPage = SealPage(bufPage.fPage, element, compression, nullptr);
+      return;
+   }
+
+   const auto nElements = bufPage.fPage.GetNElements();
+   bufPage.fBuffer = std::unique_ptr<unsigned char[]>(
+      new unsigned char[(nElements * element.GetBitsOnStorage() + 7) / 8]);
+   bufPage.fSealedPage = SealPage(bufPage.fPage, element, compression, bufPage.fBuffer.get());
+   RPageAllocatorHeap::DeletePage(bufPage.fPage);
+   bufPage.fPage = RPage();
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
+{
+   // The column reuses its page buffer after the commit, so the page needs to be copied
+   auto &column = fBufferedColumns.at(columnHandle.fId);
+   column.emplace_back();
+   auto &bufPage = column.back();
+   bufPage.fPage = RPageAllocatorHeap::NewPage(columnHandle.fId, page.GetElementSize(), page.GetNElements());
+   bufPage.fPage.TryGrow(page.GetNElements());
+   memcpy(bufPage.fPage.GetBuffer(), page.GetBuffer(), page.GetSize());
+
+   const auto element = fOnStorageElements[columnHandle.fId].get();
+   if (fTaskScheduler) {
+      fTaskScheduler->AddTask([this, element, &bufPage]() { SealBufferedPage(*element, bufPage); });
+   } else {
+      SealBufferedPage(*element, bufPage);
+   }
+
+   // The actual locator is issued by the inner sink when the cluster is committed
+   return RClusterDescriptor::RLocator();
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkBuf::CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage)
+{
+   auto &column = fBufferedColumns.at(columnId);
+   column.emplace_back();
+   auto &bufPage = column.back();
+   bufPage.fBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[sealedPage.fSize]);
+   memcpy(bufPage.fBuffer.get(), sealedPage.fBuffer, sealedPage.fSize);
+   bufPage.fSealedPage = RSealedPage(bufPage.fBuffer.get(), sealedPage.fSize, sealedPage.fNElements);
+   return RClusterDescriptor::RLocator();
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(NTupleSize_t nEntries)
+{
+   if (fTaskScheduler) {
+      fTaskScheduler->Wait();
+      fTaskScheduler->Reset();
+   }
+
+   const auto nEntriesInCluster = nEntries - fPrevClusterNEntries;
+   {
+      std::lock_guard<std::mutex> guard(fInnerLock);
+      for (DescriptorId_t columnId = 0; columnId < fBufferedColumns.size(); ++columnId) {
+         for (const auto &bufPage : fBufferedColumns[columnId])
+            fInnerSink.CommitSealedPage(columnId, bufPage.fSealedPage);
+         const auto &columnRange = fOpenColumnRanges[columnId];
+         if (columnRange.fHasStats)
+            fInnerSink.UpdateColumnStats(columnId, columnRange.fMin, columnRange.fMax);
+      }
+      fInnerSink.CommitCluster(fInnerSink.GetNEntriesCommitted() + nEntriesInCluster);
+   }
+
+   for (auto &column : fBufferedColumns) {
+      for (auto &bufPage : column)
+         RPageAllocatorHeap::DeletePage(bufPage.fPage);
+      column.clear();
+   }
+
+   // The cluster's location is only known to the inner sink
+   return RClusterDescriptor::RLocator();
+}
+
+
+void ROOT::Experimental::Detail::RPageSinkBuf::CommitDatasetImpl()
+{
+   // The data set is committed by the owner of the inner sink, once all the buffered sinks committed their clusters
+}
+
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSinkBuf::ReservePage(ColumnHandle_t columnHandle, std::size_t nElements)
+{
+   if (nElements == 0)
+      nElements = kDefaultElementsPerPage;
+   auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+   return RPageAllocatorHeap::NewPage(columnHandle.fId, elementSize, nElements);
+}
+
+void ROOT::Experimental::Detail::RPageSinkBuf::ReleasePage(RPage &page)
+{
+   RPageAllocatorHeap::DeletePage(page);
+}
@@ -15,11 +15,14 @@
 
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageStorageFile.hxx>
+#include <ROOT/RCluster.hxx>
 #include <ROOT/RColumn.hxx>
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RField.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleZip.hxx>
 #include <ROOT/RPagePool.hxx>
 #include <ROOT/RPageStorageFile.hxx>
 #include <ROOT/RStringView.hxx>
@@ -27,9 +30,25 @@
 #include <Compression.h>
 #include <TError.h>
 
+#include <algorithm>
 #include <unordered_map>
 #include <utility>
 
+namespace {
+
+/// Returned by the default implementation of RPageSource::LoadClusterAsync(), which loads synchronously
+class RClusterLoadHandleDone : public ROOT::Experimental::Detail::RPageSource::RClusterLoadHandle {
+private:
+   std::unique_ptr<ROOT::Experimental::Detail::RCluster> fCluster;
+
+public:
+   explicit RClusterLoadHandleDone(std::unique_ptr<ROOT::Experimental::Detail::RCluster> cluster)
+      : fCluster(std::move(cluster)) {}
+   std::unique_ptr<ROOT::Experimental::Detail::RCluster> Wait() final { return std::move(fCluster); }
+};
+
+} // anonymous namespace
+
 
 ROOT::Experimental::Detail::RPageStorage::RPageStorage(std::string_view name) : fNTupleName(name)
 {
@@ -49,6 +68,16 @@ ROOT::Experimental::Detail::RNTupleMetrics &ROOT::Experimental::Detail::RPageSto
 //------------------------------------------------------------------------------
 
 
+bool ROOT::Experimental::Detail::RPageSource::REntryRange::IntersectsWith(const RClusterDescriptor &clusterDesc) const
+{
+   if (fNEntries == 0 || clusterDesc.GetNEntries() == 0)
+      return false;
+   const auto lastEntry = (fNEntries == kInvalidNTupleIndex) ? kInvalidNTupleIndex : (fFirstEntry + fNEntries - 1);
+   const auto clusterLastEntry = clusterDesc.GetFirstEntryIndex() + clusterDesc.GetNEntries() - 1;
+   return (clusterDesc.GetFirstEntryIndex() <= lastEntry) && (clusterLastEntry >= fFirstEntry);
+}
+
+
 ROOT::Experimental::Detail::RPageSource::RPageSource(std::string_view name, const RNTupleReadOptions &options)
    : RPageStorage(name), fOptions(options)
 {
@@ -70,12 +99,23 @@ ROOT::Experimental::Detail::RPageSource::AddColumn(DescriptorId_t fieldId, const
    R__ASSERT(fieldId != kInvalidDescriptorId);
    auto columnId = fDescriptor.FindColumnId(fieldId, column.GetIndex());
    R__ASSERT(columnId != kInvalidDescriptorId);
-   fActiveColumns.emplace(columnId);
+   if (fActiveColumnRefs[columnId]++ == 0)
+      fActiveColumns.emplace(columnId);
+   if (fOnStorageElements.count(columnId) == 0) {
+      const auto onStorageType = fDescriptor.GetColumnDescriptor(columnId).GetModel().GetType();
+      fOnStorageElements[columnId] = RColumnElementBase::Generate(onStorageType);
+      R__ASSERT(fOnStorageElements[columnId]->GetSize() == column.GetElement()->GetSize());
+   }
    return ColumnHandle_t{columnId, &column};
 }
 
 void ROOT::Experimental::Detail::RPageSource::DropColumn(ColumnHandle_t columnHandle)
 {
+   auto itr = fActiveColumnRefs.find(columnHandle.fId);
+   R__ASSERT(itr != fActiveColumnRefs.end());
+   if (--itr->second > 0)
+      return;
+   fActiveColumnRefs.erase(itr);
    fActiveColumns.erase(columnHandle.fId);
 }
 
@@ -95,6 +135,18 @@ ROOT::Experimental::ColumnId_t ROOT::Experimental::Detail::RPageSource::GetColum
    return columnHandle.fId;
 }
 
+std::unique_ptr<ROOT::Experimental::Detail::RPageSource::RClusterLoadHandle>
+ROOT::Experimental::Detail::RPageSource::LoadClusterAsync(DescriptorId_t clusterId, const ColumnSet_t &columns)
+{
+   return std::make_unique<RClusterLoadHandleDone>(LoadCluster(clusterId, columns));
+}
+
+void ROOT::Experimental::Detail::RPageSource::UnzipCluster(RCluster *cluster)
+{
+   if (fTaskScheduler)
+      UnzipClusterImpl(cluster);
+}
+
 
 //------------------------------------------------------------------------------
 
@@ -118,7 +170,11 @@ ROOT::Experimental::Detail::RPageStorage::ColumnHandle_t
 ROOT::Experimental::Detail::RPageSink::AddColumn(DescriptorId_t fieldId, const RColumn &column)
 {
    auto columnId = fLastColumnId++;
-   fDescriptorBuilder.AddColumn(columnId, fieldId, column.GetVersion(), column.GetModel(), column.GetIndex());
+   auto model = column.GetModel();
+   if (fOptions.GetUseSplitEncoding())
+      model = RColumnModel(RColumnElementBase::GetSplitType(model.GetType()), model.GetIsSorted());
+   fDescriptorBuilder.AddColumn(columnId, fieldId, column.GetVersion(), model, column.GetIndex());
+   fOnStorageElements.emplace_back(RColumnElementBase::Generate(model.GetType()));
    return ColumnHandle_t{columnId, &column};
 }
 
@@ -176,6 +232,67 @@ void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHand
    pageInfo.fNElements = page.GetNElements();
    pageInfo.fLocator = locator;
    fOpenPageRanges[columnId].fPageInfos.emplace_back(pageInfo);
+
+   if (fOptions.GetWriteColumnStats()) {
+      double min, max;
+      if (columnHandle.fColumn->GetElement()->GetMinMax(page.GetBuffer(), page.GetNElements(), min, max))
+         UpdateColumnStats(columnId, min, max);
+   }
+}
+
+
+void ROOT::Experimental::Detail::RPageSink::UpdateColumnStats(DescriptorId_t columnId, double min, double max)
+{
+   auto &columnRange = fOpenColumnRanges[columnId];
+   if (!columnRange.fHasStats) {
+      columnRange.fHasStats = true;
+      columnRange.fMin = min;
+      columnRange.fMax = max;
+      return;
+   }
+   columnRange.fMin = std::min(columnRange.fMin, min);
+   columnRange.fMax = std::max(columnRange.fMax, max);
+}
+
+
+void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(DescriptorId_t columnId, const RSealedPage &sealedPage)
+{
+   auto locator = CommitSealedPageImpl(columnId, sealedPage);
+
+   fOpenColumnRanges[columnId].fNElements += sealedPage.fNElements;
+   RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+   pageInfo.fNElements = sealedPage.fNElements;
+   pageInfo.fLocator = locator;
+   fOpenPageRanges[columnId].fPageInfos.emplace_back(pageInfo);
+}
+
+
+ROOT::Experimental::Detail::RPageSink::RSealedPage
+ROOT::Experimental::Detail::RPageSink::SealPage(const RPage &page, const RColumnElementBase &element,
+                                                int compressionSetting, void *buf)
+{
+   unsigned char *pageBuf = reinterpret_cast<unsigned char *>(page.GetBuffer());
+   bool isAdoptedBuffer = true;
+   auto packedBytes = page.GetSize();
+
+   if (!element.IsMappable()) {
+      packedBytes = (page.GetNElements() * element.GetBitsOnStorage() + 7) / 8;
+      if (compressionSetting == 0) {
+         element.Pack(buf, page.GetBuffer(), page.GetNElements());
+         return RSealedPage(buf, packedBytes, page.GetNElements());
+      }
+      pageBuf = new unsigned char[packedBytes];
+      isAdoptedBuffer = false;
+      element.Pack(pageBuf, page.GetBuffer(), page.GetNElements());
+   }
+
+   if (compressionSetting == 0)
+      return RSealedPage(pageBuf, packedBytes, page.GetNElements());
+
+   auto zippedBytes = RNTupleCompressor::Zip(pageBuf, packedBytes, compressionSetting, buf);
+   if (!isAdoptedBuffer)
+      delete[] pageBuf;
+   return RSealedPage(buf, zippedBytes, page.GetNElements());
 }
 
 
@@ -191,6 +308,7 @@ void ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NT
       fDescriptorBuilder.AddClusterColumnRange(fLastClusterId, range);
       range.fFirstElementIndex += range.fNElements;
       range.fNElements = 0;
+      range.fHasStats = false;
    }
    for (auto &range : fOpenPageRanges) {
       RClusterDescriptor::RPageRange fullRange;
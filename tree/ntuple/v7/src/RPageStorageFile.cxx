@@ -30,6 +30,7 @@
 #include <TError.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
@@ -96,44 +97,37 @@ void ROOT::Experimental::Detail::RPageSinkFile::CreateImpl(const RNTupleModel &
 
 
 ROOT::Experimental::RClusterDescriptor::RLocator
-ROOT::Experimental::Detail::RPageSinkFile::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
+ROOT::Experimental::Detail::RPageSinkFile::WriteSealedPage(const RSealedPage &sealedPage, std::size_t bytesPacked)
 {
-   unsigned char *buffer = reinterpret_cast<unsigned char *>(page.GetBuffer());
-   bool isAdoptedBuffer = true;
-   auto packedBytes = page.GetSize();
-   auto element = columnHandle.fColumn->GetElement();
-   const auto isMappable = element->IsMappable();
-
-   if (!isMappable) {
-      packedBytes = (page.GetNElements() * element->GetBitsOnStorage() + 7) / 8;
-      buffer = new unsigned char[packedBytes];
-      isAdoptedBuffer = false;
-      element->Pack(buffer, page.GetBuffer(), page.GetNElements());
-   }
-   auto zippedBytes = packedBytes;
-
-   if (fOptions.GetCompression() != 0) {
-      zippedBytes = fCompressor(buffer, packedBytes, fOptions.GetCompression());
-      if (!isAdoptedBuffer)
-         delete[] buffer;
-      buffer = const_cast<unsigned char *>(reinterpret_cast<const unsigned char *>(fCompressor.GetZipBuffer()));
-      isAdoptedBuffer = true;
-   }
-
-   auto offsetData = fWriter->WriteBlob(buffer, zippedBytes, packedBytes);
+   auto offsetData = fWriter->WriteBlob(sealedPage.fBuffer, sealedPage.fSize, bytesPacked);
    fClusterMinOffset = std::min(offsetData, fClusterMinOffset);
-   fClusterMaxOffset = std::max(offsetData + zippedBytes, fClusterMaxOffset);
-
-   if (!isAdoptedBuffer)
-      delete[] buffer;
+   fClusterMaxOffset = std::max(offsetData + sealedPage.fSize, fClusterMaxOffset);
 
    RClusterDescriptor::RLocator result;
    result.fPosition = offsetData;
-   result.fBytesOnStorage = zippedBytes;
+   result.fBytesOnStorage = sealedPage.fSize;
    return result;
 }
 
 
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkFile::CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page)
+{
+   const auto &element = *fOnStorageElements[columnHandle.fId];
+   auto sealedPage = SealPage(page, element, fOptions.GetCompression(), fCompressor.GetZipBuffer());
+   auto bytesPacked = (page.GetNElements() * element.GetBitsOnStorage() + 7) / 8;
+   return WriteSealedPage(sealedPage, bytesPacked);
+}
+
+
+ROOT::Experimental::RClusterDescriptor::RLocator
+ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage)
+{
+   auto bytesPacked = (sealedPage.fNElements * fOnStorageElements[columnId]->GetBitsOnStorage() + 7) / 8;
+   return WriteSealedPage(sealedPage, bytesPacked);
+}
+
+
 ROOT::Experimental::RClusterDescriptor::RLocator
 ROOT::Experimental::Detail::RPageSinkFile::CommitClusterImpl(ROOT::Experimental::NTupleSize_t /* nEntries */)
 {
@@ -211,15 +205,21 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nRead", "", "number of byte ranges read"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szReadPayload", "B", "volume read from file (required)"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szReadOverhead", "B", "volume read from file (overhead)"),
-      *fMetrics.MakeCounter<RNTuplePlainCounter*> ("szUnzip", "B", "volume after unzipping"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("szUnzip", "B", "volume after unzipping"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nClusterLoaded", "",
                                                    "number of partial clusters preloaded from storage"),
       *fMetrics.MakeCounter<RNTuplePlainCounter*> ("nPageLoaded", "", "number of pages loaded from storage"),
       *fMetrics.MakeCounter<RNTuplePlainCounter*> ("nPagePopulated", "", "number of populated pages"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPagePreloaded", "",
+                                                   "number of pages unzipped in the background"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nPageIdle", "",
+                                                   "number of preloaded pages waiting in the page pool"),
+      *fMetrics.MakeCounter<RNTuplePlainCounter*> ("nPageMapped", "",
+                                                   "number of pages used in place from the memory mapped file"),
       *fMetrics.MakeCounter<RNTupleAtomicCounter*>("timeWallRead", "ns", "wall clock time spent reading"),
-      *fMetrics.MakeCounter<RNTuplePlainCounter*> ("timeWallUnzip", "ns", "wall clock time spent decompressing"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("timeWallUnzip", "ns", "wall clock time spent decompressing"),
       *fMetrics.MakeCounter<RNTupleTickCounter<RNTupleAtomicCounter>*>("timeCpuRead", "ns", "CPU time spent reading"),
-      *fMetrics.MakeCounter<RNTupleTickCounter<RNTuplePlainCounter>*> ("timeCpuUnzip", "ns",
+      *fMetrics.MakeCounter<RNTupleTickCounter<RNTupleAtomicCounter>*>("timeCpuUnzip", "ns",
                                                                        "CPU time spent decompressing")
    });
 }
@@ -237,6 +237,28 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
 
 ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile()
 {
+   if (!fMappedFile)
+      return;
+   // Pages used in place must not outlive the mapping
+   fPagePool.reset();
+   fFile->Unmap(fMappedFile, fMappedSize);
+}
+
+
+void ROOT::Experimental::Detail::RPageSourceFile::MapFile()
+{
+   if (!fOptions.GetUseMmap() || fMappedFile)
+      return;
+   if (!(fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap))
+      return;
+   const auto fileSize = fFile->GetSize();
+   if (fileSize == 0)
+      return;
+
+   std::uint64_t mapdOffset;
+   fMappedFile = static_cast<unsigned char *>(fFile->Map(fileSize, 0, mapdOffset));
+   R__ASSERT(mapdOffset == 0);
+   fMappedSize = fileSize;
 }
 
 
@@ -257,6 +279,7 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
    fDecompressor(zipBuffer.get(), ntpl.fNBytesFooter, ntpl.fLenFooter, buffer.get());
    descBuilder.AddClustersFromFooter(buffer.get());
 
+   MapFile();
    return descBuilder.MoveDescriptor();
 }
 
@@ -285,50 +308,141 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
    R__ASSERT(firstInPage <= clusterIndex);
    R__ASSERT((firstInPage + pageInfo.fNElements) > clusterIndex);
 
-   const auto element = columnHandle.fColumn->GetElement();
+   const auto element = fOnStorageElements.at(columnId).get();
    const auto elementSize = element->GetSize();
-
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
-   const auto bytesPacked = (element->GetBitsOnStorage() * pageInfo.fNElements + 7) / 8;
-   const auto pageSize = elementSize * pageInfo.fNElements;
 
-   auto pageBuffer = new unsigned char[bytesPacked];
-   if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
-      fReader.ReadBuffer(pageBuffer, bytesOnStorage, pageInfo.fLocator.fPosition);
+   const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
+   unsigned char *pageBuffer = nullptr;
+   if (fMappedFile) {
+      R__ASSERT(pageInfo.fLocator.fPosition + bytesOnStorage <= fMappedSize);
+      auto sealedPage = fMappedFile + pageInfo.fLocator.fPosition;
+      const auto bytesPacked = (element->GetBitsOnStorage() * pageInfo.fNElements + 7) / 8;
+      // Unaligned pages are copied from the mapping rather than used in place
+      if (element->IsMappable() && (bytesOnStorage == bytesPacked) &&
+          (reinterpret_cast<std::uintptr_t>(sealedPage) % elementSize == 0)) {
+         fCounters->fNPageMapped.Inc();
+         auto newPage = fPageAllocator->NewPage(columnId, sealedPage, elementSize, pageInfo.fNElements);
+         newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
+         // The page memory belongs to the mapping, which is released together with the page source
+         fPagePool->RegisterPage(newPage, RPageDeleter([](const RPage & /*page*/, void * /*userData*/) {}, nullptr));
+         return newPage;
+      }
+      pageBuffer = UnsealPage(sealedPage, bytesOnStorage, *element, pageInfo.fNElements);
+   } else if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
+      auto sealedPageBuffer = std::unique_ptr<unsigned char []>(new unsigned char[bytesOnStorage]);
+      fReader.ReadBuffer(sealedPageBuffer.get(), bytesOnStorage, pageInfo.fLocator.fPosition);
       fCounters->fNPageLoaded.Inc();
+      pageBuffer = UnsealPage(sealedPageBuffer.get(), bytesOnStorage, *element, pageInfo.fNElements);
    } else {
       if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) || !fCurrentCluster->ContainsColumn(columnId))
          fCurrentCluster = fClusterPool->GetCluster(clusterId, fActiveColumns);
       R__ASSERT(fCurrentCluster->ContainsColumn(columnId));
+
+      // The page may have been unzipped by the cluster pool's unzip thread while we were waiting for the cluster
+      auto cachedPage = fPagePool->GetPage(columnId, RClusterIndex(clusterId, clusterIndex));
+      if (!cachedPage.IsNull())
+         return cachedPage;
+
       ROnDiskPage::Key key(columnId, pageNo);
       auto onDiskPage = fCurrentCluster->GetOnDiskPage(key);
       R__ASSERT(onDiskPage);
       R__ASSERT(bytesOnStorage == onDiskPage->GetSize());
-      memcpy(pageBuffer, onDiskPage->GetAddress(), onDiskPage->GetSize());
+      pageBuffer = UnsealPage(onDiskPage->GetAddress(), bytesOnStorage, *element, pageInfo.fNElements);
    }
 
+   auto newPage = fPageAllocator->NewPage(columnId, pageBuffer, elementSize, pageInfo.fNElements);
+   newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
+   fPagePool->RegisterPage(newPage,
+      RPageDeleter([](const RPage &page, void * /*userData*/)
+      {
+         RPageAllocatorFile::DeletePage(page);
+      }, nullptr));
+   return newPage;
+}
+
+
+unsigned char *ROOT::Experimental::Detail::RPageSourceFile::UnsealPage(
+   const void *sealedPage, std::size_t bytesOnStorage, const RColumnElementBase &element,
+   ClusterSize_t::ValueType nElements)
+{
+   const auto bytesPacked = (element.GetBitsOnStorage() * nElements + 7) / 8;
+   const auto pageSize = element.GetSize() * nElements;
+
+   auto pageBuffer = new unsigned char[bytesPacked];
    if (bytesOnStorage != bytesPacked) {
-      RNTuplePlainTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-      fDecompressor(pageBuffer, bytesOnStorage, bytesPacked);
+      RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
+      RNTupleDecompressor::Unzip(sealedPage, bytesOnStorage, bytesPacked, pageBuffer);
       fCounters->fSzUnzip.Add(bytesPacked);
+   } else {
+      memcpy(pageBuffer, sealedPage, bytesOnStorage);
    }
 
-   if (!element->IsMappable()) {
+   if (!element.IsMappable()) {
       auto unpackedBuffer = new unsigned char[pageSize];
-      element->Unpack(unpackedBuffer, pageBuffer, pageInfo.fNElements);
+      element.Unpack(unpackedBuffer, pageBuffer, nElements);
       delete[] pageBuffer;
       pageBuffer = unpackedBuffer;
    }
+   return pageBuffer;
+}
 
-   const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
-   auto newPage = fPageAllocator->NewPage(columnId, pageBuffer, elementSize, pageInfo.fNElements);
-   newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
-   fPagePool->RegisterPage(newPage,
-      RPageDeleter([](const RPage &page, void * /*userData*/)
-      {
-         RPageAllocatorFile::DeletePage(page);
-      }, nullptr));
-   return newPage;
+
+void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *cluster)
+{
+   fTaskScheduler->Reset();
+
+   const auto clusterId = cluster->GetId();
+   const auto &clusterDescriptor = fDescriptor.GetClusterDescriptor(clusterId);
+
+   std::vector<std::unique_ptr<RColumnElementBase>> allElements;
+
+   const auto &columnsInCluster = cluster->GetAvailColumns();
+   for (const auto columnId : columnsInCluster) {
+      const auto &columnDesc = fDescriptor.GetColumnDescriptor(columnId);
+      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+
+      const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
+      const auto indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex;
+      std::uint64_t pageNo = 0;
+      std::uint64_t firstInPage = 0;
+      for (const auto &pi : pageRange.fPageInfos) {
+         ROnDiskPage::Key key(columnId, pageNo);
+         auto onDiskPage = cluster->GetOnDiskPage(key);
+         R__ASSERT(onDiskPage);
+         R__ASSERT(onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage);
+
+         auto element = allElements.back().get();
+         auto taskFunc = [this, columnId, clusterId, firstInPage, onDiskPage, element, indexOffset,
+                          nElements = pi.fNElements]
+         {
+            auto pageBuffer = UnsealPage(onDiskPage->GetAddress(), onDiskPage->GetSize(), *element, nElements);
+            auto newPage = fPageAllocator->NewPage(columnId, pageBuffer, element->GetSize(), nElements);
+            newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
+            fPagePool->PreloadPage(newPage,
+               RPageDeleter([](const RPage &page, void * /*userData*/)
+               {
+                  RPageAllocatorFile::DeletePage(page);
+               }, nullptr));
+            fCounters->fNPagePreloaded.Inc();
+            fCounters->fNPageIdle.SetValue(fPagePool->GetNIdlePages());
+         };
+
+         fTaskScheduler->AddTask(taskFunc);
+
+         firstInPage += pi.fNElements;
+         pageNo++;
+      } // for all pages in column
+   } // for all columns in cluster
+
+   fTaskScheduler->Wait();
+}
+
+
+void ROOT::Experimental::Detail::RPageSourceFile::EvictClusterImpl(DescriptorId_t clusterId)
+{
+   fPagePool->EvictCluster(clusterId);
+   fCounters->fNPageIdle.SetValue(fPagePool->GetNIdlePages());
 }
 
 
@@ -337,8 +451,10 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
 {
    const auto columnId = columnHandle.fId;
    auto cachedPage = fPagePool->GetPage(columnId, globalIndex);
-   if (!cachedPage.IsNull())
+   if (!cachedPage.IsNull()) {
+      fCounters->fNPageIdle.SetValue(fPagePool->GetNIdlePages());
       return cachedPage;
+   }
 
    const auto clusterId = fDescriptor.FindClusterId(columnId, globalIndex);
    R__ASSERT(clusterId != kInvalidDescriptorId);
@@ -356,8 +472,10 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
    const auto index = clusterIndex.GetIndex();
    const auto columnId = columnHandle.fId;
    auto cachedPage = fPagePool->GetPage(columnId, clusterIndex);
-   if (!cachedPage.IsNull())
+   if (!cachedPage.IsNull()) {
+      fCounters->fNPageIdle.SetValue(fPagePool->GetNIdlePages());
       return cachedPage;
+   }
 
    R__ASSERT(clusterId != kInvalidDescriptorId);
    const auto &clusterDescriptor = fDescriptor.GetClusterDescriptor(clusterId);
@@ -378,7 +496,8 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Det
 }
 
 std::unique_ptr<ROOT::Experimental::Detail::RCluster>
-ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+ROOT::Experimental::Detail::RPageSourceFile::PrepareLoadCluster(
+   DescriptorId_t clusterId, const ColumnSet_t &columns, std::vector<ROOT::Internal::RRawFile::RIOVec> &readRequests)
 {
    fCounters->fNClusterLoaded.Inc();
 
@@ -447,7 +566,7 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
       std::uint64_t fOffset = 0;
       std::uint64_t fSize = 0;
    };
-   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+   readRequests.clear();
 
    ROOT::Internal::RRawFile::RIOVec req;
    std::size_t szPayload = 0;
@@ -491,6 +610,19 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
       r.fBuffer = buffer + reinterpret_cast<intptr_t>(r.fBuffer);
    }
 
+   auto cluster = std::make_unique<RCluster>(clusterId);
+   cluster->Adopt(std::move(pageMap));
+   for (auto colId : columns)
+      cluster->SetColumnAvailable(colId);
+   return cluster;
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterId, const ColumnSet_t &columns)
+{
+   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+   auto cluster = PrepareLoadCluster(clusterId, columns, readRequests);
+
    auto nReqs = readRequests.size();
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
@@ -499,9 +631,61 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadCluster(DescriptorId_t clusterI
    fCounters->fNReadV.Inc();
    fCounters->fNRead.Add(nReqs);
 
-   auto cluster = std::make_unique<RCluster>(clusterId);
-   cluster->Adopt(std::move(pageMap));
-   for (auto colId : columns)
-      cluster->SetColumnAvailable(colId);
    return cluster;
 }
+
+namespace {
+
+/// The in-flight vector read of a cluster.  The read requests are owned by the handle because the raw file
+/// accesses them until the read completes.  The read is timed once, from its submission until Wait() returns.
+class RClusterLoadHandleFile : public ROOT::Experimental::Detail::RPageSource::RClusterLoadHandle {
+   using RCluster = ROOT::Experimental::Detail::RCluster;
+   using RRawFile = ROOT::Internal::RRawFile;
+   using RNTupleAtomicCounter = ROOT::Experimental::Detail::RNTupleAtomicCounter;
+   using RNTupleAtomicTimer = ROOT::Experimental::Detail::RNTupleAtomicTimer;
+
+private:
+   std::unique_ptr<RCluster> fCluster;
+   std::vector<RRawFile::RIOVec> fReadRequests;
+   /// Declared before fAsyncRead so that a read that is not waited for is still timed until it completed
+   std::unique_ptr<RNTupleAtomicTimer> fTimer;
+   std::unique_ptr<RRawFile::RAsyncReadV> fAsyncRead;
+   RNTupleAtomicCounter &fTimeWallRead;
+   ROOT::Experimental::Detail::RNTupleTickCounter<RNTupleAtomicCounter> &fTimeCpuRead;
+
+public:
+   RClusterLoadHandleFile(std::unique_ptr<RCluster> cluster, std::vector<RRawFile::RIOVec> &&readRequests,
+                          RNTupleAtomicCounter &timeWallRead,
+                          ROOT::Experimental::Detail::RNTupleTickCounter<RNTupleAtomicCounter> &timeCpuRead)
+      : fCluster(std::move(cluster)), fReadRequests(std::move(readRequests)),
+        fTimeWallRead(timeWallRead), fTimeCpuRead(timeCpuRead)
+   {}
+
+   void Submit(RRawFile &file) {
+      fTimer = std::make_unique<RNTupleAtomicTimer>(fTimeWallRead, fTimeCpuRead);
+      fAsyncRead = file.ReadVAsync(&fReadRequests[0], fReadRequests.size());
+   }
+
+   std::unique_ptr<RCluster> Wait() final {
+      fAsyncRead->Wait();
+      fTimer.reset();
+      return std::move(fCluster);
+   }
+};
+
+} // anonymous namespace
+
+std::unique_ptr<ROOT::Experimental::Detail::RPageSource::RClusterLoadHandle>
+ROOT::Experimental::Detail::RPageSourceFile::LoadClusterAsync(DescriptorId_t clusterId, const ColumnSet_t &columns)
+{
+   std::vector<ROOT::Internal::RRawFile::RIOVec> readRequests;
+   auto cluster = PrepareLoadCluster(clusterId, columns, readRequests);
+   auto nReqs = readRequests.size();
+
+   auto handle = std::make_unique<RClusterLoadHandleFile>(std::move(cluster), std::move(readRequests),
+                                                          fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
+   handle->Submit(*fFile);
+   fCounters->fNReadV.Inc();
+   fCounters->fNRead.Add(nReqs);
+   return handle;
+}
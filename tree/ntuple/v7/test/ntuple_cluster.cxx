@@ -285,6 +285,23 @@ TEST(ClusterPool, GetClusterIncrementally)
 }
 
 
+TEST(ClusterPool, GetClusterEntryRange)
+{
+   RPageSourceMock p1;
+   RPageSource::REntryRange entryRange;
+   entryRange.fFirstEntry = 1;
+   entryRange.fNEntries = 2;
+   p1.SetEntryRange(entryRange);
+   {
+      RClusterPool c1(p1, 4);
+      c1.GetCluster(1, {0});
+   }
+   ASSERT_EQ(2U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(1U, p1.fReqsClusterIds[0]);
+   EXPECT_EQ(2U, p1.fReqsClusterIds[1]);
+}
+
+
 TEST(PageStorageFile, LoadCluster)
 {
    FileRaii fileGuard("test_ntuple_clusters.root");
@@ -328,3 +345,51 @@ TEST(PageStorageFile, LoadCluster)
    ROnDiskPage::Key key(colId, 0);
    EXPECT_NE(nullptr, cluster->GetOnDiskPage(key));
 }
+
+
+TEST(PageStorageFile, LoadClusterAsync)
+{
+   FileRaii fileGuard("test_ntuple_clusters_async.root");
+
+   auto modelWrite = ROOT::Experimental::RNTupleModel::Create();
+   auto wrPt = modelWrite->MakeField<float>("pt", 42.0);
+
+   {
+      ROOT::Experimental::RNTupleWriter ntuple(
+         std::move(modelWrite), std::make_unique<ROOT::Experimental::Detail::RPageSinkFile>(
+            "myNTuple", fileGuard.GetPath(), ROOT::Experimental::RNTupleWriteOptions()));
+      ntuple.Fill();
+      ntuple.CommitCluster();
+      *wrPt = 24.0;
+      ntuple.Fill();
+   }
+
+   ROOT::Experimental::Detail::RPageSourceFile source(
+      "myNTuple", fileGuard.GetPath(), ROOT::Experimental::RNTupleReadOptions());
+   source.Attach();
+
+   auto ptId = source.GetDescriptor().FindFieldId("pt");
+   auto colId = source.GetDescriptor().FindColumnId(ptId, 0);
+   EXPECT_NE(ROOT::Experimental::kInvalidDescriptorId, colId);
+
+   // Both cluster reads are in flight at the same time
+   auto handle0 = source.LoadClusterAsync(0, {colId});
+   auto handle1 = source.LoadClusterAsync(1, {colId});
+   auto cluster1 = handle1->Wait();
+   auto cluster0 = handle0->Wait();
+   EXPECT_EQ(0U, cluster0->GetId());
+   EXPECT_EQ(1U, cluster1->GetId());
+
+   ROnDiskPage::Key key(colId, 0);
+   auto page0 = cluster0->GetOnDiskPage(key);
+   auto page1 = cluster1->GetOnDiskPage(key);
+   ASSERT_NE(nullptr, page0);
+   ASSERT_NE(nullptr, page1);
+
+   // The page contents match the ones from the synchronous code path
+   auto clusterSync = source.LoadCluster(1, {colId});
+   auto pageSync = clusterSync->GetOnDiskPage(key);
+   ASSERT_NE(nullptr, pageSync);
+   ASSERT_EQ(pageSync->GetSize(), page1->GetSize());
+   EXPECT_EQ(0, memcmp(pageSync->GetAddress(), page1->GetAddress(), page1->GetSize()));
+}
@@ -78,7 +78,11 @@ TEST(RNTuple, Descriptor)
    columnRange.fColumnId = 3;
    columnRange.fFirstElementIndex = 100;
    columnRange.fNElements = 1000;
+   columnRange.fHasStats = true;
+   columnRange.fMin = -1.5;
+   columnRange.fMax = 7.0;
    descBuilder.AddClusterColumnRange(1, columnRange);
+   columnRange.fHasStats = false;
    ROOT::Experimental::RClusterDescriptor::RPageRange pageRange2;
    pageRange2.fColumnId = 3;
    pageInfo.fNElements = 1000;
@@ -127,6 +131,14 @@ TEST(RNTuple, Descriptor)
    reco.SetFromHeader(headerBuffer);
    reco.AddClustersFromFooter(footerBuffer);
    EXPECT_EQ(reference, reco.GetDescriptor());
+   const auto &recoColumnRange = reco.GetDescriptor().GetClusterDescriptor(1).GetColumnRange(3);
+   EXPECT_TRUE(recoColumnRange.fHasStats);
+   EXPECT_EQ(-1.5, recoColumnRange.fMin);
+   EXPECT_EQ(7.0, recoColumnRange.fMax);
+   EXPECT_TRUE(recoColumnRange.MayContainValues(7.0, 100.0));
+   EXPECT_FALSE(recoColumnRange.MayContainValues(7.5, 100.0));
+   EXPECT_FALSE(recoColumnRange.MayContainValues(-3.0, -2.0));
+   EXPECT_TRUE(reco.GetDescriptor().GetClusterDescriptor(0).GetColumnRange(3).MayContainValues(7.5, 100.0));
 
    EXPECT_EQ(NTupleSize_t(1100), reference.GetNEntries());
    EXPECT_EQ(NTupleSize_t(1100), reference.GetNElements(3));
@@ -2,6 +2,10 @@
 
 #include "ntuple_test.hxx"
 
+#include <TROOT.h>
+
+#include <algorithm>
+
 TEST(RNTuple, RealWorld1)
 {
    FileRaii fileGuard("test_ntuple_realworld1.root");
@@ -68,6 +72,149 @@ TEST(RNTuple, RealWorld1)
 }
 
 
+#ifdef R__USE_IMT
+TEST(RNTuple, ParallelUnzip)
+{
+   FileRaii fileGuard("test_ntuple_parallel_unzip.root");
+
+   auto modelWrite = RNTupleModel::Create();
+   auto wrValue = modelWrite->MakeField<std::int32_t>("value");
+   auto wrFlags = modelWrite->MakeField<std::vector<bool>>("flags");
+
+   constexpr unsigned int nEvents = 100000;
+   std::int64_t chksumWrite = 0;
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(modelWrite), "myNTuple", fileGuard.GetPath());
+      for (unsigned int i = 0; i < nEvents; ++i) {
+         *wrValue = i;
+         wrFlags->assign(i % 7, (i % 2) == 0);
+         chksumWrite += i + std::count(wrFlags->begin(), wrFlags->end(), true);
+         ntuple->Fill();
+         if (i % 10000 == 9999)
+            ntuple->CommitCluster();
+      }
+   }
+
+   ROOT::EnableImplicitMT();
+   {
+      auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+      ntuple->EnableMetrics();
+      auto viewValue = ntuple->GetView<std::int32_t>("value");
+      auto viewFlags = ntuple->GetView<std::vector<bool>>("flags");
+      std::int64_t chksumRead = 0;
+      for (auto i : ntuple->GetEntryRange()) {
+         chksumRead += viewValue(i);
+         auto flags = viewFlags(i);
+         chksumRead += std::count(flags.begin(), flags.end(), true);
+      }
+      EXPECT_EQ(chksumWrite, chksumRead);
+      auto nPagePreloaded = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPagePreloaded");
+      ASSERT_NE(nullptr, nPagePreloaded);
+      EXPECT_GT(nPagePreloaded->GetValueAsInt(), 0);
+   }
+   ROOT::DisableImplicitMT();
+}
+
+TEST(RNTuple, ParallelUnzipBoundedPool)
+{
+   FileRaii fileGuard("test_ntuple_parallel_unzip_bounded_pool.root");
+
+   auto modelWrite = RNTupleModel::Create();
+   auto wrValue = modelWrite->MakeField<std::int32_t>("value");
+
+   constexpr unsigned int nClusters = 40;
+   constexpr unsigned int nEventsPerCluster = 10000;
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(modelWrite), "myNTuple", fileGuard.GetPath());
+      for (unsigned int i = 0; i < nClusters * nEventsPerCluster; ++i) {
+         *wrValue = i;
+         ntuple->Fill();
+         if (i % nEventsPerCluster == nEventsPerCluster - 1)
+            ntuple->CommitCluster();
+      }
+   }
+
+   ROOT::EnableImplicitMT();
+   {
+      auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+      ntuple->EnableMetrics();
+      auto nPagePreloaded = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPagePreloaded");
+      auto nPageIdle = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPageIdle");
+      ASSERT_NE(nullptr, nPagePreloaded);
+      ASSERT_NE(nullptr, nPageIdle);
+
+      // Skip every other cluster: its pages are preloaded by the look-ahead but never requested
+      auto viewValue = ntuple->GetView<std::int32_t>("value");
+      std::int64_t maxIdle = 0;
+      for (auto i : ntuple->GetEntryRange()) {
+         if ((i / nEventsPerCluster) % 2 == 1)
+            continue;
+         EXPECT_EQ(static_cast<std::int32_t>(i), viewValue(i));
+         maxIdle = std::max(maxIdle, nPageIdle->GetValueAsInt());
+      }
+
+      const auto nPagesPerCluster = nPagePreloaded->GetValueAsInt() / nClusters;
+      EXPECT_GT(nPagesPerCluster, 0);
+      // Without releasing the pages of evicted clusters, the idle pages would accumulate up to nClusters / 2 clusters
+      EXPECT_LE(maxIdle, 4 * nPagesPerCluster);
+   }
+   ROOT::DisableImplicitMT();
+}
+#endif
+
+
+TEST(RNTuple, ParallelWriter)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer.root");
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<std::int32_t>("value");
+   model->MakeField<std::vector<float>>("floats");
+
+   constexpr unsigned int kNThreads = 4;
+   constexpr unsigned int kNEventsPerThread = 25000;
+   std::array<std::int64_t, kNThreads> chksumsWrite{};
+   {
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath());
+      std::vector<std::thread> threads;
+      for (unsigned int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, &chksumsWrite, t]() {
+            auto fillContext = writer->CreateFillContext();
+            auto value = fillContext->GetModel()->Get<std::int32_t>("value");
+            auto floats = fillContext->GetModel()->Get<std::vector<float>>("floats");
+            for (unsigned int i = 0; i < kNEventsPerThread; ++i) {
+               *value = t * kNEventsPerThread + i;
+               floats->assign(i % 5, 1.0);
+               chksumsWrite[t] += *value + floats->size();
+               fillContext->Fill();
+               if (i % 5000 == 4999)
+                  fillContext->CommitCluster();
+            }
+            EXPECT_EQ(NTupleSize_t(kNEventsPerThread), fillContext->GetNEntries());
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+   }
+
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   EXPECT_EQ(kNThreads * kNEventsPerThread, ntuple->GetNEntries());
+   EXPECT_EQ(kNThreads * kNEventsPerThread / 5000, ntuple->GetDescriptor().GetNClusters());
+   auto viewValue = ntuple->GetView<std::int32_t>("value");
+   auto viewFloats = ntuple->GetView<std::vector<float>>("floats");
+   std::int64_t chksumRead = 0;
+   for (auto i : ntuple->GetEntryRange()) {
+      chksumRead += viewValue(i);
+      for (auto f : viewFloats(i))
+         chksumRead += static_cast<std::int64_t>(f);
+   }
+   std::int64_t chksumWrite = 0;
+   for (auto c : chksumsWrite)
+      chksumWrite += c;
+   EXPECT_EQ(chksumWrite, chksumRead);
+}
+
+
 // Stress test the asynchronous cluster pool by a deliberately unfavourable read pattern
 TEST(RNTuple, RandomAccess)
 {
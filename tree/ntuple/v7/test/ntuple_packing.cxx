@@ -1,5 +1,7 @@
 #include "ntuple_test.hxx"
 
+#include <limits>
+
 TEST(Packing, Bitfield)
 {
    ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit> element(nullptr);
@@ -32,3 +34,206 @@ TEST(Packing, Bitfield)
       EXPECT_EQ(b9[i], e9[i]);
    }
 }
+
+TEST(Packing, BitfieldBulk)
+{
+   // Covers the vectorized kernels as well as the remainder that is not a multiple of the vector width
+   ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit> element(nullptr);
+   TRandom3 rnd(42);
+   for (std::size_t count : {31, 32, 33, 100, 1000}) {
+      std::unique_ptr<bool[]> b(new bool[count]);
+      for (std::size_t i = 0; i < count; ++i)
+         b[i] = rnd.Rndm() < 0.5;
+      std::unique_ptr<unsigned char[]> packed(new unsigned char[(count + 7) / 8]);
+      element.Pack(packed.get(), b.get(), count);
+      for (std::size_t i = 0; i < count; ++i) {
+         EXPECT_EQ(b[i], static_cast<bool>((packed[i / 8] >> (i % 8)) & 1));
+      }
+      std::unique_ptr<bool[]> e(new bool[count]);
+      element.Unpack(e.get(), packed.get(), count);
+      for (std::size_t i = 0; i < count; ++i) {
+         EXPECT_EQ(b[i], e[i]);
+      }
+   }
+}
+
+TEST(Packing, SplitBulk)
+{
+   ROOT::Experimental::Detail::RColumnElement<double, ROOT::Experimental::EColumnType::kSplitReal64> element64(
+      nullptr);
+   ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32> element32(
+      nullptr);
+   TRandom3 rnd(42);
+   for (std::size_t count : {15, 16, 17, 300, 1000}) {
+      std::vector<double> d(count);
+      std::vector<std::int32_t> v(count);
+      for (std::size_t i = 0; i < count; ++i) {
+         d[i] = rnd.Gaus();
+         v[i] = static_cast<std::int32_t>(rnd.Gaus() * 1000.);
+      }
+
+      std::vector<unsigned char> split64(count * sizeof(double));
+      element64.Pack(split64.data(), d.data(), count);
+      auto bytes64 = reinterpret_cast<const unsigned char *>(d.data());
+      for (std::size_t i = 0; i < count; ++i) {
+         for (std::size_t b = 0; b < sizeof(double); ++b)
+            EXPECT_EQ(bytes64[i * sizeof(double) + b], split64[b * count + i]);
+      }
+      std::vector<double> e64(count);
+      element64.Unpack(e64.data(), split64.data(), count);
+      EXPECT_EQ(d, e64);
+
+      std::vector<unsigned char> split32(count * sizeof(std::int32_t));
+      element32.Pack(split32.data(), v.data(), count);
+      std::vector<std::int32_t> e32(count);
+      element32.Unpack(e32.data(), split32.data(), count);
+      EXPECT_EQ(v, e32);
+   }
+}
+
+TEST(Packing, SplitReal32)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32> element(nullptr);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   float f[] = {1.0, -2.5, 3.0e10, 0.0};
+   unsigned char split[sizeof(f)];
+   element.Pack(split, f, 4);
+   float fLowestBytes[] = {f[0], f[1], f[2], f[3]};
+   auto bytes = reinterpret_cast<unsigned char *>(fLowestBytes);
+   for (unsigned i = 0; i < 4; ++i) {
+      // Assumes little endian: the first 4 bytes of the split array are the lowest bytes of the 4 floats
+      EXPECT_EQ(bytes[i * sizeof(float)], split[i]);
+   }
+   float e[4];
+   element.Unpack(e, split, 4);
+   for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(f[i], e[i]);
+   }
+}
+
+TEST(Packing, SplitInt32)
+{
+   ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32> element(
+      nullptr);
+
+   std::int32_t v[] = {0, -1, 1, -2, std::numeric_limits<std::int32_t>::max(),
+                       std::numeric_limits<std::int32_t>::min()};
+   unsigned char split[sizeof(v)];
+   element.Pack(split, v, 6);
+   // Zigzag encoding: 0, -1, 1, -2 are stored as 0, 1, 2, 3; the upper bytes of small values are zero
+   EXPECT_EQ(0, split[0]);
+   EXPECT_EQ(1, split[1]);
+   EXPECT_EQ(2, split[2]);
+   EXPECT_EQ(3, split[3]);
+   for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(0, split[6 + i]);
+   }
+   std::int32_t e[6];
+   element.Unpack(e, split, 6);
+   for (unsigned i = 0; i < 6; ++i) {
+      EXPECT_EQ(v[i], e[i]);
+   }
+
+   // Unsigned values that use the full range survive the round-trip, too
+   std::uint32_t u[] = {0, 1, std::numeric_limits<std::uint32_t>::max()};
+   std::uint32_t eu[3];
+   element.Pack(split, u, 3);
+   element.Unpack(eu, split, 3);
+   for (unsigned i = 0; i < 3; ++i) {
+      EXPECT_EQ(u[i], eu[i]);
+   }
+}
+
+TEST(Packing, SplitIndex)
+{
+   using ClusterSize_t = ROOT::Experimental::ClusterSize_t;
+   ROOT::Experimental::Detail::RColumnElement<ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex> element(
+      nullptr);
+
+   ClusterSize_t v[] = {ClusterSize_t(3), ClusterSize_t(3), ClusterSize_t(7), ClusterSize_t(1000)};
+   unsigned char split[sizeof(v)];
+   element.Pack(split, v, 4);
+   // Delta encoding: the offsets are stored as collection sizes
+   EXPECT_EQ(3, split[0]);
+   EXPECT_EQ(0, split[1]);
+   EXPECT_EQ(4, split[2]);
+   ClusterSize_t e[4];
+   element.Unpack(e, split, 4);
+   for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(v[i], e[i]);
+   }
+}
+
+TEST(Packing, MinMax)
+{
+   double min, max;
+
+   ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal32> elemFloat(nullptr);
+   float f[] = {1.0, std::numeric_limits<float>::quiet_NaN(), -3.5, 2.0};
+   EXPECT_FALSE(elemFloat.GetMinMax(f, 0, min, max));
+   EXPECT_TRUE(elemFloat.GetMinMax(f, 4, min, max));
+   EXPECT_EQ(-3.5, min);
+   EXPECT_EQ(2.0, max);
+
+   // Large integers are rounded outwards
+   ROOT::Experimental::Detail::RColumnElement<std::uint64_t, ROOT::Experimental::EColumnType::kInt64> elemU64(
+      nullptr);
+   std::uint64_t u[] = {5, std::numeric_limits<std::uint64_t>::max()};
+   EXPECT_TRUE(elemU64.GetMinMax(u, 2, min, max));
+   EXPECT_EQ(5.0, min);
+   EXPECT_GT(max, 18446744073709551615.0);
+
+   ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kInt64> elemI64(nullptr);
+   std::int64_t i[] = {std::numeric_limits<std::int64_t>::min() + 1, -7};
+   EXPECT_TRUE(elemI64.GetMinMax(i, 2, min, max));
+   EXPECT_LT(min, -9223372036854775807.0);
+   EXPECT_EQ(-7.0, max);
+
+   // Offsets have no value statistics
+   ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::ClusterSize_t,
+                                              ROOT::Experimental::EColumnType::kIndex> elemIndex(nullptr);
+   ROOT::Experimental::ClusterSize_t offsets[] = {ROOT::Experimental::ClusterSize_t(1)};
+   EXPECT_FALSE(elemIndex.GetMinMax(offsets, 1, min, max));
+}
+
+TEST(Packing, SplitEncoding)
+{
+   FileRaii fileGuard("test_ntuple_packing_split.root");
+
+   // Split encoding is opt-in
+   EXPECT_FALSE(RNTupleWriteOptions().GetUseSplitEncoding());
+
+   for (auto useSplitEncoding : {true, false}) {
+      {
+         auto model = RNTupleModel::Create();
+         auto fldInts = model->MakeField<std::vector<std::int32_t>>("ints");
+         auto fldPt = model->MakeField<double>("pt");
+         RNTupleWriteOptions options;
+         options.SetUseSplitEncoding(useSplitEncoding);
+         auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+         for (int i = 0; i < 1000; ++i) {
+            fldInts->assign(i % 3, -i);
+            *fldPt = i / 2.0;
+            ntuple->Fill();
+         }
+      }
+
+      auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+      const auto &desc = ntuple->GetDescriptor();
+      auto ptColumnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+      EXPECT_EQ(useSplitEncoding ? EColumnType::kSplitReal64 : EColumnType::kReal64,
+                desc.GetColumnDescriptor(ptColumnId).GetModel().GetType());
+      auto intsColumnId = desc.FindColumnId(desc.FindFieldId("ints"), 0);
+      EXPECT_EQ(useSplitEncoding ? EColumnType::kSplitIndex : EColumnType::kIndex,
+                desc.GetColumnDescriptor(intsColumnId).GetModel().GetType());
+
+      auto viewInts = ntuple->GetView<std::vector<std::int32_t>>("ints");
+      auto viewPt = ntuple->GetView<double>("pt");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_EQ(std::vector<std::int32_t>(i % 3, -static_cast<std::int32_t>(i)), viewInts(i));
+         EXPECT_EQ(i / 2.0, viewPt(i));
+      }
+   }
+}
@@ -27,3 +27,89 @@ TEST(RNTuple, RDF)
    auto rdf = ROOT::Experimental::MakeNTupleDataFrame("myNTuple", fileGuard.GetPath());
    EXPECT_EQ(42.0, *rdf.Min("pt"));
 }
+
+TEST(RNTuple, RDFClusterSkipping)
+{
+   FileRaii fileGuard("test_ntuple_rdf_cluster_skipping.root");
+
+   auto modelWrite = RNTupleModel::Create();
+   auto wrPt = modelWrite->MakeField<float>("pt");
+   auto wrId = modelWrite->MakeField<std::uint64_t>("id");
+
+   constexpr unsigned int nEvents = 1000;
+   {
+      RNTupleWriteOptions options;
+      options.SetWriteColumnStats(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(modelWrite), "myNTuple", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < nEvents; ++i) {
+         *wrPt = i;
+         *wrId = 10 * (nEvents - i);
+         ntuple->Fill();
+         if ((i + 1) % 100 == 0)
+            ntuple->CommitCluster();
+      }
+   }
+
+   {
+      auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+      const auto &desc = ntuple->GetDescriptor();
+      const auto columnId = desc.FindColumnId(desc.FindFieldId("pt"), 0);
+      const auto &columnRange = desc.GetClusterDescriptor(0).GetColumnRange(columnId);
+      EXPECT_TRUE(columnRange.fHasStats);
+      EXPECT_EQ(0.0, columnRange.fMin);
+      EXPECT_EQ(99.0, columnRange.fMax);
+   }
+
+   auto ds = std::make_unique<ROOT::Experimental::RNTupleDS>(RPageSource::Create("myNTuple", fileGuard.GetPath()));
+   ds->SkipClustersOutside("pt", 550.0, std::numeric_limits<double>::infinity());
+   ds->SkipClustersOutside("id", 1500.0, std::numeric_limits<double>::infinity());
+   ds->SetNSlots(1);
+   ds->Initialise();
+   auto ranges = ds->GetEntryRanges();
+   ASSERT_EQ(1U, ranges.size());
+   EXPECT_EQ(500U, ranges[0].first);
+   EXPECT_EQ(900U, ranges[0].second);
+   EXPECT_TRUE(ds->GetEntryRanges().empty());
+
+   auto ds2 = std::make_unique<ROOT::Experimental::RNTupleDS>(RPageSource::Create("myNTuple", fileGuard.GetPath()));
+   ds2->SkipClustersOutside("pt", 550.0, std::numeric_limits<double>::infinity());
+   ROOT::RDataFrame rdf(std::move(ds2));
+   EXPECT_EQ(449U, *rdf.Filter([](float pt) { return pt > 550.0; }, {"pt"}).Count());
+}
+
+TEST(RNTuple, RDFClusterRanges)
+{
+   FileRaii fileGuard("test_ntuple_rdf_cluster_ranges.root");
+
+   auto modelWrite = RNTupleModel::Create();
+   auto wrPt = modelWrite->MakeField<float>("pt");
+
+   constexpr unsigned int nEvents = 1000;
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(modelWrite), "myNTuple", fileGuard.GetPath());
+      for (unsigned int i = 0; i < nEvents; ++i) {
+         *wrPt = i;
+         ntuple->Fill();
+         if ((i + 1) % 100 == 0)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ds = std::make_unique<ROOT::Experimental::RNTupleDS>(RPageSource::Create("myNTuple", fileGuard.GetPath()));
+   ds->SetNSlots(2);
+   ds->Initialise();
+   auto ranges = ds->GetEntryRanges();
+   ASSERT_EQ(10U, ranges.size());
+   for (unsigned int i = 0; i < ranges.size(); ++i) {
+      EXPECT_EQ(100U * i, ranges[i].first);
+      EXPECT_EQ(100U * (i + 1), ranges[i].second);
+   }
+   EXPECT_TRUE(ds->GetEntryRanges().empty());
+
+   ROOT::EnableImplicitMT(4);
+   ROOT::RDataFrame rdf(
+      std::make_unique<ROOT::Experimental::RNTupleDS>(RPageSource::Create("myNTuple", fileGuard.GetPath())));
+   EXPECT_EQ(nEvents, *rdf.Count());
+   EXPECT_DOUBLE_EQ(nEvents * (nEvents - 1) / 2.0, *rdf.Sum<float>("pt"));
+   ROOT::DisableImplicitMT();
+}
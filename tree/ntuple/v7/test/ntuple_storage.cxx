@@ -70,3 +70,55 @@ TEST(RNTuple, Extended)
    }
    EXPECT_EQ(chksumRead, chksumWrite);
 }
+
+TEST(RNTuple, Mmap)
+{
+   FileRaii fileGuard("test_ntuple_mmap.root");
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrVector = model->MakeField<std::vector<double>>("vector");
+   // Byte pages are always aligned, so at least their pages are used in place from the mapping
+   auto wrByte = model->MakeField<std::uint8_t>("byte");
+
+   constexpr unsigned int nEvents = 10000;
+   {
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      options.SetUseSplitEncoding(false);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "f", fileGuard.GetPath(), options);
+      for (unsigned int i = 0; i < nEvents; ++i) {
+         *wrPt = i;
+         wrVector->assign(i % 5, i);
+         *wrByte = i % 256;
+         ntuple->Fill();
+         if (i % 1000 == 0)
+            ntuple->CommitCluster();
+      }
+   }
+
+   RNTupleReadOptions options;
+   options.SetUseMmap(true);
+   auto ntuple = RNTupleReader::Open("f", fileGuard.GetPath(), options);
+   ntuple->EnableMetrics();
+   auto rdPt = ntuple->GetModel()->GetDefaultEntry()->Get<float>("pt");
+   auto rdVector = ntuple->GetModel()->GetDefaultEntry()->Get<std::vector<double>>("vector");
+   auto rdByte = ntuple->GetModel()->GetDefaultEntry()->Get<std::uint8_t>("byte");
+   EXPECT_EQ(nEvents, ntuple->GetNEntries());
+   for (auto entryId : *ntuple) {
+      ntuple->LoadEntry(entryId);
+      EXPECT_EQ(static_cast<float>(entryId), *rdPt);
+      ASSERT_EQ(entryId % 5, rdVector->size());
+      for (auto v : *rdVector)
+         EXPECT_EQ(static_cast<double>(entryId), v);
+      EXPECT_EQ(entryId % 256, *rdByte);
+   }
+
+   // Depending on the page alignment in the file, some pages may be copied out of the mapping
+   auto nPageMapped = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPageMapped");
+   ASSERT_NE(nullptr, nPageMapped);
+   auto nPagePopulated = ntuple->GetMetrics().GetCounter("RNTupleReader.RPageSourceFile.nPagePopulated");
+   ASSERT_NE(nullptr, nPagePopulated);
+   EXPECT_GT(nPageMapped->GetValueAsInt(), 0);
+   EXPECT_LE(nPageMapped->GetValueAsInt(), nPagePopulated->GetValueAsInt());
+}
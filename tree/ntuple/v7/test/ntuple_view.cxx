@@ -121,3 +121,113 @@ TEST(RNTuple, Composable)
    }
    EXPECT_EQ(8, nEv);
 }
+
+TEST(RNTuple, ViewBulk)
+{
+   FileRaii fileGuard("test_ntuple_view_bulk.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto fieldJets = model->MakeField<std::vector<std::int32_t>>("jets");
+
+   constexpr unsigned int nEvents = 50000;
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath());
+      for (unsigned int i = 0; i < nEvents; ++i) {
+         *fieldPt = i;
+         fieldJets->clear();
+         for (unsigned int j = 0; j < i % 4; ++j)
+            fieldJets->push_back(i + j);
+         ntuple->Fill();
+         if (i % 20000 == 0)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+   NTupleSize_t nRead = 0;
+   unsigned int nSpans = 0;
+   while (nRead < nEvents) {
+      auto values = viewPt.GetBulk(nRead, nEvents - nRead);
+      ASSERT_GT(values.size(), 0U);
+      for (auto v : values) {
+         EXPECT_EQ(static_cast<float>(nRead), v);
+         nRead++;
+      }
+      nSpans++;
+   }
+   EXPECT_EQ(nEvents, nRead);
+   EXPECT_LT(nSpans, nEvents / 100);
+   EXPECT_EQ(10U, viewPt.GetBulk(100, 10).size());
+
+   auto viewJets = ntuple->GetViewCollection("jets");
+   auto viewJetElements = viewJets.GetView<std::int32_t>("std::int32_t");
+   nRead = 0;
+   while (nRead < nEvents) {
+      RClusterIndex collectionStart;
+      auto offsets = viewJets.GetBulkOffsets(nRead, nEvents - nRead, &collectionStart);
+      ASSERT_GT(offsets.size(), 0U);
+      auto itemStart = collectionStart.GetIndex();
+      for (auto itemEnd : offsets) {
+         ASSERT_EQ(nRead % 4, itemEnd - itemStart);
+         auto index = itemStart;
+         while (index < itemEnd) {
+            auto items = viewJetElements.GetBulk(RClusterIndex(collectionStart.GetClusterId(), index), itemEnd - index);
+            for (auto item : items) {
+               EXPECT_EQ(static_cast<std::int32_t>(nRead + index - itemStart), item);
+               index++;
+            }
+         }
+         itemStart = itemEnd;
+         nRead++;
+      }
+   }
+   EXPECT_EQ(nEvents, nRead);
+}
+
+TEST(RNTuple, ViewColumnPruning)
+{
+   FileRaii fileGuard("test_ntuple_view_pruning.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto fieldEnergy = model->MakeField<float>("energy");
+
+   constexpr unsigned int nEvents = 1000;
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath());
+      for (unsigned int i = 0; i < nEvents; ++i) {
+         *fieldPt = i;
+         *fieldEnergy = 2 * i;
+         ntuple->Fill();
+         if (i % 100 == 0)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto source = std::make_unique<RPageSourceFile>("myNTuple", fileGuard.GetPath(), RNTupleReadOptions());
+   auto sourcePtr = source.get();
+   RNTupleReader ntuple(std::move(source));
+   EXPECT_TRUE(sourcePtr->GetActiveColumns().empty());
+
+   auto viewPt = ntuple.GetView<float>("pt");
+   EXPECT_EQ(1U, sourcePtr->GetActiveColumns().size());
+   {
+      // A second user of the same column must not deactivate the column when it goes out of scope
+      auto viewPtCopy = ntuple.GetView<float>("pt");
+      EXPECT_EQ(1U, sourcePtr->GetActiveColumns().size());
+      EXPECT_EQ(0.0, viewPtCopy(0));
+   }
+   EXPECT_EQ(1U, sourcePtr->GetActiveColumns().size());
+
+   for (auto i : ntuple.GetEntryRange())
+      EXPECT_EQ(static_cast<float>(i), viewPt(i));
+
+   {
+      auto viewEnergy = ntuple.GetView<float>("energy");
+      EXPECT_EQ(2U, sourcePtr->GetActiveColumns().size());
+      EXPECT_EQ(2.0, viewEnergy(1));
+   }
+   EXPECT_EQ(1U, sourcePtr->GetActiveColumns().size());
+}
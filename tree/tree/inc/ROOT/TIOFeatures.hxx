@@ -16,6 +16,7 @@
 class TBasket;
 class TBranch;
 class TTree;
+class TTreeCloner;
 
 // keep it here to have a note that was removed
 // #ifndef R__LESS_INCLUDES
@@ -51,7 +52,8 @@ namespace Experimental {
 // usage of this mechanism somehow involves baskets currently.
 enum class EIOFeatures {
    kGenerateOffsetMap = BIT(0),
-   kSupported = kGenerateOffsetMap  // Union of all features in this enum.
+   kCollectionCounts = BIT(1),
+   kSupported = kGenerateOffsetMap | kCollectionCounts  // Union of all features in this enum.
 };
 
 
@@ -70,6 +72,7 @@ class TIOFeatures {
 friend class ::TTree;
 friend class ::TBranch;
 friend class ::TBasket;
+friend class ::TTreeCloner;
 
 public:
    TIOFeatures() {}
@@ -86,7 +89,7 @@ public:
    void Print() const;
 
    // The number of known, defined IO features (supported / unsupported / experimental).
-   static constexpr int kIOFeatureCount = 1;
+   static constexpr int kIOFeatureCount = 2;
 
 private:
    // These methods allow access to the raw bitset underlying
@@ -45,6 +45,9 @@ private:
    // Helper for managing the compressed buffer.
    void InitializeCompressedBuffer(Int_t len, TFile* file);
 
+   // Helper for LoadBasketBuffers
+   char *InitializeLoadBuffer(Int_t len, TFile *file);
+
    // Handles special logic around deleting / reseting the entry offset pointer.
    void ResetEntryOffset();
 
@@ -54,6 +57,9 @@ private:
    // Returns true if the underlying TLeaf can regenerate the entry offsets for us.
    Bool_t CanGenerateOffsetArray();
 
+   // Returns true if the entry offsets are serialized as entry sizes.
+   Bool_t StoresEntrySizes() const;
+
    // Manage buffer ownership.
    void   DisownBuffer();
    void   AdoptBuffer(TBuffer *user_buffer);
@@ -95,11 +101,11 @@ public:
    // in the fIOBits -- then the zombie flag will be set for this object.
    //
    enum class EIOBits : Char_t {
-      // The following to bits are reserved for now; when supported, set
-      // kSupported = kGenerateOffsetMap | kBasketClassMap
       kGenerateOffsetMap = BIT(0),
-      // kBasketClassMap = BIT(1),
-      kSupported = kGenerateOffsetMap
+      // Top-level collections of fundamental types are stored without per-entry collection headers;
+      // the entry sizes are stored instead of the entry offsets.
+      kCollectionCounts = BIT(1),
+      kSupported = kGenerateOffsetMap | kCollectionCounts
    };
    // This enum covers IOBits that are known to this ROOT release but
    // not supported; provides a mechanism for us to have experimental
@@ -108,7 +114,7 @@ public:
    // (kUnsupported | kSupported) should result in the '|' of all IOBits.
    enum class EUnsupportedIOBits : Char_t { kUnsupported = 0 };
    // The number of known, defined IOBits.
-   static constexpr int kIOBitCount = 1;
+   static constexpr int kIOBitCount = 2;
 
    TBasket();
    TBasket(TDirectory *motherDir);
@@ -126,6 +132,7 @@ public:
               return R__likely(fEntryOffset != reinterpret_cast<Int_t *>(-1)) ? fEntryOffset : GetCalculatedEntryOffset();
            }
            Int_t   GetEntryPointer(Int_t Entry);
+           Bool_t  TestIOBit(EIOBits bit) const { return fIOBits & static_cast<UChar_t>(bit); }
            Int_t   GetNevBuf() const {return fNevBuf;}
            Int_t   GetNevBufSize() const {return fNevBufSize;}
            Int_t   GetLast() const {return fLast;}
@@ -143,6 +150,7 @@ public:
    Bool_t          GetResetAllocationCount() const { return fResetAllocation; }
 
    Int_t           LoadBasketBuffers(Long64_t pos, Int_t len, TFile *file, TTree *tree = 0);
+   Int_t           LoadBasketBuffers(const char *content, Int_t len, TFile *file);
    Long64_t        CopyTo(TFile *to);
 
            void    SetBranch(TBranch *branch) { fBranch = branch; }
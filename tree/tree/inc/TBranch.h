@@ -31,6 +31,9 @@
 #include "Compression.h"
 #include "ROOT/TIOFeatures.hxx"
 
+#include <vector>
+
+struct R__ZSTDDict;
 class TTree;
 class TBasket;
 class TBranchElement;
@@ -50,6 +53,7 @@ class TBulkBranchRead;
 }
 namespace Internal {
 class TBranchIMTHelper; ///< A helper class for managing IMT work during TTree:Fill operations.
+class TBranchCompressionTuner;
 }
 }
 
@@ -90,6 +94,7 @@ class TBranch : public TNamed , public TAttFill {
    using TIOFeatures = ROOT::TIOFeatures;
 
 protected:
+   friend class TBasket;
    friend class TTreeCache;
    friend class TTreeCloner;
    friend class TTree;
@@ -143,6 +148,7 @@ protected:
    char       *fAddress;          ///<! Address of 1st leaf (variable or object)
    TDirectory *fDirectory;        ///<! Pointer to directory where this branch buffers are stored
    TString     fFileName;         ///<  Name of file where buffers are stored ("" if in same file as Tree header)
+   std::vector<char> fCompressionDict; ///< Dictionary of the zstd compression of the baskets, if any
    TBuffer    *fEntryBuffer;      ///<! Buffer used to directly pass the content without streaming
    TBuffer    *fTransientBuffer;  ///<! Pointer to the current transient buffer.
    TList      *fBrowsables;       ///<! List of TVirtualBranchBrowsables used for Browse()
@@ -157,6 +163,11 @@ protected:
    ReadLeaves_t fReadLeaves;      ///<! Pointer to the ReadLeaves implementation to use.
    typedef void (TBranch::*FillLeaves_t)(TBuffer &b);
    FillLeaves_t fFillLeaves;      ///<! Pointer to the FillLeaves implementation to use.
+   ROOT::Internal::TBranchCompressionTuner *fCompressionTuner; ///<! Selects the compression settings, see TTree::SetAutoCompression()
+   R__ZSTDDict *fCompressionDictHandle;  ///<! Handle of fCompressionDict, once registered with zstd
+   Bool_t      fDictTrainingDone;        ///<! True once fCompressionDict was trained, or failed to be trained
+   std::vector<char>  fDictSamples;      ///<! Beginning of the baskets that fCompressionDict is trained on
+   std::vector<Int_t> fDictSampleSizes;  ///<! Sizes of the samples in fDictSamples
    void     ReadLeavesImpl(TBuffer &b);
    void     ReadLeaves0Impl(TBuffer &b);
    void     ReadLeaves1Impl(TBuffer &b);
@@ -164,6 +175,8 @@ protected:
    void     FillLeavesImpl(TBuffer &b);
 
    void     SetSkipZip(Bool_t skip = kTRUE) { fSkipZip = skip; }
+   void     TuneCompression(char *buffer, Int_t nbytes);
+   R__ZSTDDict *PrepareCompressionDict(char *buffer, Int_t nbytes);
    void     Init(const char *name, const char *leaflist, Int_t compress);
 
    TBasket *GetFreshBasket(Int_t basketnumber, TBuffer *user_buffer);
@@ -288,7 +301,7 @@ public:
 
    static  void      ResetCount();
 
-   ClassDef(TBranch, 13); // Branch descriptor
+   ClassDef(TBranch, 14); // Branch descriptor
 };
 
 //______________________________________________________________________________
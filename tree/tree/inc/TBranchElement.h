@@ -136,6 +136,7 @@ protected:
    void ReadLeavesCollectionSplitPtrMember(TBuffer& b);
    void ReadLeavesCollectionSplitVectorPtrMember(TBuffer& b);
    void ReadLeavesCollectionMember(TBuffer& b);
+   void ReadLeavesCollectionCounts(TBuffer& b);
    void ReadLeavesClones(TBuffer& b);
    void ReadLeavesClonesMember(TBuffer& b);
    void ReadLeavesCustomStreamer(TBuffer& b);
@@ -154,6 +155,7 @@ protected:
    void FillLeavesCollectionSplitPtrMember(TBuffer& b);
    void FillLeavesCollectionMember(TBuffer& b);
    void FillLeavesAssociativeCollectionMember(TBuffer& b);
+   void FillLeavesCollectionCounts(TBuffer& b);
    void FillLeavesClones(TBuffer& b);
    void FillLeavesClonesMember(TBuffer& b);
    void FillLeavesCustomStreamer(TBuffer& b);
@@ -208,6 +210,8 @@ public:
    template<typename T > T  GetTypedValue(Int_t i, Int_t len, Bool_t subarr = kFALSE) const;
    virtual void            *GetValuePointer() const;
            Int_t            GetClassVersion() { return fClassVersion; }
+           Bool_t           CanHaveCollectionCounts() const;
+           Bool_t           HasCollectionCounts() const;
            Bool_t           IsBranchFolder() const { return TestBit(kBranchFolder); }
            Bool_t           IsFolder() const;
    virtual Bool_t           IsObjectOwner() const { return TestBit(kDeleteObject); }
@@ -30,6 +30,12 @@ class TEntryList;
 class TEventList;
 class TCollection;
 
+namespace ROOT {
+namespace Internal {
+class TChainFilePrefetch;
+}
+}
+
 class TChain : public TTree {
 
 protected:
@@ -43,6 +49,10 @@ protected:
    TObjArray   *fFiles;            ///< -> List of file names containing the trees (TChainElement, owned)
    TList       *fStatus;           ///< -> List of active/inactive branches (TChainElement, owned)
    TChain      *fProofChain;       ///<! chain proxy when going to be processed by PROOF
+   Bool_t       fPrefetchNextFile{kFALSE}; ///<! If true, the file of the next tree is opened in the background
+   ROOT::Internal::TChainFilePrefetch *fNextFile{nullptr}; ///<! Background opening of the next file (owned)
+   Long64_t     fCacheEntryMin{0};                  ///<! First entry of the cache entry range, in chain entries
+   Long64_t     fCacheEntryMax{TTree::kMaxEntries}; ///<! End of the cache entry range, in chain entries
 
 private:
    TChain(const TChain&);            // not implemented
@@ -52,6 +62,7 @@ private:
 protected:
    void InvalidateCurrentTree();
    void ReleaseChainProof();
+   void ResetNextFilePrefetch();
 
 public:
    // TChain constants
@@ -153,6 +164,8 @@ public:
 #endif
 
    virtual void      SetBranchStatus(const char *bname, Bool_t status=1, UInt_t *found=0);
+   virtual void      SetCacheLearnedBranches(std::shared_ptr<ROOT::Internal::TTreeCacheLearnedBranches> learned);
+   virtual Int_t     SetCacheEntryRange(Long64_t first, Long64_t last);
    virtual Int_t     SetCacheSize(Long64_t cacheSize = -1);
    virtual void      SetDirectory(TDirectory *dir);
    virtual void      SetEntryList(TEntryList *elist, Option_t *opt="");
@@ -161,6 +174,7 @@ public:
    virtual void      SetMakeClass(Int_t make) { TTree::SetMakeClass(make); if (fTree) fTree->SetMakeClass(make);}
    virtual void      SetName(const char *name);
    virtual void      SetPacketSize(Int_t size = 100);
+   void              SetPrefetchNextFile(Bool_t prefetch = kTRUE);
    virtual void      SetProof(Bool_t on = kTRUE, Bool_t refresh = kFALSE, Bool_t gettreeheader = kFALSE);
    virtual void      SetWeight(Double_t w=1, Option_t *option="");
    virtual void      UseCache(Int_t maxCacheSize = 10, Int_t pageSize = 0);
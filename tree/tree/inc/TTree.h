@@ -50,6 +50,7 @@ class TList;
 
 #include <array>
 #include <atomic>
+#include <memory>
 #include <vector>
 #include <utility>
 
@@ -76,6 +77,12 @@ class TTreeCloner;
 class TFileMergeInfo;
 class TVirtualPerfStats;
 
+namespace ROOT {
+namespace Internal {
+class TTreeCacheLearnedBranches;
+}
+}
+
 class TTree : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
 
    using TIOFeatures = ROOT::TIOFeatures;
@@ -136,10 +143,15 @@ protected:
    Bool_t         fCacheDoAutoInit;       ///<! true if cache auto creation or resize check is needed
    Bool_t         fCacheDoClusterPrefetch;///<! true if cache is prefetching whole clusters
    Bool_t         fCacheUserSet;          ///<! true if the cache setting was explicitly given by user
+   std::shared_ptr<ROOT::Internal::TTreeCacheLearnedBranches> fCacheLearnedBranches; ///<! Branches learned by the caches of other trees, if shared
    Bool_t         fIMTEnabled;            ///<! true if implicit multi-threading is enabled for this tree
    UInt_t         fNEntriesSinceSorting;  ///<! Number of entries processed since the last re-sorting of branches
    std::vector<std::pair<Long64_t,TBranch*>> fSortedBranches; ///<! Branches to be processed in parallel when IMT is on, sorted by average task time
    std::vector<TBranch*> fSeqBranches;    ///<! Branches to be processed sequentially when IMT is on
+   Int_t          fAutoCompression{0};    ///<! Objective of the automatic selection of the branches' compression settings (see SetAutoCompression)
+   Int_t          fAutoCompressionBaskets{0}; ///<! Number of baskets per branch that the compression settings are tried on
+   Int_t          fCompressionDictBaskets{0}; ///<! Number of baskets per branch that zstd dictionaries are trained on (see SetCompressionDictionary)
+   Int_t          fCompressionDictSize{0};    ///<! Maximum size of the trained zstd dictionaries
    Float_t fTargetMemoryRatio{1.1f};      ///<! Ratio for memory usage in uncompressed buffers versus actual occupancy.  1.0
                                            /// indicates basket should be resized to exact memory usage, but causes significant
 /// memory churn.
@@ -242,6 +254,14 @@ public:
       kDecomposedObjMask = kNeedEnableDecomposedObj | kNeedDisableDecomposedObj
    };
 
+   /// Objectives of the automatic selection of the branches' compression settings, see SetAutoCompression()
+   enum EAutoCompression {
+      kAutoCompressionDisabled = 0,
+      kAutoCompressionSize = 1,      ///< Smallest file
+      kAutoCompressionReadSpeed = 2, ///< Fastest decompression
+      kAutoCompressionBalanced = 3   ///< Smallest file among the settings that decompress reasonably fast
+   };
+
    // TTree status bits
    enum EStatusBits {
       kForceRead = BIT(11),
@@ -439,13 +459,18 @@ public:
 #ifdef R__TRACK_BASKET_ALLOC_TIME
    ULong64_t               GetAllocationTime() const { return fAllocationTime; }
 #endif
+   EAutoCompression        GetAutoCompression() const { return static_cast<EAutoCompression>(fAutoCompression); }
+   Int_t                   GetAutoCompressionBaskets() const { return fAutoCompressionBaskets; }
    virtual Long64_t        GetAutoFlush() const {return fAutoFlush;}
+   Int_t                   GetCompressionDictBaskets() const { return fCompressionDictBaskets; }
+   Int_t                   GetCompressionDictSize() const { return fCompressionDictSize; }
    virtual Long64_t        GetAutoSave()  const {return fAutoSave;}
    virtual TBranch        *GetBranch(const char* name);
    virtual TBranchRef     *GetBranchRef() const { return fBranchRef; };
    virtual Bool_t          GetBranchStatus(const char* branchname) const;
    static  Int_t           GetBranchStyle();
    virtual Long64_t        GetCacheSize() const { return fCacheSize; }
+   const std::shared_ptr<ROOT::Internal::TTreeCacheLearnedBranches> &GetCacheLearnedBranches() const { return fCacheLearnedBranches; }
    virtual TClusterIterator GetClusterIterator(Long64_t firstentry);
    virtual Long64_t        GetChainEntryNumber(Long64_t entry) const { return entry; }
    virtual Long64_t        GetChainOffset() const { return fChainOffset; }
@@ -573,6 +598,7 @@ public:
    virtual void            ResetBranchAddresses();
    virtual Long64_t        Scan(const char* varexp = "", const char* selection = "", Option_t* option = "", Long64_t nentries = kMaxEntries, Long64_t firstentry = 0); // *MENU*
    virtual Bool_t          SetAlias(const char* aliasName, const char* aliasFormula);
+   virtual void            SetAutoCompression(EAutoCompression objective, Int_t nbaskets = 3);
    virtual void            SetAutoSave(Long64_t autos = -300000000);
    virtual void            SetAutoFlush(Long64_t autof = -30000000);
    virtual void            SetBasketSize(const char* bname, Int_t buffsize = 16000);
@@ -600,9 +626,11 @@ public:
    virtual Int_t           SetCacheSize(Long64_t cachesize = -1);
    virtual Int_t           SetCacheEntryRange(Long64_t first, Long64_t last);
    virtual void            SetCacheLearnEntries(Int_t n=10);
+   virtual void            SetCacheLearnedBranches(std::shared_ptr<ROOT::Internal::TTreeCacheLearnedBranches> learned);
    virtual void            SetChainOffset(Long64_t offset = 0) { fChainOffset=offset; }
    virtual void            SetCircular(Long64_t maxEntries);
    virtual void            SetClusterPrefetch(Bool_t enabled) { fCacheDoClusterPrefetch = enabled; }
+   virtual void            SetCompressionDictionary(Int_t nbaskets = 10, Int_t dictsize = 16384);
    virtual void            SetDebug(Int_t level = 1, Long64_t min = 0, Long64_t max = 9999999); // *MENU*
    virtual void            SetDefaultEntryOffsetLen(Int_t newdefault, Bool_t updateExisting = kFALSE);
    virtual void            SetDirectory(TDirectory* dir);
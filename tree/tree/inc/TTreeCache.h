@@ -23,12 +23,51 @@
 
 #include "TFileCacheRead.h"
 
+#include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 
 class TTree;
 class TBranch;
 class TObjArray;
 
+namespace ROOT {
+namespace Internal {
+/// Names of the branches learned by the learning phase of a TTreeCache, to be shared with the caches of other trees
+/// that read the same data: the trees of the next files of a chain, or the trees read by the other threads of a job.
+/// The first cache that completes its learning phase records its branches; caches that are attached afterwards
+/// start with these branches and skip the learning phase.
+class TTreeCacheLearnedBranches {
+   mutable std::mutex fMutex;
+   std::vector<std::string> fNames;
+   bool fIsSet = false;
+
+public:
+   bool IsSet() const
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      return fIsSet;
+   }
+   std::vector<std::string> GetNames() const
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      return fNames;
+   }
+   /// Records the given branch names unless another cache already did.  Returns false in the latter case.
+   bool SetNames(std::vector<std::string> names)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      if (fIsSet)
+         return false;
+      fNames = std::move(names);
+      fIsSet = true;
+      return true;
+   }
+};
+} // namespace Internal
+} // namespace ROOT
+
 class TTreeCache : public TFileCacheRead {
 
 public:
@@ -104,6 +143,8 @@ protected:
 
    std::unique_ptr<MissCache> fMissCache; ///<! Cache contents for misses
 
+   std::shared_ptr<ROOT::Internal::TTreeCacheLearnedBranches> fLearnedBranches; ///<! Branches shared with other caches
+
 private:
    TTreeCache(const TTreeCache &) = delete; ///< this class cannot be copied
    TTreeCache &operator=(const TTreeCache &) = delete;
@@ -124,6 +165,9 @@ private:
    TBranch *CalculateMissEntries(Long64_t, int, bool);    ///< Given an file read, try to determine the corresponding branch.
    Bool_t   ProcessMiss(Long64_t pos, int len); ///<! Given a file read not in the miss cache, handle (possibly) loading the data.
 
+   void PublishLearnedBranches(); ///< Record the learned branches in the shared branch set.
+   Bool_t SeedLearnedBranches();  ///< Take the branches from the shared branch set instead of learning them.
+
 public:
 
    TTreeCache();
@@ -143,6 +187,7 @@ public:
    virtual Int_t        GetEntryMin() const {return fEntryMin;}
    virtual Int_t        GetEntryMax() const {return fEntryMax;}
    static Int_t         GetLearnEntries();
+   const std::shared_ptr<ROOT::Internal::TTreeCacheLearnedBranches> &GetLearnedBranches() const { return fLearnedBranches; }
    virtual EPrefillType GetLearnPrefill() const {return fPrefillType;}
    Double_t             GetMissEfficiency() const;
    Double_t             GetMissEfficiencyRel() const;
@@ -165,6 +210,7 @@ public:
    virtual Int_t        SetBufferSize(Int_t buffersize);
    virtual void         SetEntryRange(Long64_t emin,   Long64_t emax);
    virtual void         SetFile(TFile *file, TFile::ECacheAction action=TFile::kDisconnect);
+   void                 SetLearnedBranches(std::shared_ptr<ROOT::Internal::TTreeCacheLearnedBranches> learned);
    virtual void         SetLearnPrefill(EPrefillType type = kNoPrefill);
    static void          SetLearnEntries(Int_t n = 10);
    void                 SetOptimizeMisses(Bool_t opt);
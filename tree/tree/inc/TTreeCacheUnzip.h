@@ -99,11 +99,24 @@ protected:
 
    static Double_t fgRelBuffSize; ///< This is the percentage of the TTreeCacheUnzip that will be used
 
+   // Members of the unzipping scheduler: the tasks unzip the baskets in the order in which they are expected to be
+   // read, ahead of the reads, as long as the unzipped baskets that were not read yet fit in fUnzipBufferSize
+   std::vector<Long64_t> fUnzipEntry;       ///<! [fNseek] First entry of each basket in the cache
+   std::vector<Int_t>    fUnzipOrder;       ///<! Indices of the baskets sorted by their first entry
+   std::atomic<Int_t>    fUnzipNext{0};     ///<! Position in fUnzipOrder of the next basket to be unzipped by a task
+   std::atomic<Int_t>    fUnzipActive{0};   ///<! Number of running unzipping tasks
+   std::atomic<bool>     fUnzipStop{false}; ///<! Set while the tasks are stopped, makes them drop their remaining baskets
+   std::atomic<Long64_t> fUnzipMemory{0};   ///<! Total size of the unzipped baskets that were not read yet
+   Bool_t                fUnzipScheduled{kFALSE}; ///<! True if tasks were created for the current content of the cache
+
    // Members use to keep statistics
    Int_t       fNFound;           ///<! number of blocks that were found in the cache
    Int_t       fNMissed;          ///<! number of blocks that were not found in the cache and were unzipped
    Int_t       fNStalls;          ///<! number of hits which caused a stall
-   Int_t       fNUnzip;           ///<! number of blocks that were unzipped
+   std::atomic<Int_t> fNUnzip;    ///<! number of blocks that were unzipped
+   std::atomic<Int_t> fNPaused{0};   ///<! number of times a task stopped unzipping because of the memory budget
+   Int_t       fNEvicted{0};      ///<! number of unzipped blocks dropped to make room for the blocks read next
+   std::atomic<Long64_t> fUnzipMemoryPeak{0}; ///<! maximum total size of the unzipped blocks not read yet
 
 private:
    TTreeCacheUnzip(const TTreeCacheUnzip &);            //this class cannot be copied
@@ -114,6 +127,12 @@ private:
 
    // Private methods
    void  Init();
+   void  AddUnzipMemory(Long64_t size);
+   void  CatchUpWithReader(Int_t seekidx);
+#ifdef R__USE_IMT
+   void  ResumeTasks();
+   void  StopTasks();
+#endif
 
 public:
    TTreeCacheUnzip();
@@ -152,6 +171,10 @@ public:
    Int_t  GetNUnzip() { return fNUnzip; }
    Int_t  GetNMissed(){ return fNMissed; }
    Int_t  GetNFound() { return fNFound; }
+   Int_t  GetNStalls() { return fNStalls; }
+   Int_t  GetNPaused() { return fNPaused; }
+   Int_t  GetNEvicted() { return fNEvicted; }
+   Long64_t GetUnzipMemoryPeak() { return fUnzipMemoryPeak; }
 
    void Print(Option_t* option = "") const;
 
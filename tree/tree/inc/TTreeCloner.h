@@ -25,6 +25,7 @@
 class TBranch;
 class TTree;
 class TFileCacheRead;
+class TFile;
 
 class TTreeCloner {
    TString    fWarningMsg;       ///< Text of the error message lead to an 'invalid' state
@@ -54,6 +55,7 @@ class TTreeCloner {
    Int_t           fCacheSize;   ///< Requested size of the file cache
    TFileCacheRead *fFileCache;   ///< File Cache used to reduce the number of individual reads
    TFileCacheRead *fPrevCache;   ///< Cache that set before the TTreeCloner ctor for the 'from' TTree if any.
+   TFile          *fPipelineFile; ///< Input file whose baskets are read ahead in a task (see WriteBasketsPipelined), if any.
 
    enum ECloneMethod {
       kDefault             = 0,
@@ -83,6 +85,11 @@ class TTreeCloner {
    void CreateCache();
    UInt_t FillCache(UInt_t from);
    void RestoreCache();
+   void WriteMemoryBasket(TBranch *from, TBranch *to, Int_t index);
+#ifdef R__USE_IMT
+   TFile *FindPipelineFile() const;
+   Bool_t WriteBasketsPipelined();
+#endif
 
 private:
    TTreeCloner(const TTreeCloner&) = delete;
@@ -109,11 +116,12 @@ public:
    void   CopyProcessIds();
    const char *GetWarning() const { return fWarningMsg; }
    Bool_t Exec();
+   Bool_t IsPipelined() const { return fPipelineFile != nullptr; }
    Bool_t IsValid() { return fIsValid; }
    Bool_t NeedConversion() { return fNeedConversion; }
    void   SetCacheSize(Int_t size);
    void   SortBaskets();
-   void   WriteBaskets();
+   Bool_t WriteBaskets();
 
    ClassDef(TTreeCloner,0); // helper used for the fast cloning of TTrees.
 };
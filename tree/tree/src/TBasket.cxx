@@ -25,6 +25,7 @@
 #include "TTimeStamp.h"
 #include "ROOT/TIOFeatures.hxx"
 #include "RZip.h"
+#include "ZipZSTD.h"
 
 #include <bitset>
 
@@ -224,6 +225,20 @@ Bool_t TBasket::CanGenerateOffsetArray()
    return leaf->CanGenerateOffsetArray();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true if the entry offset array is serialized as an array of entry sizes.
+///
+/// This is the case for baskets of branches that cannot generate their offset array if
+/// either the offset map or the collection counts IO feature is set.  With the collection
+/// counts feature, the entry sizes of a top-level collection of fundamental types are the
+/// only place where its element counts are stored.
+
+Bool_t TBasket::StoresEntrySizes() const
+{
+   return fIOBits & (static_cast<UChar_t>(TBasket::EIOBits::kGenerateOffsetMap) |
+                     static_cast<UChar_t>(TBasket::EIOBits::kCollectionCounts));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Get pointer to buffer for internal entry.
 
@@ -238,11 +253,10 @@ Int_t TBasket::GetEntryPointer(Int_t entry)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Load basket buffers in memory without unziping.
-/// This function is called by TTreeCloner.
-/// The function returns 0 in case of success, 1 in case of error.
+/// Prepare fBufferRef to hold the `len` bytes of a basket of `file`, and
+/// return its data buffer.
 
-Int_t TBasket::LoadBasketBuffers(Long64_t pos, Int_t len, TFile *file, TTree *tree)
+char *TBasket::InitializeLoadBuffer(Int_t len, TFile *file)
 {
    if (fBufferRef) {
       // Reuse the buffer if it exist.
@@ -259,7 +273,17 @@ Int_t TBasket::LoadBasketBuffers(Long64_t pos, Int_t len, TFile *file, TTree *tr
       fBufferRef = new TBufferFile(TBuffer::kRead, len);
    }
    fBufferRef->SetParent(file);
-   char *buffer = fBufferRef->Buffer();
+   return fBufferRef->Buffer();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Load basket buffers in memory without unziping.
+/// This function is called by TTreeCloner.
+/// The function returns 0 in case of success, 1 in case of error.
+
+Int_t TBasket::LoadBasketBuffers(Long64_t pos, Int_t len, TFile *file, TTree *tree)
+{
+   char *buffer = InitializeLoadBuffer(len, file);
    file->Seek(pos);
    TFileCacheRead *pf = tree->GetReadCache(file);
    if (pf) {
@@ -303,6 +327,24 @@ Int_t TBasket::LoadBasketBuffers(Long64_t pos, Int_t len, TFile *file, TTree *tr
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Load basket buffers in memory without unziping, from a copy of the `len`
+/// bytes of the basket that was already read from `file`.
+/// This function is called by TTreeCloner when it reads the baskets ahead.
+/// The function returns 0 in case of success.
+
+Int_t TBasket::LoadBasketBuffers(const char *content, Int_t len, TFile *file)
+{
+   char *buffer = InitializeLoadBuffer(len, file);
+   memcpy(buffer, content, len);
+
+   fBufferRef->SetReadMode();
+   fBufferRef->SetBufferOffset(0);
+   Streamer(*fBufferRef);
+
+   return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Remove the first dentries of this basket, moving entries at
 /// dentries to the start of the buffer.
@@ -666,7 +708,7 @@ AfterBuffer:
       Warning("ReadBasketBuffers","basket:%s has fNevBuf=%d but fEntryOffset=0, pos=%lld, len=%d, fNbytes=%d, fObjlen=%d, trying to repair",GetName(),fNevBuf,pos,len,fNbytes,fObjlen);
       return 0;
    }
-   if (fIOBits & static_cast<UChar_t>(TBasket::EIOBits::kGenerateOffsetMap)) {
+   if (StoresEntrySizes()) {
       // In this case, we cannot regenerate the offset array at runtime -- but we wrote out an array of
       // sizes instead of offsets (as sizes compress much better).
       fEntryOffset[0] = fKeylen;
@@ -1175,11 +1217,13 @@ Int_t TBasket::WriteBuffer()
    Int_t *entryOffset = GetEntryOffset();
    if (entryOffset) {
       Bool_t hasOffsetBit = fIOBits & static_cast<UChar_t>(TBasket::EIOBits::kGenerateOffsetMap);
+      Bool_t hasSizes = StoresEntrySizes();
       if (!CanGenerateOffsetArray()) {
          // If we have set the offset map flag, but cannot dynamically generate the map, then
          // we should at least convert the offset array to a size array.  Note that we always
          // write out (fNevBuf+1) entries to match the original case.
-         if (hasOffsetBit) {
+         if (hasSizes) {
+            entryOffset[fNevBuf] = fLast;
             for (Int_t idx = fNevBuf; idx > 0; idx--) {
                entryOffset[idx] -= entryOffset[idx - 1];
             }
@@ -1188,7 +1232,7 @@ Int_t TBasket::WriteBuffer()
          fBufferRef->WriteArray(entryOffset, fNevBuf + 1);
          // Convert back to offset format: keeping both sizes and offsets in-memory were considered,
          // but it seems better to use CPU than memory.
-         if (hasOffsetBit) {
+         if (hasSizes) {
             entryOffset[0] = fKeylen;
             for (Int_t idx = 1; idx < fNevBuf + 1; idx++) {
                entryOffset[idx] += entryOffset[idx - 1];
@@ -1210,6 +1254,15 @@ Int_t TBasket::WriteBuffer()
 
    fHeaderOnly = kTRUE;
    fCycle = fBranch->GetWriteBasket();
+   // Trying the candidate compression settings and training the compression dictionary only need the basket's buffer
+#ifdef R__USE_IMT
+   sentry.unlock();
+#endif  // R__USE_IMT
+   fBranch->TuneCompression(fBufferRef->Buffer() + fKeylen, fObjlen);
+   R__ZSTDDict *dict = fBranch->PrepareCompressionDict(fBufferRef->Buffer() + fKeylen, fObjlen);
+#ifdef R__USE_IMT
+   sentry.lock();
+#endif  // R__USE_IMT
    Int_t cxlevel = fBranch->GetCompressionLevel();
    ROOT::RCompressionSetting::EAlgorithm::EValues cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(fBranch->GetCompressionAlgorithm());
    if (cxlevel > 0) {
@@ -1238,7 +1291,10 @@ Int_t TBasket::WriteBuffer()
          // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
          // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
          // (see fCompressedBufferRef in constructor).
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
+         if (dict)
+            R__zipZSTDDict(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, dict);
+         else
+            R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
 #ifdef R__USE_IMT
          sentry.lock();
 #endif  // R__USE_IMT
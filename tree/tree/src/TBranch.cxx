@@ -48,6 +48,8 @@
 #include "strlcpy.h"
 #include "snprintf.h"
 
+#include "TBranchCompressionTuner.h"
+#include "ZipZSTD.h"
 #include "TBranchIMTHelper.h"
 
 #include "ROOT/TIOFeatures.hxx"
@@ -125,6 +127,9 @@ TBranch::TBranch()
 , fSkipZip(kFALSE)
 , fReadLeaves(&TBranch::ReadLeavesImpl)
 , fFillLeaves(&TBranch::FillLeavesImpl)
+, fCompressionTuner(nullptr)
+, fCompressionDictHandle(nullptr)
+, fDictTrainingDone(kFALSE)
 {
    SetBit(TBranch::kDoNotUseBufferMap);
 }
@@ -236,6 +241,9 @@ TBranch::TBranch(TTree *tree, const char *name, void *address, const char *leafl
 , fSkipZip(kFALSE)
 , fReadLeaves(&TBranch::ReadLeavesImpl)
 , fFillLeaves(&TBranch::FillLeavesImpl)
+, fCompressionTuner(nullptr)
+, fCompressionDictHandle(nullptr)
+, fDictTrainingDone(kFALSE)
 {
    Init(name,leaflist,compress);
 }
@@ -290,6 +298,9 @@ TBranch::TBranch(TBranch *parent, const char *name, void *address, const char *l
 , fSkipZip(kFALSE)
 , fReadLeaves(&TBranch::ReadLeavesImpl)
 , fFillLeaves(&TBranch::FillLeavesImpl)
+, fCompressionTuner(nullptr)
+, fCompressionDictHandle(nullptr)
+, fDictTrainingDone(kFALSE)
 {
    Init(name,leaflist,compress);
 }
@@ -444,6 +455,12 @@ TBranch::~TBranch()
    delete fBrowsables;
    fBrowsables = 0;
 
+   delete fCompressionTuner;
+   fCompressionTuner = nullptr;
+
+   R__releaseZSTDDict(fCompressionDictHandle);
+   fCompressionDictHandle = nullptr;
+
    // Note: We do *not* have ownership of the buffer.
    fEntryBuffer = 0;
 
@@ -2653,6 +2670,68 @@ void TBranch::SetCompressionSettings(Int_t settings)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Try the candidate compression settings on the uncompressed content of a
+/// basket, if the tree selects the compression settings of its branches (see
+/// TTree::SetAutoCompression).  Once enough baskets were tried, the best
+/// candidate becomes the compression setting of this branch.  Unlike
+/// SetCompressionSettings(), the sub-branches keep their own settings.
+
+void TBranch::TuneCompression(char *buffer, Int_t nbytes)
+{
+   if (!fTree || fTree->GetAutoCompression() == TTree::kAutoCompressionDisabled || GetCompressionLevel() <= 0)
+      return;
+   if (!fCompressionTuner) {
+      fCompressionTuner = new ROOT::Internal::TBranchCompressionTuner(
+         fTree->GetAutoCompression(), fTree->GetAutoCompressionBaskets(), fCompress);
+   }
+   if (!fCompressionTuner->IsDone() && fCompressionTuner->AddBasket(buffer, nbytes))
+      fCompress = fCompressionTuner->GetBestSettings();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the dictionary to compress a basket of this branch with, or nullptr
+/// if the basket is compressed without a dictionary.
+///
+/// Dictionaries are only used with the zstd compression.  If the tree trains
+/// dictionaries (see TTree::SetCompressionDictionary), the beginning of the
+/// first baskets is collected as samples and the dictionary is trained on them.
+/// These baskets themselves are compressed without the dictionary.
+
+R__ZSTDDict *TBranch::PrepareCompressionDict(char *buffer, Int_t nbytes)
+{
+   // Dictionaries pay off for small buffers; the beginning of a large basket is a sufficient sample
+   const Int_t kMaxDictSample = 32 * 1024;
+
+   if (GetCompressionAlgorithm() != ROOT::RCompressionSetting::EAlgorithm::kZSTD || GetCompressionLevel() <= 0)
+      return nullptr;
+   if (!fCompressionDict.empty() || fDictTrainingDone)
+      return fCompressionDictHandle;
+   const Int_t nbaskets = fTree ? fTree->GetCompressionDictBaskets() : 0;
+   if (nbaskets <= 0 || nbytes <= 0)
+      return nullptr;
+
+   const Int_t nsample = std::min(nbytes, kMaxDictSample);
+   fDictSamples.insert(fDictSamples.end(), buffer, buffer + nsample);
+   fDictSampleSizes.push_back(nsample);
+   if ((Int_t)fDictSampleSizes.size() < nbaskets)
+      return nullptr;
+
+   fDictTrainingDone = kTRUE;
+   std::vector<char> dict(fTree->GetCompressionDictSize());
+   Int_t dictsize = R__trainZSTDDict(dict.data(), dict.size(), fDictSamples.data(), fDictSampleSizes.data(),
+                                     fDictSampleSizes.size());
+   fDictSamples = std::vector<char>();
+   fDictSampleSizes = std::vector<Int_t>();
+   if (dictsize <= 0)
+      return nullptr;
+   dict.resize(dictsize);
+   fCompressionDictHandle = R__addZSTDDict(dict.data(), dictsize);
+   if (fCompressionDictHandle)
+      fCompressionDict.swap(dict);
+   return fCompressionDictHandle;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Update the default value for the branch's fEntryOffsetLen if and only if
 /// it was already non zero (and the new value is not zero)
@@ -2839,6 +2918,11 @@ void TBranch::Streamer(TBuffer& b)
 
          }
          if (!fSplitLevel && fBranches.GetEntriesFast()) fSplitLevel = 1;
+         // The baskets can only be decompressed once their dictionary is known to zstd
+         R__releaseZSTDDict(fCompressionDictHandle);
+         fCompressionDictHandle = nullptr;
+         if (!fCompressionDict.empty())
+            fCompressionDictHandle = R__addZSTDDict(fCompressionDict.data(), fCompressionDict.size());
          gROOT->SetReadingObject(kFALSE);
          if (IsA() == TBranch::Class()) {
             if (fNleaves == 0) {
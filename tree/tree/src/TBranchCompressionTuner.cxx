@@ -0,0 +1,116 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TBranchCompressionTuner.h"
+
+#include "Compression.h"
+#include "RZip.h"
+#include "TTree.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace {
+/// A fast, a medium and a strong setting of the algorithms that are available in every build
+constexpr Int_t kCandidateSettings[] = {404, 501, 505, 101, 106};
+} // anonymous namespace
+
+ROOT::Internal::TBranchCompressionTuner::TBranchCompressionTuner(Int_t objective, Int_t ntrials, Int_t settings)
+   : fObjective(objective), fNTrials(ntrials)
+{
+   for (auto candidate : kCandidateSettings)
+      fCandidates.push_back({candidate});
+   if (std::find(std::begin(kCandidateSettings), std::end(kCandidateSettings), settings) ==
+       std::end(kCandidateSettings))
+      fCandidates.push_back({settings});
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compresses the basket with the settings of the candidate, chunk by chunk as TBasket::WriteBuffer() does, and
+/// measures the time it takes to decompress it again.  Chunks that do not shrink are stored as they are.
+
+void ROOT::Internal::TBranchCompressionTuner::Try(TCandidate &candidate, char *buffer, Int_t nbytes)
+{
+   const auto cxlevel = candidate.fSettings % 100;
+   const auto cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(candidate.fSettings / 100);
+
+   Long64_t zipBytes = 0;
+   std::chrono::steady_clock::duration unzipTime{0};
+   for (Int_t nzip = 0; nzip < nbytes; nzip += kMAXZIPBUF) {
+      Int_t bufmax = std::min(nbytes - nzip, Int_t(kMAXZIPBUF));
+      Int_t tgtsize = fZipBuffer.size();
+      Int_t nout = 0;
+      R__zipMultipleAlgorithm(cxlevel, &bufmax, buffer + nzip, &tgtsize, fZipBuffer.data(), &nout, cxAlgorithm);
+      if (nout == 0 || nout >= bufmax) {
+         zipBytes += bufmax;
+         continue;
+      }
+      zipBytes += nout;
+
+      Int_t unzipSize = bufmax;
+      Int_t irep = 0;
+      const auto start = std::chrono::steady_clock::now();
+      R__unzip(&nout, reinterpret_cast<unsigned char *>(fZipBuffer.data()), &unzipSize,
+               reinterpret_cast<unsigned char *>(fUnzipBuffer.data()), &irep);
+      unzipTime += std::chrono::steady_clock::now() - start;
+   }
+
+   candidate.fZipBytes += zipBytes;
+   candidate.fUnzipTime += std::chrono::duration<Double_t>(unzipTime).count();
+}
+
+Bool_t ROOT::Internal::TBranchCompressionTuner::AddBasket(char *buffer, Int_t nbytes)
+{
+   if (IsDone())
+      return kTRUE;
+   if (nbytes > 0) {
+      const auto chunkSize = std::min(nbytes, Int_t(kMAXZIPBUF));
+      // Room for the compression header, as in TBasket::WriteBuffer()
+      fZipBuffer.resize(std::max(fZipBuffer.size(), std::size_t(chunkSize + 9 + 28)));
+      fUnzipBuffer.resize(std::max(fUnzipBuffer.size(), std::size_t(chunkSize)));
+      for (auto &candidate : fCandidates)
+         Try(candidate, buffer, nbytes);
+   }
+   ++fNTried;
+   if (IsDone()) {
+      fZipBuffer = std::vector<char>();
+      fUnzipBuffer = std::vector<char>();
+   }
+   return IsDone();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// For the smallest size, the candidate with the fewest compressed bytes is chosen; for the fastest reading, the
+/// candidate that decompresses fastest.  The balanced objective chooses the smallest candidate among those that
+/// decompress at most twice as slow as the fastest one.
+
+Int_t ROOT::Internal::TBranchCompressionTuner::GetBestSettings() const
+{
+   auto smaller = [](const TCandidate &a, const TCandidate &b) {
+      return a.fZipBytes < b.fZipBytes || (a.fZipBytes == b.fZipBytes && a.fUnzipTime < b.fUnzipTime);
+   };
+   auto faster = [](const TCandidate &a, const TCandidate &b) { return a.fUnzipTime < b.fUnzipTime; };
+
+   switch (fObjective) {
+   case TTree::kAutoCompressionSize:
+      return std::min_element(fCandidates.begin(), fCandidates.end(), smaller)->fSettings;
+   case TTree::kAutoCompressionReadSpeed:
+      return std::min_element(fCandidates.begin(), fCandidates.end(), faster)->fSettings;
+   default: {
+      const auto maxTime = 2 * std::min_element(fCandidates.begin(), fCandidates.end(), faster)->fUnzipTime;
+      const TCandidate *best = nullptr;
+      for (const auto &candidate : fCandidates) {
+         if (candidate.fUnzipTime <= maxTime && (!best || smaller(candidate, *best)))
+            best = &candidate;
+      }
+      return best->fSettings;
+   }
+   }
+}
@@ -0,0 +1,56 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TBranchCompressionTuner
+#define ROOT_TBranchCompressionTuner
+
+#include "RtypesCore.h"
+
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+
+/// Selects the compression settings of a branch from the content of its first baskets, see
+/// TTree::SetAutoCompression().  Each trial basket is compressed with every candidate setting; the compressed size
+/// and the time to decompress it again are summed up per candidate.  Once enough baskets were tried, the candidate
+/// that best fits the objective of the tree is chosen.
+class TBranchCompressionTuner {
+   /// The measurements of a candidate compression setting
+   struct TCandidate {
+      Int_t fSettings;          ///< Compression algorithm and level, as in TBranch::SetCompressionSettings()
+      Long64_t fZipBytes = 0;   ///< Total compressed size of the trial baskets
+      Double_t fUnzipTime = 0.; ///< Total time in seconds to decompress the trial baskets
+   };
+
+   Int_t fObjective;                   ///< One of TTree::EAutoCompression
+   Int_t fNTrials;                     ///< Number of baskets to try the candidates on
+   Int_t fNTried = 0;                  ///< Number of baskets tried so far
+   std::vector<TCandidate> fCandidates;
+   std::vector<char> fZipBuffer;       ///< Scratch buffer for the compressed basket
+   std::vector<char> fUnzipBuffer;     ///< Scratch buffer for the decompressed basket
+
+   void Try(TCandidate &candidate, char *buffer, Int_t nbytes);
+
+public:
+   /// The current settings of the branch are always among the candidates.
+   TBranchCompressionTuner(Int_t objective, Int_t ntrials, Int_t settings);
+
+   /// Tries the candidates on an uncompressed basket.  Returns true once the tuning is complete.
+   Bool_t AddBasket(char *buffer, Int_t nbytes);
+   /// The settings that best fit the objective; only meaningful once the tuning is complete.
+   Int_t GetBestSettings() const;
+   Bool_t IsDone() const { return fNTried >= fNTrials; }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -75,6 +75,49 @@ namespace {
          if (fOnfileObject) fBuffer.PopDataCache();
       }
    };
+
+   // -- Fundamental types of the collections that can be stored with the collection counts layout.
+   Bool_t IsCollectionCountsType(Int_t type) {
+      switch (type) {
+         case kChar_t: case kUChar_t: case kShort_t: case kUShort_t: case kInt_t: case kUInt_t:
+         case kLong64_t: case kULong64_t: case kFloat_t: case kDouble_t:
+            return kTRUE;
+         default:
+            return kFALSE;
+      }
+   }
+
+   // -- Write n contiguous values of the given fundamental type, without any header.
+   void WriteFundamentalArray(TBuffer &b, Int_t type, const void *values, Int_t n) {
+      switch (type) {
+         case kChar_t:    b.WriteFastArray(static_cast<const Char_t*>(values), n); break;
+         case kUChar_t:   b.WriteFastArray(static_cast<const UChar_t*>(values), n); break;
+         case kShort_t:   b.WriteFastArray(static_cast<const Short_t*>(values), n); break;
+         case kUShort_t:  b.WriteFastArray(static_cast<const UShort_t*>(values), n); break;
+         case kInt_t:     b.WriteFastArray(static_cast<const Int_t*>(values), n); break;
+         case kUInt_t:    b.WriteFastArray(static_cast<const UInt_t*>(values), n); break;
+         case kLong64_t:  b.WriteFastArray(static_cast<const Long64_t*>(values), n); break;
+         case kULong64_t: b.WriteFastArray(static_cast<const ULong64_t*>(values), n); break;
+         case kFloat_t:   b.WriteFastArray(static_cast<const Float_t*>(values), n); break;
+         case kDouble_t:  b.WriteFastArray(static_cast<const Double_t*>(values), n); break;
+      }
+   }
+
+   // -- Read n contiguous values of the given fundamental type, written by WriteFundamentalArray().
+   void ReadFundamentalArray(TBuffer &b, Int_t type, void *values, Int_t n) {
+      switch (type) {
+         case kChar_t:    b.ReadFastArray(static_cast<Char_t*>(values), n); break;
+         case kUChar_t:   b.ReadFastArray(static_cast<UChar_t*>(values), n); break;
+         case kShort_t:   b.ReadFastArray(static_cast<Short_t*>(values), n); break;
+         case kUShort_t:  b.ReadFastArray(static_cast<UShort_t*>(values), n); break;
+         case kInt_t:     b.ReadFastArray(static_cast<Int_t*>(values), n); break;
+         case kUInt_t:    b.ReadFastArray(static_cast<UInt_t*>(values), n); break;
+         case kLong64_t:  b.ReadFastArray(static_cast<Long64_t*>(values), n); break;
+         case kULong64_t: b.ReadFastArray(static_cast<ULong64_t*>(values), n); break;
+         case kFloat_t:   b.ReadFastArray(static_cast<Float_t*>(values), n); break;
+         case kDouble_t:  b.ReadFastArray(static_cast<Double_t*>(values), n); break;
+      }
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -828,6 +871,10 @@ TBranchElement::TBranchElement(TTree *tree, const char* bname, TVirtualCollectio
 , fWriteIterators(0)
 , fPtrIterators(0)
 {
+   if (tree) {
+      ROOT::TIOFeatures features = tree->GetIOFeatures();
+      SetIOFeatures(features);
+   }
    Init(tree, 0, bname, cont, basketsize, splitlevel, compress);
 }
 
@@ -854,6 +901,10 @@ TBranchElement::TBranchElement(TBranch *parent, const char* bname, TVirtualColle
 , fWriteIterators(0)
 , fPtrIterators(0)
 {
+   if (parent) {
+      ROOT::TIOFeatures features = parent->GetIOFeatures();
+      SetIOFeatures(features);
+   }
    Init(parent ? parent->GetTree() : 0, parent, bname, cont, basketsize, splitlevel, compress);
 }
 
@@ -1752,6 +1803,33 @@ void TBranchElement::FillLeavesMember(TBuffer& b)
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Write leaves into i/o buffers for this branch.
+/// For a top-level std::vector of a fundamental type stored with the collection counts layout.
+///
+/// Only the elements are written; the number of elements follows from the size of the entry
+/// in the basket.
+
+void TBranchElement::FillLeavesCollectionCounts(TBuffer& b)
+{
+   ValidateAddress();
+
+   //
+   // Silently do nothing if we have no user i/o buffer.
+   //
+
+   if (!fObject) {
+      return;
+   }
+
+   TVirtualCollectionProxy* proxy = GetCollectionProxy();
+   TVirtualCollectionProxy::TPushPop helper(proxy, fObject);
+   Int_t n = proxy->Size();
+   if (n > 0) {
+      WriteFundamentalArray(b, proxy->GetType(), proxy->At(0), n);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Remove trailing dimensions and make sure
 /// there is a trailing dot.
@@ -3668,6 +3746,41 @@ void TBranchElement::InitializeOffsets()
    fInitOffsets = kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if this branch is a top-level std::vector of a fundamental type, whose
+/// baskets may use the collection counts layout, kFALSE otherwise.
+///
+/// Whether a given basket uses the layout is recorded in the basket itself, see
+/// TBasket::EIOBits::kCollectionCounts.  A tree merged from inputs with different IO
+/// features can thus hold baskets of either layout in the same branch.
+
+Bool_t TBranchElement::CanHaveCollectionCounts() const
+{
+   if (fType != 0 || fID != -1) {
+      return kFALSE;
+   }
+   TClass *cl = fBranchClass.GetClass();
+   TVirtualCollectionProxy *proxy = cl ? cl->GetCollectionProxy() : nullptr;
+   return proxy && TMath::Abs(proxy->GetCollectionType()) == ROOT::kSTLvector && !proxy->GetValueClass() &&
+          IsCollectionCountsType(proxy->GetType());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if this branch writes a top-level std::vector of a fundamental type
+/// with the collection counts layout, kFALSE otherwise.
+///
+/// The layout is used if the branch was created with the IO feature
+/// ROOT::Experimental::EIOFeatures::kCollectionCounts.  Each entry then consists of
+/// the collection elements only, without the byte count, version and size that
+/// precede a streamed collection.  The number of elements of an entry is given by the
+/// entry size that the basket stores instead of the entry offset.  A basket of such a
+/// branch thus holds the elements of all its entries as one contiguous array.
+
+Bool_t TBranchElement::HasCollectionCounts() const
+{
+   return fIOFeatures.Test(ROOT::Experimental::EIOFeatures::kCollectionCounts) && CanHaveCollectionCounts();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return kTRUE if more than one leaf, kFALSE otherwise.
 
@@ -4483,6 +4596,49 @@ void TBranchElement::ReadLeavesMember(TBuffer& b)
    b.ApplySequence(*fReadActionSequence, fObject);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read leaves into i/o buffers for this branch.
+/// For a top-level std::vector of a fundamental type whose baskets may be stored with the
+/// collection counts layout.  The layout is decoded according to the current basket.
+
+void TBranchElement::ReadLeavesCollectionCounts(TBuffer& b)
+{
+   TBasket *basket = fCurrentBasket;
+   if (!basket || !basket->TestIOBit(TBasket::EIOBits::kCollectionCounts)) {
+      ReadLeavesMember(b);
+      return;
+   }
+
+   ValidateAddress();
+   if (fObject == 0) {
+      return;
+   }
+   if (fTargetClass.GetClass() != fBranchClass.GetClass()) {
+      Error("ReadLeaves", "Branch %s of type %s was written with the collection counts layout and cannot be read as %s",
+            GetName(), fClassName.Data(), fTargetClass.GetClassName());
+      return;
+   }
+
+   // The entry consists of the elements only; its end is the start of the next entry or,
+   // for the last entry of the basket, the end of the basket's data.
+   Int_t *entryOffset = basket->GetEntryOffset();
+   if (!entryOffset) {
+      Error("ReadLeaves", "Branch %s has no entry offsets to read its collection counts", GetName());
+      return;
+   }
+   Int_t entryInBasket = fReadEntry - fFirstBasketEntry;
+   Int_t entryEnd = (entryInBasket + 1 < basket->GetNevBuf()) ? entryOffset[entryInBasket + 1] : basket->GetLast();
+
+   TVirtualCollectionProxy* proxy = GetCollectionProxy();
+   TVirtualCollectionProxy::TPushPop helper(proxy, fObject);
+   Int_t n = (entryEnd - b.Length()) / proxy->GetIncrement();
+   fNdata = n;
+   proxy->Allocate(n, kTRUE);
+   if (n > 0) {
+      ReadFundamentalArray(b, proxy->GetType(), proxy->At(0), n);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read leaves into i/o buffers for this branch.
 /// For split-class branch, base class branch, data member branch, or top-level branch.
@@ -5646,6 +5802,9 @@ void TBranchElement::SetReadLeavesPtr()
       fReadLeaves = (ReadLeaves_t)&TBranchElement::ReadLeavesClonesMember;
    } else if (fType < 0) {
       fReadLeaves = (ReadLeaves_t)&TBranchElement::ReadLeavesCustomStreamer;
+   } else if (CanHaveCollectionCounts()) {
+      // The layout is chosen per basket, see ReadLeavesCollectionCounts().
+      fReadLeaves = (ReadLeaves_t)&TBranchElement::ReadLeavesCollectionCounts;
    } else if (fType == 0 && fID == -1) {
       // top-level branch.
       Bool_t hasCustomStreamer = fBranchClass.GetClass() && !fBranchClass.GetClass()->GetCollectionProxy() && (fBranchClass.GetClass()->GetStreamer() != 0 || fBranchClass.GetClass()->TestBit(TClass::kHasCustomStreamerMember));
@@ -5748,6 +5907,8 @@ void TBranchElement::SetFillLeavesPtr()
       fFillLeaves = (FillLeaves_t)&TBranchElement::FillLeavesClonesMember;
    } else if (fType < 0) {
       fFillLeaves = (FillLeaves_t)&TBranchElement::FillLeavesCustomStreamer;
+   } else if (HasCollectionCounts()) {
+      fFillLeaves = (FillLeaves_t)&TBranchElement::FillLeavesCollectionCounts;
    } else if (fType <=2) {
       //split-class branch, base class branch, data member branch, or top-level branch.
       if (fBranchCount) {
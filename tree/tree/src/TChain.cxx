@@ -33,6 +33,7 @@ the trees in the chain.
 #include "TBrowser.h"
 #include "TBuffer.h"
 #include "TChainElement.h"
+#include "TChainFilePrefetch.h"
 #include "TClass.h"
 #include "TColor.h"
 #include "TCut.h"
@@ -188,6 +189,7 @@ TChain::~TChain()
       gROOT->GetListOfCleanups()->Remove(this);
    }
 
+   ResetNextFilePrefetch();
    SafeDelete(fProofChain);
    fStatus->Delete();
    delete fStatus;
@@ -1475,7 +1477,13 @@ Long64_t TChain::LoadTree(Long64_t entry)
 
    // FIXME: We leak memory here, we've just lost the open file
    //        if we did not delete it above.
-   {
+   fFile = 0;
+   if (fNextFile && fNextFile->GetTreeNumber() == treenum) {
+      // The file was opened in the background while the previous tree was processed
+      fFile = fNextFile->TakeFile();
+   }
+   ResetNextFilePrefetch();
+   if (!fFile) {
       TDirectory::TContext ctxt;
       fFile = TFile::Open(element->GetTitle());
       if (fFile) fFile->SetBit(kMustCleanup);
@@ -1510,9 +1518,24 @@ Long64_t TChain::LoadTree(Long64_t entry)
    // FIXME: We may set fDirectory to zero here!
    fDirectory = fFile;
 
+   // The caches of all the trees of the chain share the branches learned by the first one.
+   if (fTree) {
+      if (!fCacheLearnedBranches)
+         fCacheLearnedBranches = std::make_shared<ROOT::Internal::TTreeCacheLearnedBranches>();
+      fTree->SetCacheLearnedBranches(fCacheLearnedBranches);
+   }
+
    // Reuse cache from previous file (if any).
+   TTreeCache *prefetchedCache = fTree && fFile ? fTree->GetReadCache(fFile) : nullptr;
    if (tpf) {
-      if (fFile) {
+      if (prefetchedCache) {
+         // The first cluster of the tree was pre-read by the background opening
+         // of the file, keep the cache that holds it.
+         prefetchedCache->SetAutoCreated(tpf->IsAutoCreated());
+         prefetchedCache->SetOptimizeMisses(tpf->GetOptimizeMisses());
+         delete tpf;
+         tpf = 0;
+      } else if (fFile) {
          // FIXME: fTree may be zero here.
          tpf->UpdateBranches(fTree);
          tpf->ResetCache();
@@ -1530,6 +1553,18 @@ Long64_t TChain::LoadTree(Long64_t entry)
       }
    }
 
+   // Start opening the file of the next tree while this one is processed.
+   if (fPrefetchNextFile && fTree && fFile && (treenum + 1 < fNtrees)) {
+      TChainElement *next = (TChainElement *)fFiles->At(treenum + 1);
+      TTreeCache *cache = fTree->GetReadCache(fFile);
+      Long64_t cacheSize = cache ? cache->GetBufferSize() : (fCacheUserSet ? fCacheSize : 0);
+      // The cache entry range of the chain, in entries of the next tree
+      Long64_t nextOffset = fTreeOffset[treenum] + fTree->GetEntries();
+      fNextFile = new ROOT::Internal::TChainFilePrefetch(treenum + 1, next->GetTitle(), next->GetName(), cacheSize,
+                                                         fCacheLearnedBranches, fCacheEntryMin - nextOffset,
+                                                         fCacheEntryMax - nextOffset);
+   }
+
    // Check if fTreeOffset has really been set.
    Long64_t nentries = 0;
    if (fTree) {
@@ -2284,6 +2319,7 @@ void TChain::RemoveFriend(TTree* oldFriend)
 
 void TChain::Reset(Option_t*)
 {
+   ResetNextFilePrefetch();
    delete fFile;
    fFile = 0;
    fNtrees         = 0;
@@ -2306,6 +2342,7 @@ void TChain::Reset(Option_t*)
 
 void TChain::ResetAfterMerge(TFileMergeInfo *info)
 {
+   ResetNextFilePrefetch();
    fNtrees         = 0;
    fTreeNumber     = -1;
    fTree           = 0;
@@ -2414,6 +2451,19 @@ void TChain::SetAutoDelete(Bool_t autodelete)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the range of entries read by the cache of the current tree, see
+/// TTree::SetCacheEntryRange. The range, in chain entries, is remembered: the
+/// cache of the next tree, when its file is opened in the background, only
+/// pre-reads the entries of that tree that are in the range.
+
+Int_t TChain::SetCacheEntryRange(Long64_t first, Long64_t last)
+{
+   fCacheEntryMin = first;
+   fCacheEntryMax = last;
+   return TTree::SetCacheEntryRange(first, last);
+}
+
 Int_t TChain::SetCacheSize(Long64_t cacheSize)
 {
    // Set the cache size of the underlying TTree,
@@ -2436,6 +2486,56 @@ Int_t TChain::SetCacheSize(Long64_t cacheSize)
    return res;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable the background opening of the next file of the chain.
+/// When enabled, the file of the next tree is opened in a separate thread as
+/// soon as the chain moves to a new tree. Once the branches to be cached are
+/// known, i.e. after the learning phase of the TTreeCache on the first tree,
+/// the baskets of the first cluster of the next tree in the cache entry range
+/// of the chain, see SetCacheEntryRange, are read as well. This
+/// hides the latency of opening a file and filling the cache for the first
+/// time, which is significant on remote storage, behind the processing of the
+/// current tree.
+/// The prefetching requires the thread safety of ROOT: the caller must invoke
+/// ROOT::EnableThreadSafety() beforehand, otherwise the prefetching is not enabled
+/// and a warning is issued.
+
+void TChain::SetPrefetchNextFile(Bool_t prefetch)
+{
+   if (prefetch && !gGlobalMutex) {
+      Warning("SetPrefetchNextFile",
+              "The thread safety of ROOT is not enabled, call ROOT::EnableThreadSafety() first; "
+              "the next file will not be prefetched.");
+      return;
+   }
+   if (!prefetch)
+      ResetNextFilePrefetch();
+   fPrefetchNextFile = prefetch;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Discard the background opening of the next file, if any. The file is
+/// closed if it was opened already.
+
+void TChain::ResetNextFilePrefetch()
+{
+   delete fNextFile;
+   fNextFile = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Share the branches learned by the TTreeCache of this chain with the caches
+/// of other trees or chains, see TTree::SetCacheLearnedBranches.
+/// By default, the trees of a chain share the branches learned on its first
+/// tree among each other only.
+
+void TChain::SetCacheLearnedBranches(std::shared_ptr<ROOT::Internal::TTreeCacheLearnedBranches> learned)
+{
+   fCacheLearnedBranches = std::move(learned);
+   if (fTree)
+      fTree->SetCacheLearnedBranches(fCacheLearnedBranches);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Reset the addresses of the branch.
 
@@ -0,0 +1,76 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TChainFilePrefetch.h"
+
+#include "TDirectory.h"
+#include "TFile.h"
+#include "TTree.h"
+#include "TTreeCache.h"
+
+#include <algorithm>
+
+namespace {
+
+TFile *OpenAndPreRead(const std::string &fileName, const std::string &treeName, Long64_t cacheSize,
+                      const std::shared_ptr<ROOT::Internal::TTreeCacheLearnedBranches> &learnedBranches,
+                      Long64_t entryMin, Long64_t entryMax)
+{
+   TDirectory::TContext ctxt;
+   TFile *file = TFile::Open(fileName.c_str());
+   if (!file)
+      return nullptr;
+   if (file->IsZombie()) {
+      delete file;
+      return nullptr;
+   }
+   file->SetBit(kMustCleanup);
+
+   // The tree remains attached to the file, where the chain will find it
+   auto tree = dynamic_cast<TTree *>(file->Get(treeName.c_str()));
+   if (!tree || cacheSize == 0 || !learnedBranches || !learnedBranches->IsSet())
+      return file;
+   entryMin = std::max(entryMin, 0LL);
+   entryMax = std::min(entryMax, tree->GetEntries());
+   if (entryMin >= entryMax)
+      return file;
+
+   tree->SetCacheLearnedBranches(learnedBranches);
+   tree->SetCacheSize(cacheSize);
+   if (auto cache = tree->GetReadCache(file)) {
+      cache->SetEntryRange(entryMin, entryMax);
+      // The cache reads the cluster of the current entry
+      tree->LoadTree(entryMin);
+      cache->FillBuffer();
+   }
+   return file;
+}
+
+} // anonymous namespace
+
+ROOT::Internal::TChainFilePrefetch::TChainFilePrefetch(
+   Int_t treeNumber, const std::string &fileName, const std::string &treeName, Long64_t cacheSize,
+   const std::shared_ptr<TTreeCacheLearnedBranches> &learnedBranches, Long64_t entryMin, Long64_t entryMax)
+   : fTreeNumber(treeNumber), fFile(std::async(std::launch::async, OpenAndPreRead, fileName, treeName, cacheSize,
+                                               learnedBranches, entryMin, entryMax))
+{
+}
+
+ROOT::Internal::TChainFilePrefetch::~TChainFilePrefetch()
+{
+   delete TakeFile();
+}
+
+TFile *ROOT::Internal::TChainFilePrefetch::TakeFile()
+{
+   if (!fFile.valid())
+      return nullptr;
+   return fFile.get();
+}
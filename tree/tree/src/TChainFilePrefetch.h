@@ -0,0 +1,54 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TChainFilePrefetch
+#define ROOT_TChainFilePrefetch
+
+#include "RtypesCore.h"
+
+#include <future>
+#include <memory>
+#include <string>
+
+class TFile;
+
+namespace ROOT {
+namespace Internal {
+
+class TTreeCacheLearnedBranches;
+
+/// Opens the file of the next tree of a TChain in a background thread while the chain processes the current tree.
+/// The tree is read from the file and, if the branches to cache are already known, the baskets of the first cluster
+/// in the cache entry range of the chain are read into a TTreeCache.  The chain takes over the file, together with the tree and its cache, once it moves to
+/// the next tree.  A file that is not taken over is closed when the prefetch is destroyed.
+class TChainFilePrefetch {
+   Int_t fTreeNumber;          ///< Number of the prefetched tree in the chain
+   std::future<TFile *> fFile; ///< The prefetched file, or nullptr if it cannot be opened
+
+public:
+   /// A negative cache size selects the default cache size, a zero cache size disables the pre-reading.
+   /// The cache entry range [entryMin, entryMax[ is given in entries of the prefetched tree; nothing is pre-read if
+   /// it does not overlap with the tree.
+   TChainFilePrefetch(Int_t treeNumber, const std::string &fileName, const std::string &treeName, Long64_t cacheSize,
+                      const std::shared_ptr<TTreeCacheLearnedBranches> &learnedBranches, Long64_t entryMin,
+                      Long64_t entryMax);
+   TChainFilePrefetch(const TChainFilePrefetch &) = delete;
+   TChainFilePrefetch &operator=(const TChainFilePrefetch &) = delete;
+   ~TChainFilePrefetch();
+
+   Int_t GetTreeNumber() const { return fTreeNumber; }
+   /// Waits for the prefetch to finish and passes the ownership of the file to the caller.
+   TFile *TakeFile();
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
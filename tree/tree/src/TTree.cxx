@@ -3447,7 +3447,9 @@ namespace {
 ///
 /// By default copy all entries.
 ///
-/// Returns number of bytes copied to this tree.
+/// Returns number of bytes copied to this tree, -1 if the first tree cannot be
+/// fast cloned, or -2 if the baskets of an input tree could not be read while
+/// fast cloning it, in which case this tree lacks their entries.
 ///
 /// If 'option' contains the word 'fast' and nentries is -1, the cloning will be
 /// done without unzipping or unstreaming the baskets (i.e., a direct copy of the
@@ -3544,7 +3546,25 @@ Long64_t TTree::CopyEntries(TTree* tree, Long64_t nentries /* = -1 */, Option_t*
          if (cloner.IsValid()) {
             this->SetEntries(this->GetEntries() + tree->GetTree()->GetEntries());
             if (cacheSize != -1) cloner.SetCacheSize(cacheSize);
-            cloner.Exec();
+            if (!cloner.Exec()) {
+               Error("CopyEntries", "%s", cloner.GetWarning());
+               return -2;
+            }
+         } else if (cloner.NeedConversion()) {
+            // The baskets cannot be copied as they are, e.g. because the input was written with other IO
+            // features than this tree; this also applies to the first tree of the input, which is the only
+            // one when merging plain trees.
+            TTree *localtree = tree->GetTree();
+            Long64_t tentries = localtree->GetEntries();
+            for (Long64_t ii = 0; ii < tentries; ii++) {
+               if (localtree->GetEntry(ii) <= 0) {
+                  break;
+               }
+               this->Fill();
+            }
+            if (this->GetTreeIndex()) {
+               this->GetTreeIndex()->Append(tree->GetTree()->GetTreeIndex(), kTRUE);
+            }
          } else {
             if (i == 0) {
                Warning("CopyEntries","%s",cloner.GetWarning());
@@ -3552,25 +3572,11 @@ Long64_t TTree::CopyEntries(TTree* tree, Long64_t nentries /* = -1 */, Option_t*
                // (since apriori the source and target are exactly the same structure!)
                return -1;
             } else {
-               if (cloner.NeedConversion()) {
-                  TTree *localtree = tree->GetTree();
-                  Long64_t tentries = localtree->GetEntries();
-                  for (Long64_t ii = 0; ii < tentries; ii++) {
-                     if (localtree->GetEntry(ii) <= 0) {
-                        break;
-                     }
-                     this->Fill();
-                  }
-                  if (this->GetTreeIndex()) {
-                     this->GetTreeIndex()->Append(tree->GetTree()->GetTreeIndex(), kTRUE);
-                  }
+               Warning("CopyEntries","%s",cloner.GetWarning());
+               if (tree->GetDirectory() && tree->GetDirectory()->GetFile()) {
+                  Warning("CopyEntries", "Skipped file %s\n", tree->GetDirectory()->GetFile()->GetName());
                } else {
-                  Warning("CopyEntries","%s",cloner.GetWarning());
-                  if (tree->GetDirectory() && tree->GetDirectory()->GetFile()) {
-                     Warning("CopyEntries", "Skipped file %s\n", tree->GetDirectory()->GetFile()->GetName());
-                  } else {
-                     Warning("CopyEntries", "Skipped file number %d\n", tree->GetTreeNumber());
-                  }
+                  Warning("CopyEntries", "Skipped file number %d\n", tree->GetTreeNumber());
                }
             }
          }
@@ -6786,7 +6792,8 @@ TTree* TTree::MergeTrees(TList* li, Option_t* options)
 ////////////////////////////////////////////////////////////////////////////////
 /// Merge the trees in the TList into this tree.
 ///
-/// Returns the total number of entries in the merged tree.
+/// Returns the total number of entries in the merged tree, or -1 if the
+/// baskets of an input tree could not be read while fast cloning it.
 
 Long64_t TTree::Merge(TCollection* li, Option_t *options)
 {
@@ -6812,9 +6819,14 @@ Long64_t TTree::Merge(TCollection* li, Option_t *options)
 
       CopyAddresses(tree);
 
-      CopyEntries(tree,-1,options);
+      Long64_t nbytes = CopyEntries(tree,-1,options);
 
       tree->ResetBranchAddresses();
+      // The entries of the trees that follow would not match those of the other trees in the output file
+      if (nbytes == -2) {
+         fAutoSave = storeAutoSave;
+         return -1;
+      }
    }
    fAutoSave = storeAutoSave;
    return GetEntries();
@@ -6827,7 +6839,9 @@ Long64_t TTree::Merge(TCollection* li, Option_t *options)
 /// this TTree object (so that this TTree object is now the appropriate to
 /// use for further merging).
 ///
-/// Returns the total number of entries in the merged tree.
+/// Returns the total number of entries in the merged tree. If the baskets of
+/// an input tree could not be read while fast cloning it, returns -1 and sets
+/// info->fIsIncomplete so that the merge is stopped.
 
 Long64_t TTree::Merge(TCollection* li, TFileMergeInfo *info)
 {
@@ -6870,9 +6884,15 @@ Long64_t TTree::Merge(TCollection* li, TFileMergeInfo *info)
       // Copy branch addresses.
       CopyAddresses(tree);
 
-      CopyEntries(tree,-1,options);
+      Long64_t nbytes = CopyEntries(tree,-1,options);
 
       tree->ResetBranchAddresses();
+      if (nbytes == -2) {
+         if (info)
+            info->fIsIncomplete = kTRUE;
+         fAutoSave = storeAutoSave;
+         return -1;
+      }
    }
    fAutoSave = storeAutoSave;
    return GetEntries();
@@ -8151,6 +8171,63 @@ void TTree::MarkEventCluster()
     ++fNClusterRange;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Let the tree select the compression settings of each of its branches while
+/// it is filled.
+///
+/// The first `nbaskets` baskets written by a compressed branch are compressed
+/// with several candidate settings in addition to the branch's own: LZ4, ZSTD
+/// at levels 1 and 5 and ZLIB at levels 1 and 6.  For each candidate, the
+/// compressed size and the time to decompress the baskets are recorded.  After
+/// the trials, the candidate that best fits the objective becomes the
+/// compression setting of the branch for its remaining baskets:
+///
+///   - kAutoCompressionSize: the smallest compressed size.
+///   - kAutoCompressionReadSpeed: the fastest decompression.
+///   - kAutoCompressionBalanced: the smallest compressed size among the
+///     candidates that decompress at most twice as slow as the fastest one.
+///
+/// The trial baskets themselves are written with the branch's settings at
+/// the time.  Trying the candidates costs several compressions of each trial
+/// basket.  Branches whose compression is disabled are left alone, as are
+/// branches that already completed their trials.  kAutoCompressionDisabled
+/// stops the selection for the branches still being tried.
+///
+/// The settings are not persisted with the tree, only their outcome is.
+
+void TTree::SetAutoCompression(EAutoCompression objective, Int_t nbaskets)
+{
+   fAutoCompression = objective;
+   fAutoCompressionBaskets = nbaskets > 0 ? nbaskets : 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the baskets of the zstd-compressed branches with a dictionary.
+///
+/// Compressing each basket on its own is inefficient for small baskets, which
+/// have little content to learn their statistics from.  A zstd dictionary
+/// holds the statistics of typical content and considerably improves the
+/// compression ratio and the decompression speed of small, similar buffers.
+///
+/// Each branch compressed with zstd (algorithm ROOT::RCompressionSetting::EAlgorithm::kZSTD)
+/// trains its own dictionary of at most `dictsize` bytes on the beginning of
+/// its first `nbaskets` baskets, which themselves are compressed without it.
+/// The following baskets of the branch are compressed with the dictionary.
+/// The dictionary is stored with the branch and registered with zstd when the
+/// tree is read back, such that the baskets are decompressed transparently.
+/// Files written with dictionaries cannot be read by ROOT versions that do not
+/// support them.
+///
+/// If the samples are too few or too small to train a dictionary, the branch
+/// continues without one.  `nbaskets` equal to 0 disables the training for the
+/// branches that did not train their dictionary yet.
+
+void TTree::SetCompressionDictionary(Int_t nbaskets, Int_t dictsize)
+{
+   fCompressionDictBaskets = nbaskets > 0 ? nbaskets : 0;
+   fCompressionDictSize = dictsize > 0 ? dictsize : 16384;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This function may be called at the start of a program to change
 /// the default value for fAutoSave (and for SetAutoSave) is -300000000, ie 300 MBytes.
@@ -8636,6 +8713,8 @@ Int_t TTree::SetCacheSizeAux(Bool_t autocache /* = kTRUE */, Long64_t cacheSize
       pf = new TTreeCache(this, cacheSize);
 
    pf->SetAutoCreated(autocache);
+   if (fCacheLearnedBranches)
+      pf->SetLearnedBranches(fCacheLearnedBranches);
 
    return 0;
 }
@@ -8686,6 +8765,23 @@ void TTree::SetCacheLearnEntries(Int_t n)
    TTreeCache::SetLearnEntries(n);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Share the branches learned by the TTreeCache of this tree with the caches
+/// of other trees reading the same data, e.g. the trees read by the other
+/// threads of a job. The first cache that completes its learning phase records
+/// the branches it learned; the caches created afterwards use these branches
+/// right away and skip the learning phase.
+/// Pass a null pointer to stop sharing for the caches created from now on.
+
+void TTree::SetCacheLearnedBranches(std::shared_ptr<ROOT::Internal::TTreeCacheLearnedBranches> learned)
+{
+   fCacheLearnedBranches = std::move(learned);
+   TFile *f = GetCurrentFile();
+   TTreeCache *tc = f ? GetReadCache(f) : nullptr;
+   if (tc && fCacheLearnedBranches)
+      tc->SetLearnedBranches(fCacheLearnedBranches);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Enable/Disable circularity for this tree.
 ///
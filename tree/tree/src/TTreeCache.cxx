@@ -1771,6 +1771,8 @@ Bool_t TTreeCache::FillBuffer()
          fFirstTime = kFALSE;
       }
    }
+   if (fIsLearning)
+      PublishLearnedBranches();
    fIsLearning = kFALSE;
    return kTRUE;
 }
@@ -2097,8 +2099,9 @@ void TTreeCache::SetEntryRange(Long64_t emin, Long64_t emax)
                              fEntryMin, fEntryMax, fEntryNext);
 
    if (needLearningStart) {
-      // Restart learning
+      // Restart learning, unless another cache already learned the branches for us
       StartLearningPhase();
+      SeedLearnedBranches();
    }
 }
 
@@ -2128,6 +2131,65 @@ void TTreeCache::SetLearnEntries(Int_t n)
    fgLearnEntries = n;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Share the branches learned by this cache with the caches of other trees
+/// reading the same data, e.g. the trees of the other files of a chain or the
+/// trees read by the other threads of a job.
+/// If the shared set already holds the branches learned by another cache,
+/// this cache starts with these branches and skips its learning phase.
+/// Otherwise the branches are recorded in the shared set once this cache
+/// completes its learning phase.
+
+void TTreeCache::SetLearnedBranches(std::shared_ptr<ROOT::Internal::TTreeCacheLearnedBranches> learned)
+{
+   fLearnedBranches = std::move(learned);
+   SeedLearnedBranches();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Record the branches of the cache in the shared branch set, unless another
+/// cache already did.
+
+void TTreeCache::PublishLearnedBranches()
+{
+   if (!fLearnedBranches || fLearnedBranches->IsSet() || fNbranches == 0)
+      return;
+
+   std::vector<std::string> names;
+   names.reserve(fBrNames->GetEntries());
+   TIter next(fBrNames);
+   while (auto os = static_cast<TObjString *>(next()))
+      names.emplace_back(os->GetName());
+   if (fLearnedBranches->SetNames(std::move(names)) && gDebug > 0)
+      Info("PublishLearnedBranches", "shared %d learned branches", fNbranches);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the branches of the shared branch set to the cache and end the learning
+/// phase, as if the branches had been learned from a previous file.
+/// Returns true if the learning phase was skipped.
+
+Bool_t TTreeCache::SeedLearnedBranches()
+{
+   if (!fLearnedBranches || !fIsLearning || fIsManual || !fTree)
+      return kFALSE;
+   if (!fLearnedBranches->IsSet())
+      return kFALSE;
+
+   for (const auto &name : fLearnedBranches->GetNames()) {
+      TBranch *b = fTree->GetBranch(name.c_str());
+      if (b)
+         AddBranch(b);
+   }
+   fIsLearning = kFALSE;
+   fEntryNext = -1;
+
+   auto perfStats = GetTree()->GetPerfStats();
+   if (perfStats)
+      perfStats->UpdateBranchIndices(fBranches);
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set whether the learning period is started with a prefilling of the
 /// cache and which type of prefilling is used.
@@ -2172,6 +2234,7 @@ void TTreeCache::StopLearningPhase()
       fIsLearning = kFALSE;
    }
    fIsManual = kTRUE;
+   PublishLearnedBranches();
 
    auto perfStats = GetTree()->GetPerfStats();
    if (perfStats)
@@ -2218,6 +2281,8 @@ void TTreeCache::UpdateBranches(TTree *tree)
       fBranches->AddAt(b, fNbranches);
       fNbranches++;
    }
+   if (fNbranches == 0 && SeedLearnedBranches())
+      return;
 
    auto perfStats = GetTree()->GetPerfStats();
    if (perfStats)
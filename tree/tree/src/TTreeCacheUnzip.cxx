@@ -29,6 +29,9 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #include "TMutex.h"
 #include "ROOT/RMakeUnique.hxx"
 
+#include <algorithm>
+#include <numeric>
+
 #ifdef R__USE_IMT
 #include "ROOT/TThreadExecutor.hxx"
 #include "ROOT/TTaskGroup.hxx"
@@ -306,6 +309,7 @@ Bool_t TTreeCacheUnzip::FillBuffer()
 
    //clear cache buffer
    TFileCacheRead::Prefetch(0,0);
+   fUnzipEntry.clear();
 
    //store baskets
    for (Int_t i = 0; i < fNbranches; i++) {
@@ -337,6 +341,7 @@ Bool_t TTreeCacheUnzip::FillBuffer()
          fNReadPref++;
 
          TFileCacheRead::Prefetch(pos, len);
+         fUnzipEntry.push_back(entries[j]);
       }
       if (gDebug > 0) printf("Entry: %lld, registering baskets branch %s, fEntryNext=%lld, fNseek=%d, fNtot=%d\n", entry, ((TBranch*)fBranches->UncheckedAt(i))->GetName(), fEntryNext, fNseek, fNtot);
    }
@@ -499,9 +504,15 @@ Int_t TTreeCacheUnzip::GetRecordHeader(char *buf, Int_t maxbytes, Int_t &nbytes,
 
 void TTreeCacheUnzip::ResetCache()
 {
+#ifdef R__USE_IMT
+   // The tasks must not touch the baskets' state while it is wiped
+   StopTasks();
+#endif
    // Reset all the lists and wipe all the chunks
    fCycle++;
    fUnzipState.Clear(fNseekMax);
+   fUnzipMemory = 0;
+   fUnzipScheduled = kFALSE;
 
    if(fNseekMax < fNseek){
       if (gDebug > 0)
@@ -543,7 +554,7 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
       return 1;
    }
 
-   if ((myCycle != fCycle) || !fIsTransferred)  {
+   if ((myCycle != fCycle) || !fIsTransferred || fUnzipStop)  {
       fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
       return 1;
    }
@@ -586,12 +597,14 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
    char *ptr = 0;
    Int_t loclen = UnzipBuffer(&ptr, locbuff);
    if ((loclen > 0) && (loclen == objlen + keylen)) {
-      if ((myCycle != fCycle) || !fIsTransferred) {
+      if ((myCycle != fCycle) || !fIsTransferred || fUnzipStop) {
          fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
+         delete [] ptr;
          if (locbuff) delete [] locbuff;
          return 1;
       }
       fUnzipState.SetUnzipped(index, ptr, loclen); // Set it as done
+      AddUnzipMemory(loclen);
       fNUnzip++;
    } else {
       fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
@@ -603,55 +616,136 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
 
 #ifdef R__USE_IMT
 ////////////////////////////////////////////////////////////////////////////////
-/// We create a TTaskGroup and asynchronously maps each group of baskets(> 100 kB in total)
-/// to a task. In TTaskGroup, we use TThreadExecutor to do the actually work of unzipping 
-/// a group of basket. The purpose of creating TTaskGroup is to avoid competing with main thread.
+/// We create a TTaskGroup whose tasks unzip the baskets of the cache in the
+/// order in which they are expected to be read, i.e. sorted by their first
+/// entry. The tasks take the baskets from a common queue and stay ahead of the
+/// reads by at most fUnzipBufferSize bytes of unzipped baskets: once this
+/// budget is used up, they stop and are resumed as the baskets are read.
+/// The purpose of creating TTaskGroup is to avoid competing with main thread.
 
 Int_t TTreeCacheUnzip::CreateTasks()
 {
-   auto mapFunction = [&]() {
-      auto unzipFunction = [&](const std::vector<Int_t> &indices) {
-         // If cache is invalidated and we should return immediately.
-         if (!fIsTransferred) return nullptr;
-
-         for (auto ii : indices) {
-            if(fUnzipState.TryUnzipping(ii)) {
-               Int_t res = UnzipCache(ii);
-               if(res)
-                  if (gDebug > 0)
-                     Info("UnzipCache", "Unzipping failed or cache is in learning state");
-            }
+   StopTasks();
+
+   fUnzipOrder.resize(fNseek);
+   std::iota(fUnzipOrder.begin(), fUnzipOrder.end(), 0);
+   if ((Int_t)fUnzipEntry.size() == fNseek) {
+      std::stable_sort(fUnzipOrder.begin(), fUnzipOrder.end(),
+                       [this](Int_t a, Int_t b) { return fUnzipEntry[a] < fUnzipEntry[b]; });
+   }
+   fUnzipNext = 0;
+   fUnzipScheduled = kTRUE;
+
+   fUnzipTaskGroup.reset(new ROOT::Experimental::TTaskGroup());
+   ResumeTasks();
+
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Start unzipping tasks if none is running, there are baskets left in the
+/// queue and the memory budget allows for more unzipped baskets. Each task
+/// takes care of at least fUnzipGroupSize bytes of baskets.
+
+void TTreeCacheUnzip::ResumeTasks()
+{
+   const Int_t nBaskets = fUnzipOrder.size();
+   if (!fUnzipTaskGroup || fUnzipActive > 0 || fUnzipNext >= nBaskets)
+      return;
+   if (fUnzipBufferSize > 0 && fUnzipMemory >= fUnzipBufferSize)
+      return;
+
+   const Int_t cycle = fCycle;
+   auto unzipFunction = [this, cycle, nBaskets]() {
+      while (fIsTransferred && cycle == fCycle && !fUnzipStop) {
+         if (fUnzipBufferSize > 0 && fUnzipMemory >= fUnzipBufferSize) {
+            fNPaused++;
+            break;
          }
-         return nullptr;
-      };
-
-      Int_t accusz = 0;
-      std::vector<std::vector<Int_t>> basketIndices;
-      std::vector<Int_t> indices;
-      if (fUnzipGroupSize <= 0) fUnzipGroupSize = 102400;
-      for (Int_t i = 0; i < fNseek; i++) {
-         while (accusz < fUnzipGroupSize) {
-            accusz += fSeekLen[i];
-            indices.push_back(i);
-            i++;
-            if (i >= fNseek) break;
+         const Int_t next = fUnzipNext++;
+         if (next >= nBaskets)
+            break;
+         const Int_t index = fUnzipOrder[next];
+         if (fUnzipState.TryUnzipping(index)) {
+            if (UnzipCache(index) && gDebug > 0)
+               Info("UnzipCache", "Unzipping failed or cache is in learning state");
          }
-         if (i < fNseek) i--;
-         basketIndices.push_back(indices);
-         indices.clear();
-         accusz = 0;
       }
-      ROOT::TThreadExecutor pool;
-      pool.Foreach(unzipFunction, basketIndices);
+      fUnzipActive--;
    };
 
-   fUnzipTaskGroup.reset(new ROOT::Experimental::TTaskGroup());
-   fUnzipTaskGroup->Run(mapFunction);
+   if (fUnzipGroupSize <= 0) fUnzipGroupSize = 102400;
+   Long64_t remaining = 0;
+   for (Int_t i = fUnzipNext; i < nBaskets; ++i)
+      remaining += fSeekLen[fUnzipOrder[i]];
+   const Int_t nTasks = std::min<Long64_t>(ROOT::GetThreadPoolSize(), remaining / fUnzipGroupSize + 1);
 
-   return 0;
+   fUnzipActive += nTasks;
+   for (Int_t i = 0; i < nTasks; ++i)
+      fUnzipTaskGroup->Run(unzipFunction);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Cancel the pending unzipping tasks and wait for the running ones. The
+/// running ones stop after the basket they are unzipping, since the remaining
+/// ones are about to be discarded.
+
+void TTreeCacheUnzip::StopTasks()
+{
+   if (!fUnzipTaskGroup)
+      return;
+   fUnzipStop = true;
+   fUnzipTaskGroup->Cancel();
+   fUnzipTaskGroup.reset();
+   fUnzipActive = 0;
+   fUnzipStop = false;
 }
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+/// Account for unzipped baskets that are added to (positive size) or removed
+/// from (negative size) the cache.
+
+void TTreeCacheUnzip::AddUnzipMemory(Long64_t size)
+{
+   const Long64_t memory = fUnzipMemory += size;
+   Long64_t peak = fUnzipMemoryPeak;
+   while (memory > peak && !fUnzipMemoryPeak.compare_exchange_weak(peak, memory)) {
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The reader asked for a basket that was not unzipped yet: the tasks are
+/// behind the reader. Let them continue with the baskets that come after this
+/// one and, if the memory budget is used up, drop the unzipped baskets that
+/// start before it, which were skipped by the reader.
+
+void TTreeCacheUnzip::CatchUpWithReader(Int_t seekidx)
+{
+   const Int_t nBaskets = fUnzipOrder.size();
+   if (seekidx < 0 || nBaskets != fNseek || (Int_t)fUnzipEntry.size() != fNseek)
+      return;
+   const Long64_t entry = fUnzipEntry[seekidx];
+
+   const Int_t first = std::lower_bound(fUnzipOrder.begin(), fUnzipOrder.end(), entry,
+                                        [this](Int_t idx, Long64_t e) { return fUnzipEntry[idx] < e; }) -
+                       fUnzipOrder.begin();
+   Int_t next = fUnzipNext;
+   while (next < first && !fUnzipNext.compare_exchange_weak(next, first)) {
+   }
+
+   if (fUnzipBufferSize <= 0 || fUnzipMemory < fUnzipBufferSize)
+      return;
+   for (Int_t i = 0; i < first; ++i) {
+      const Int_t idx = fUnzipOrder[i];
+      if (fUnzipState.IsUnzipped(idx)) {
+         AddUnzipMemory(-fUnzipState.fUnzipLen[idx]);
+         fUnzipState.SetFinished(idx);
+         fNEvicted++;
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// We try to read a buffer that has already been unzipped
 /// Returns -1 in case of read failure, 0 in case it's not in the
@@ -712,27 +806,23 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
                }
 
                fNFound++;
+               AddUnzipMemory(-fUnzipState.fUnzipLen[seekidx]);
+#ifdef R__USE_IMT
+               ResumeTasks();
+#endif
                return fUnzipState.fUnzipLen[seekidx];
             }
 
-            // If the requested basket is being unzipped by a background task, we try to steal a blk to unzip.
-            Int_t reqi = -1;
-            
+            // If the requested basket is being unzipped by a background task, we unzip the next one of the queue.
             if (fUnzipState.IsProgress(seekidx)) {
                if (fEmpty) {
-                  for (Int_t ii = 0; ii < fNseek; ++ii) {
-                     Int_t idx = (seekidx + 1 + ii) % fNseek;
-                     if (fUnzipState.IsUntouched(idx)) {
-                        if(fUnzipState.TryUnzipping(idx)) {
-                           reqi = idx;
-                           break;
-                        }
-                     }
-                  }
-                  if (reqi < 0) {
-                     fEmpty = kFALSE;
+                  const Int_t next = fUnzipNext++;
+                  if (next < (Int_t)fUnzipOrder.size()) {
+                     const Int_t idx = fUnzipOrder[next];
+                     if (fUnzipState.TryUnzipping(idx))
+                        UnzipCache(idx);
                   } else {
-                     UnzipCache(reqi);
+                     fEmpty = kFALSE;
                   }
                }
  
@@ -761,11 +851,19 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
             }
 
             fNStalls++;
+            AddUnzipMemory(-fUnzipState.fUnzipLen[seekidx]);
+#ifdef R__USE_IMT
+            ResumeTasks();
+#endif
             return fUnzipState.fUnzipLen[seekidx];
-         } else {
+         } else if (seekidx >= 0) {
             // This is a complete miss. We want to avoid the background tasks
             // to try unzipping this block in the future.
             fUnzipState.SetMissed(seekidx);
+            CatchUpWithReader(seekidx);
+#ifdef R__USE_IMT
+            ResumeTasks();
+#endif
          }
       } else {
          loc = -1;
@@ -789,10 +887,7 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
    if (!ReadBufferExt(fCompBuffer, pos, len, loc)) {
       // Cache is invalidated and we need to wait for all unzipping tasks to befinished before fill new baskets in cache.
 #ifdef R__USE_IMT
-      if(ROOT::IsImplicitMTEnabled() && fUnzipTaskGroup) {
-         fUnzipTaskGroup->Cancel();
-         fUnzipTaskGroup.reset();
-      }
+      StopTasks();
 #endif
       {
          // Fill new baskets into cache.
@@ -806,6 +901,12 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
       }
 #endif
    }
+#ifdef R__USE_IMT
+   else if (fParallel && !fIsLearning && fIsTransferred && !fUnzipScheduled && ROOT::IsImplicitMTEnabled()) {
+      // The content of the cache was just transferred: start unzipping it ahead of the reads
+      CreateTasks();
+   }
+#endif
 
    if (res) res = -1;
 
@@ -945,10 +1046,13 @@ void  TTreeCacheUnzip::Print(Option_t* option) const {
 
    printf("******TreeCacheUnzip statistics for file: %s ******\n",fFile->GetName());
    printf("Max allowed mem for pending buffers: %lld\n", fUnzipBufferSize);
-   printf("Number of blocks unzipped by threads: %d\n", fNUnzip);
+   printf("Number of blocks unzipped by threads: %d\n", fNUnzip.load());
    printf("Number of hits: %d\n", fNFound);
    printf("Number of stalls: %d\n", fNStalls);
    printf("Number of misses: %d\n", fNMissed);
+   printf("Number of pauses at the memory limit: %d\n", fNPaused.load());
+   printf("Number of unread blocks dropped: %d\n", fNEvicted);
+   printf("Peak mem for pending buffers: %lld\n", fUnzipMemoryPeak.load());
 
    TTreeCache::Print(option);
 }
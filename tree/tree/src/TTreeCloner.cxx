@@ -34,9 +34,16 @@ Class implementing or helping  the various TTree cloning method
 #include "TLeafC.h"
 #include "TFileCacheRead.h"
 #include "TTreeCache.h"
+#include "TROOT.h"
 #include "snprintf.h"
+#include "ZipZSTD.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#endif
 
 #include <algorithm>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -122,7 +129,8 @@ TTreeCloner::TTreeCloner(TTree *from, TTree *to, Option_t *method, UInt_t option
    fToStartEntries(0),
    fCacheSize(0LL),
    fFileCache(nullptr),
-   fPrevCache(nullptr)
+   fPrevCache(nullptr),
+   fPipelineFile(nullptr)
 {
    TString opt(method);
    opt.ToLower();
@@ -197,14 +205,21 @@ Bool_t TTreeCloner::Exec()
    if (!IsValid()) {
       return kFALSE;
    }
-   CreateCache();
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled())
+      fPipelineFile = FindPipelineFile();
+#endif
+   // The pipelined transfer reads the baskets by itself
+   if (!fPipelineFile)
+      CreateCache();
    ImportClusterRanges();
    CopyStreamerInfos();
    CopyProcessIds();
    CloseOutWriteBaskets();
    CollectBaskets();
    SortBaskets();
-   WriteBaskets();
+   if (!WriteBaskets())
+      return kFALSE;
    CopyMemoryBaskets();
    RestoreCache();
 
@@ -313,6 +328,25 @@ UInt_t TTreeCloner::CollectBranches(TBranch *from, TBranch *to) {
 
    }
 
+   if (!from->fCompressionDict.empty() && from->fCompressionDict != to->fCompressionDict) {
+      // The copied baskets can only be decompressed with the dictionary they were compressed with.  The
+      // baskets that the output branch compressed so far do not need a dictionary.  Otherwise the entries are
+      // recompressed with the dictionary of the output branch.
+      if (!to->fCompressionDict.empty()) {
+         fWarningMsg.Form("The export branch and the import branch (%s) were compressed with different dictionaries.",
+                          from->GetName());
+         if (!(fOptions & kNoWarnings)) {
+            Warning("TTreeCloner::CollectBranches", "%s", fWarningMsg.Data());
+         }
+         fIsValid = kFALSE;
+         fNeedConversion = kTRUE;
+         return 0;
+      }
+      to->fCompressionDict = from->fCompressionDict;
+      to->fCompressionDictHandle = R__addZSTDDict(to->fCompressionDict.data(), to->fCompressionDict.size());
+      to->fDictTrainingDone = kTRUE;
+   }
+
    fFromBranches.AddLast(from);
    if (!from->TestBit(TBranch::kDoNotUseBufferMap)) {
       // Make sure that we reset the Buffer's map if needed.
@@ -682,10 +716,166 @@ UInt_t TTreeCloner::FillCache(UInt_t from)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Transfer the basket from the input file to the output file
+/// Transfer a basket of the input branch that is not written yet, i.e. that
+/// is only in memory, to the output branch.
+
+void TTreeCloner::WriteMemoryBasket(TBranch *from, TBranch *to, Int_t index)
+{
+   TBasket *frombasket = from->GetBasket( index );
+   if (frombasket && frombasket->GetNevBuf()>0) {
+      TBasket *tobasket = (TBasket*)frombasket->Clone();
+      tobasket->SetBranch(to);
+      to->AddBasket(*tobasket, kFALSE, fToStartEntries+from->GetBasketEntry()[index]);
+      to->FlushOneBasket(to->GetWriteBasket());
+   }
+}
+
+#ifdef R__USE_IMT
+////////////////////////////////////////////////////////////////////////////////
+/// Return the input file if its baskets can be read in a task while the output
+/// file is written, see WriteBasketsPipelined().  Returns nullptr if the
+/// baskets are spread over several files or if the input and output files are
+/// the same.
 
-void TTreeCloner::WriteBaskets()
+TFile *TTreeCloner::FindPipelineFile() const
 {
+   TFile *fromfile = nullptr;
+   for (Int_t i = 0; i < fFromBranches.GetEntriesFast(); ++i) {
+      TFile *file = ((TBranch *)fFromBranches.UncheckedAt(i))->GetFile(0);
+      TFile *tofile = ((TBranch *)fToBranches.UncheckedAt(i))->GetFile(0);
+      if (!file || file == tofile || (fromfile && file != fromfile))
+         return nullptr;
+      fromfile = file;
+   }
+   return fromfile;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Transfer the baskets from fPipelineFile to the output file, reading the
+/// next chunk of baskets in a task while the baskets of the current chunk are
+/// written.  The baskets are still written one by one, in the order selected
+/// by SortBaskets().  A chunk holds as many bytes as the file cache would.
+/// Only the baskets of the current input tree are read ahead; the input trees
+/// are merged one after the other.
+///
+/// Returns false, and invalidates the cloner, if the baskets cannot be read.
+
+Bool_t TTreeCloner::WriteBasketsPipelined()
+{
+   TFile *fromfile = fPipelineFile;
+
+   /// The baskets of consecutive entries of fBasketIndex that are read in one go.
+   struct TChunk {
+      UInt_t fEnd = 0;                ///< One past the last entry of fBasketIndex in this chunk
+      std::vector<Long64_t> fSeek;    ///< Positions of the baskets on file, sorted
+      std::vector<Int_t> fBytes;      ///< Sizes of the baskets on file, in the same order
+      std::vector<Long64_t> fOffset;  ///< Offsets of the baskets in fContent, in the same order
+      std::vector<char> fContent;
+      Bool_t fFailed = kFALSE;
+   };
+
+   // Determine the chunks upfront: the sizes of the baskets might need to be read from the input file.
+   const Long64_t chunkSize = fCacheSize > 0 ? fCacheSize : 10000000;
+   TBasket *basket = new TBasket();
+   std::vector<TChunk> chunks(1);
+   Long64_t size = 0;
+   for (UInt_t j = 0; j < fMaxBaskets; ++j) {
+      TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+      Int_t index = fBasketNum[ fBasketIndex[j] ];
+      Long64_t pos = from->GetBasketSeek(index);
+      if (pos != 0) {
+         if (from->GetBasketBytes()[index] == 0) {
+            from->GetBasketBytes()[index] = basket->ReadBasketBytes(pos, fromfile);
+         }
+         Int_t len = from->GetBasketBytes()[index];
+         if (size && size + len > chunkSize) {
+            chunks.back().fEnd = j;
+            chunks.emplace_back();
+            size = 0;
+         }
+         chunks.back().fSeek.push_back(pos);
+         chunks.back().fBytes.push_back(len);
+         size += len;
+      }
+   }
+   chunks.back().fEnd = fMaxBaskets;
+
+   auto readChunk = [fromfile](TChunk &chunk) {
+      // TFile::ReadBuffers expects increasing positions to coalesce nearby reads
+      std::vector<size_t> order(chunk.fSeek.size());
+      for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+      std::sort(order.begin(), order.end(), [&chunk](size_t a, size_t b) { return chunk.fSeek[a] < chunk.fSeek[b]; });
+      std::vector<Long64_t> seek(order.size());
+      std::vector<Int_t> bytes(order.size());
+      chunk.fOffset.resize(order.size());
+      Long64_t total = 0;
+      for (size_t i = 0; i < order.size(); ++i) {
+         seek[i] = chunk.fSeek[order[i]];
+         bytes[i] = chunk.fBytes[order[i]];
+         chunk.fOffset[i] = total;
+         total += bytes[i];
+      }
+      chunk.fSeek.swap(seek);
+      chunk.fBytes.swap(bytes);
+      chunk.fContent.resize(total);
+      if (!chunk.fSeek.empty())
+         chunk.fFailed = fromfile->ReadBuffers(chunk.fContent.data(), chunk.fSeek.data(), chunk.fBytes.data(), chunk.fSeek.size());
+   };
+
+   ROOT::Experimental::TTaskGroup reader;
+   reader.Run([&]() { readChunk(chunks[0]); });
+   for (UInt_t k = 0, j = 0; k < chunks.size(); ++k) {
+      reader.Wait();
+      if (k + 1 < chunks.size()) {
+         reader.Run([&, k]() { readChunk(chunks[k + 1]); });
+      }
+      TChunk &chunk = chunks[k];
+      if (chunk.fFailed) {
+         fWarningMsg.Form("Could not read the baskets of the input TTree %s from %s.", fFromTree->GetName(),
+                          fromfile->GetName());
+         Error("WriteBaskets", "%s", fWarningMsg.Data());
+         fIsValid = kFALSE;
+         reader.Wait();
+         delete basket;
+         return kFALSE;
+      }
+      for (; j < chunk.fEnd; ++j) {
+         TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+         TBranch *to   = (TBranch*)fToBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
+         Int_t index = fBasketNum[ fBasketIndex[j] ];
+
+         Long64_t pos = from->GetBasketSeek(index);
+         if (pos != 0) {
+            auto i = std::lower_bound(chunk.fSeek.begin(), chunk.fSeek.end(), pos) - chunk.fSeek.begin();
+            basket->LoadBasketBuffers(chunk.fContent.data() + chunk.fOffset[i], chunk.fBytes[i], fromfile);
+            basket->IncrementPidOffset(fPidOffset);
+            basket->CopyTo(to->GetFile(0));
+            to->AddBasket(*basket,kTRUE,fToStartEntries + from->GetBasketEntry()[index]);
+         } else {
+            WriteMemoryBasket(from, to, index);
+         }
+      }
+      chunk = TChunk();
+   }
+   delete basket;
+   return kTRUE;
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Transfer the basket from the input file to the output file.
+///
+/// If implicit multi-threading was enabled when Exec() started, the baskets are
+/// read ahead in a task while they are written, see WriteBasketsPipelined().
+/// Returns false if the baskets could not be transferred.
+
+Bool_t TTreeCloner::WriteBaskets()
+{
+#ifdef R__USE_IMT
+   if (fPipelineFile)
+      return WriteBasketsPipelined();
+#endif
+
    TBasket *basket = new TBasket();
    for(UInt_t j = 0, notCached = 0; j<fMaxBaskets; ++j) {
       TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
@@ -711,14 +901,9 @@ void TTreeCloner::WriteBaskets()
          basket->CopyTo(tofile);
          to->AddBasket(*basket,kTRUE,fToStartEntries + from->GetBasketEntry()[index]);
       } else {
-         TBasket *frombasket = from->GetBasket( index );
-         if (frombasket && frombasket->GetNevBuf()>0) {
-            TBasket *tobasket = (TBasket*)frombasket->Clone();
-            tobasket->SetBranch(to);
-            to->AddBasket(*tobasket, kFALSE, fToStartEntries+from->GetBasketEntry()[index]);
-            to->FlushOneBasket(to->GetWriteBasket());
-         }
+         WriteMemoryBasket(from, to, index);
       }
    }
    delete basket;
+   return kTRUE;
 }
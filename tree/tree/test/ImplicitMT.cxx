@@ -1,7 +1,14 @@
 #include "TFile.h"
+#include "TFileMerger.h"
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TTree.h"
+#include "TTreeCacheUnzip.h"
+#include "TTreeCloner.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -28,4 +35,129 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+TEST(TTreeImplicitMT, parallelUnzipMemoryBudget)
+{
+   ROOT::EnableImplicitMT(4);
+   const auto ofileName = "parallelUnzipMemoryBudget.root";
+   const int nBranches = 20;
+   const int nEntries = 20000;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      std::vector<double> values(nBranches);
+      for (int b = 0; b < nBranches; ++b)
+         t.Branch(("b" + std::to_string(b)).c_str(), &values[b]);
+      for (int i = 0; i < nEntries; ++i) {
+         for (int b = 0; b < nBranches; ++b)
+            values[b] = i * nBranches + b;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kEnable);
+   TFile f(ofileName);
+   auto t = f.Get<TTree>("t");
+   t->SetParallelUnzip(kTRUE);
+   auto cache = dynamic_cast<TTreeCacheUnzip *>(t->GetReadCache(&f));
+   ASSERT_NE(cache, nullptr);
+   const Long64_t budget = 100000;
+   cache->SetUnzipBufferSize(budget);
+   t->AddBranchToCache("*", kTRUE);
+   t->StopCacheLearningPhase();
+
+   std::vector<double> values(nBranches);
+   for (int b = 0; b < nBranches; ++b)
+      t->SetBranchAddress(("b" + std::to_string(b)).c_str(), &values[b]);
+   Int_t maxBasketSize = 0;
+   for (int b = 0; b < nBranches; ++b)
+      maxBasketSize = std::max(maxBasketSize, t->GetBranch(("b" + std::to_string(b)).c_str())->GetBasketSize());
+   for (int i = 0; i < nEntries; ++i) {
+      t->GetEntry(i);
+      for (int b = 0; b < nBranches; ++b)
+         EXPECT_EQ(values[b], i * nBranches + b);
+   }
+
+   // Each task and the reader may exceed the budget by one unzipped basket
+   EXPECT_GT(cache->GetNFound() + cache->GetNStalls() + cache->GetNMissed(), 0);
+   EXPECT_LE(cache->GetUnzipMemoryPeak(), budget + (ROOT::GetThreadPoolSize() + 1) * (maxBasketSize + 1000));
+
+   t->SetParallelUnzip(kFALSE);
+   TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kDisable);
+   f.Close();
+   gSystem->Unlink(ofileName);
+   ROOT::DisableImplicitMT();
+}
+
+TEST(TTreeImplicitMT, pipelinedFastMerge)
+{
+   ROOT::EnableImplicitMT(4);
+   const std::vector<std::string> inputNames{"pipelinedFastMerge1.root", "pipelinedFastMerge2.root"};
+   const auto ofileName = "pipelinedFastMerge.root";
+   const int nEntries = 20000;
+   for (std::size_t n = 0; n < inputNames.size(); ++n) {
+      TFile f(inputNames[n].c_str(), "RECREATE");
+      TTree t("t", "t");
+      int i = 0;
+      double x = 0.;
+      t.Branch("i", &i, 1000);
+      t.Branch("x", &x, 1000);
+      for (int e = 0; e < nEntries; ++e) {
+         i = n * nEntries + e;
+         x = 0.5 * i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   {
+      TFileMerger merger(kFALSE, kFALSE);
+      merger.SetPrintLevel(0);
+      ASSERT_TRUE(merger.OutputFile(ofileName, "RECREATE"));
+      for (const auto &name : inputNames)
+         ASSERT_TRUE(merger.AddFile(name.c_str()));
+      // A small cache splits the baskets into many chunks that are read ahead
+      merger.SetMergeOptions(TString("cachesize=20000"));
+      ASSERT_TRUE(merger.Merge());
+   }
+
+   // The cloner that the merge uses takes the pipelined path
+   const auto clonedName = "pipelinedFastMergeCloned.root";
+   {
+      TFile in(inputNames[0].c_str());
+      auto tin = in.Get<TTree>("t");
+      ASSERT_NE(tin, nullptr);
+      TFile out(clonedName, "RECREATE");
+      auto tout = tin->CloneTree(0);
+      TTreeCloner cloner(tin, tout, "", TTreeCloner::kNoWarnings);
+      ASSERT_TRUE(cloner.IsValid());
+      cloner.SetCacheSize(20000);
+      // As in TTree::CopyEntries()
+      tout->SetEntries(tout->GetEntries() + tin->GetEntries());
+      EXPECT_TRUE(cloner.Exec());
+      EXPECT_TRUE(cloner.IsPipelined());
+      EXPECT_EQ(tin->GetEntries(), tout->GetEntries());
+   }
+   gSystem->Unlink(clonedName);
+
+   TFile f(ofileName);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(t, nullptr);
+   ASSERT_EQ(t->GetEntries(), nEntries * (Long64_t)inputNames.size());
+   int i = -1;
+   double x = -1.;
+   t->SetBranchAddress("i", &i);
+   t->SetBranchAddress("x", &x);
+   for (Long64_t e = 0; e < t->GetEntries(); ++e) {
+      t->GetEntry(e);
+      ASSERT_EQ(i, e);
+      ASSERT_EQ(x, 0.5 * e);
+   }
+   f.Close();
+   for (const auto &name : inputNames)
+      gSystem->Unlink(name.c_str());
+   gSystem->Unlink(ofileName);
+   ROOT::DisableImplicitMT();
+}
+
 #endif // R__USE_IMT
@@ -1,7 +1,13 @@
+#include "TChain.h"
 #include "TFile.h"
 #include "TTree.h"
 #include "TBranch.h"
 #include "TRandom.h"
+#include "TSystem.h"
+#include "ZipZSTD.h"
+
+#include <algorithm>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -178,3 +184,209 @@ TEST_F(TBranchTest, twoPreviousTest)
    ASSERT_TRUE(branch->GetListOfBaskets()->At(7));
    delete file;
 }
+
+TEST(TBranch, AutoCompression)
+{
+   const std::vector<Int_t> candidates{404, 501, 505, 101, 106};
+   auto fill = [](TTree &tree) {
+      Int_t counter = 0;
+      ULong64_t noise = 0;
+      Int_t raw = 0;
+      tree.Branch("counter", &counter, 32000);
+      tree.Branch("noise", &noise, 32000);
+      tree.Branch("raw", &raw, 1000)->SetCompressionSettings(0);
+      TRandom random(42);
+      for (Int_t ev = 0; ev < 100000; ++ev) {
+         counter = ev % 17;
+         noise = (ULong64_t(random.Integer(0xffffffff)) << 32) | random.Integer(0xffffffff);
+         raw = ev;
+         tree.Fill();
+      }
+   };
+   {
+      TFile file("TBranchAutoCompression.root", "RECREATE", "", 101);
+      TTree plain("plain", "With the default compression");
+      fill(plain);
+      TTree tree("tree", "A test tree");
+      tree.SetAutoCompression(TTree::kAutoCompressionSize, 2);
+      fill(tree);
+
+      for (auto name : {"counter", "noise"}) {
+         auto settings = tree.GetBranch(name)->GetCompressionSettings();
+         EXPECT_NE(std::find(candidates.begin(), candidates.end(), settings), candidates.end()) << name;
+      }
+      // The repetitive counter compresses best with a strong algorithm, whereas no algorithm shrinks the noise and
+      // the first candidate is kept
+      EXPECT_NE(tree.GetBranch("counter")->GetCompressionSettings(), tree.GetBranch("noise")->GetCompressionSettings());
+      EXPECT_EQ(0, tree.GetBranch("raw")->GetCompressionSettings());
+      file.Write();
+      EXPECT_LT(tree.GetBranch("counter")->GetZipBytes(), plain.GetBranch("counter")->GetZipBytes());
+   }
+
+   {
+      TFile file("TBranchAutoCompression.root");
+      auto tree = file.Get<TTree>("tree");
+      ASSERT_NE(nullptr, tree);
+      Int_t counter = -1;
+      Int_t raw = -1;
+      tree->SetBranchAddress("counter", &counter);
+      tree->SetBranchAddress("raw", &raw);
+      for (Long64_t ev = 0; ev < tree->GetEntries(); ++ev) {
+         tree->GetEntry(ev);
+         ASSERT_EQ(ev % 17, counter);
+         ASSERT_EQ(ev, raw);
+      }
+      auto settings = tree->GetBranch("counter")->GetCompressionSettings();
+      EXPECT_NE(std::find(candidates.begin(), candidates.end(), settings), candidates.end());
+   }
+   gSystem->Unlink("TBranchAutoCompression.root");
+}
+
+TEST(TBranch, CompressionDictionary)
+{
+   auto fill = [](TTree &tree) {
+      char label[64];
+      Int_t number = 0;
+      tree.Branch("label", label, "label/C", 2000);
+      tree.Branch("number", &number, 1000);
+      for (Int_t ev = 0; ev < 5000; ++ev) {
+         snprintf(label, sizeof(label), "event %d run 7 lumi %d detector=tracker", ev, ev / 100);
+         number = ev;
+         tree.Fill();
+      }
+   };
+   {
+      TFile file("TBranchCompressionDictionary.root", "RECREATE", "", 505);
+      TTree plain("plain", "Without dictionaries");
+      fill(plain);
+      TTree dict("dict", "With dictionaries");
+      dict.SetCompressionDictionary(20, 4096);
+      fill(dict);
+      file.Write();
+      EXPECT_LT(dict.GetBranch("label")->GetZipBytes(), plain.GetBranch("label")->GetZipBytes());
+   }
+
+   {
+      TFile file("TBranchCompressionDictionary.root");
+      auto tree = file.Get<TTree>("dict");
+      ASSERT_NE(nullptr, tree);
+      char label[64];
+      Int_t number = -1;
+      tree->SetBranchAddress("label", label);
+      tree->SetBranchAddress("number", &number);
+      char expected[64];
+      for (Long64_t ev = 0; ev < tree->GetEntries(); ++ev) {
+         tree->GetEntry(ev);
+         snprintf(expected, sizeof(expected), "event %lld run 7 lumi %lld detector=tracker", ev, ev / 100);
+         ASSERT_STREQ(expected, label);
+         ASSERT_EQ(ev, number);
+      }
+   }
+   gSystem->Unlink("TBranchCompressionDictionary.root");
+}
+
+// Fast merging inputs that trained their own dictionaries recompresses the entries of all but the first input
+TEST(TBranch, CompressionDictionaryMerge)
+{
+   const char *inputs[] = {"TBranchCompressionDictionaryMerge1.root", "TBranchCompressionDictionaryMerge2.root"};
+   for (int i = 0; i < 2; ++i) {
+      TFile file(inputs[i], "RECREATE", "", 505);
+      TTree tree("dict", "With dictionaries");
+      tree.SetCompressionDictionary(20, 4096);
+      char label[64];
+      tree.Branch("label", label, "label/C", 2000);
+      for (Int_t ev = 0; ev < 5000; ++ev) {
+         snprintf(label, sizeof(label), i == 0 ? "event %d run 7 detector=tracker" : "input two: lumi %d, calo", ev);
+         tree.Fill();
+      }
+      file.Write();
+   }
+
+   {
+      TChain chain("dict");
+      chain.Add(inputs[0]);
+      chain.Add(inputs[1]);
+      TFile file("TBranchCompressionDictionaryMerge.root", "RECREATE", "", 505);
+      auto merged = chain.CloneTree(0);
+      merged->SetCompressionDictionary(20, 4096);
+      EXPECT_EQ(10000, merged->CopyEntries(&chain, -1, "fast"));
+      file.Write();
+   }
+
+   {
+      TFile file("TBranchCompressionDictionaryMerge.root");
+      auto tree = file.Get<TTree>("dict");
+      ASSERT_NE(nullptr, tree);
+      ASSERT_EQ(10000, tree->GetEntries());
+      char label[64];
+      tree->SetBranchAddress("label", label);
+      char expected[64];
+      for (Long64_t ev = 0; ev < tree->GetEntries(); ++ev) {
+         tree->GetEntry(ev);
+         if (ev < 5000)
+            snprintf(expected, sizeof(expected), "event %lld run 7 detector=tracker", ev);
+         else
+            snprintf(expected, sizeof(expected), "input two: lumi %lld, calo", ev - 5000);
+         ASSERT_STREQ(expected, label);
+      }
+   }
+   gSystem->Unlink(inputs[0]);
+   gSystem->Unlink(inputs[1]);
+   gSystem->Unlink("TBranchCompressionDictionaryMerge.root");
+}
+
+// Dictionaries are identified in the compressed buffers by a 32 bit hash of their content, which different
+// dictionaries can share: each buffer must still be decompressed with its own dictionary.
+TEST(TBranch, CompressionDictionaryIdCollision)
+{
+   auto train = [](const char *format) {
+      std::vector<char> samples;
+      std::vector<int> sizes;
+      char sample[128];
+      for (int i = 0; i < 1000; ++i) {
+         int n = snprintf(sample, sizeof(sample), format, i, i % 7, i * 13);
+         samples.insert(samples.end(), sample, sample + n);
+         sizes.push_back(n);
+      }
+      std::vector<char> dict(4096);
+      dict.resize(R__trainZSTDDict(dict.data(), dict.size(), samples.data(), sizes.data(), sizes.size()));
+      return dict;
+   };
+   auto dict1 = train("event %d run %d track px=%d py=0 pz=1");
+   auto dict2 = train("{\"cell\": %d, \"layer\": %d, \"energy\": %d}");
+   ASSERT_GT(dict1.size(), 8u);
+   ASSERT_GT(dict2.size(), 8u);
+   // the identifier follows the 4 byte magic number of the dictionary
+   std::copy(dict1.begin() + 4, dict1.begin() + 8, dict2.begin() + 4);
+
+   auto handle1 = R__addZSTDDict(dict1.data(), dict1.size());
+   auto handle2 = R__addZSTDDict(dict2.data(), dict2.size());
+   ASSERT_NE(nullptr, handle1);
+   ASSERT_NE(nullptr, handle2);
+   EXPECT_NE(handle1, handle2);
+   EXPECT_EQ(handle1, R__addZSTDDict(dict1.data(), dict1.size()));
+   R__releaseZSTDDict(handle1);
+
+   auto roundTrip = [](std::string input, R__ZSTDDict *dict) {
+      int srcsize = input.size();
+      int tgtsize = input.size() + 64;
+      int nout = 0;
+      std::vector<char> zipped(tgtsize);
+      R__zipZSTDDict(5, &srcsize, &input[0], &tgtsize, zipped.data(), &nout, dict);
+      EXPECT_GT(nout, 0);
+      std::string output(input.size(), '\0');
+      int nin = nout;
+      int nunzipped = 0;
+      R__unzipZSTD(&nin, reinterpret_cast<unsigned char *>(zipped.data()), &srcsize,
+                   reinterpret_cast<unsigned char *>(&output[0]), &nunzipped);
+      EXPECT_EQ(srcsize, nunzipped);
+      return output;
+   };
+   const std::string input1 = "event 12 run 5 track px=156 py=0 pz=1 event 13 run 6 track px=169 py=0 pz=1";
+   const std::string input2 = "{\"cell\": 12, \"layer\": 5, \"energy\": 156}{\"cell\": 13, \"layer\": 6, \"energy\": 169}";
+   EXPECT_EQ(input1, roundTrip(input1, handle1));
+   EXPECT_EQ(input2, roundTrip(input2, handle2));
+
+   R__releaseZSTDDict(handle1);
+   R__releaseZSTDDict(handle2);
+}
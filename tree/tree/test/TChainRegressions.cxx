@@ -1,11 +1,15 @@
 #include <TChain.h>
 #include <TFile.h>
+#include <TROOT.h>
 #include <TSystem.h>
 #include <TTree.h>
- 
+#include <TTreeCache.h>
+
 #include "gtest/gtest.h"
 
-class TTreeCache;
+#include <memory>
+#include <string>
+#include <vector>
 
 // ROOT-10672
 TEST(TChain, GetReadCacheBug)
@@ -30,3 +34,117 @@ TEST(TChain, GetReadCacheBug)
 
    gSystem->Unlink(filename);
 }
+
+TEST(TChain, SharedLearnedBranches)
+{
+   const auto treename = "tree";
+   const auto filename = "tchain_sharedlearnedbranches.root";
+   {
+      TFile f(filename, "recreate");
+      ASSERT_FALSE(f.IsZombie());
+      TTree t(treename, treename);
+      int x = 0, y = 0, z = 0;
+      t.Branch("x", &x);
+      t.Branch("y", &y);
+      t.Branch("z", &z);
+      for (int i = 0; i < 1000; ++i) {
+         x = y = z = i;
+         t.Fill();
+      }
+      t.Write();
+      f.Close();
+   }
+
+   auto learned = std::make_shared<ROOT::Internal::TTreeCacheLearnedBranches>();
+   {
+      TChain chain(treename);
+      chain.Add(filename);
+      chain.SetCacheLearnedBranches(learned);
+      chain.SetBranchStatus("*", false);
+      chain.SetBranchStatus("x", true);
+      chain.SetBranchStatus("y", true);
+      for (Long64_t i = 0; i < chain.GetEntries(); ++i)
+         chain.GetEntry(i);
+   }
+   ASSERT_TRUE(learned->IsSet());
+   EXPECT_EQ(learned->GetNames(), std::vector<std::string>({"x", "y"}));
+
+   // A second chain, e.g. of another thread, skips the learning phase
+   TChain chain(treename);
+   chain.Add(filename);
+   chain.SetCacheLearnedBranches(learned);
+   chain.GetEntry(0);
+   TTreeCache *treecache = chain.GetReadCache(chain.GetCurrentFile());
+   ASSERT_NE(treecache, nullptr);
+   EXPECT_FALSE(treecache->IsLearning());
+   EXPECT_EQ(treecache->GetCachedBranches()->GetEntries(), 2);
+
+   gSystem->Unlink(filename);
+}
+
+TEST(TChain, PrefetchNextFile)
+{
+   const auto treename = "tree";
+   const std::vector<std::string> filenames{"tchain_prefetchnextfile_0.root", "tchain_prefetchnextfile_1.root",
+                                            "tchain_prefetchnextfile_2.root"};
+   int value = 0;
+   for (const auto &filename : filenames) {
+      TFile f(filename.c_str(), "recreate");
+      ASSERT_FALSE(f.IsZombie());
+      TTree t(treename, treename);
+      t.Branch("x", &value);
+      for (int i = 0; i < 500; ++i) {
+         t.Fill();
+         ++value;
+      }
+      t.Write();
+      f.Close();
+   }
+
+   TChain chain(treename);
+   for (const auto &filename : filenames)
+      chain.Add(filename.c_str());
+   ROOT::EnableThreadSafety();
+   chain.SetPrefetchNextFile();
+   int x = -1;
+   chain.SetBranchAddress("x", &x);
+   TTreeCache *firstTreeCache = nullptr;
+   for (Long64_t i = 0; i < chain.GetEntries(); ++i) {
+      chain.GetEntry(i);
+      EXPECT_EQ(x, i);
+      if (i == 0)
+         firstTreeCache = chain.GetReadCache(chain.GetCurrentFile());
+   }
+
+   // The first cluster of the last tree was pre-read with the branches learned on the first tree
+   EXPECT_EQ(chain.GetTreeNumber(), 2);
+   TTreeCache *treecache = chain.GetReadCache(chain.GetCurrentFile());
+   ASSERT_NE(treecache, nullptr);
+   EXPECT_FALSE(treecache->IsLearning());
+   EXPECT_EQ(treecache->GetCachedBranches()->GetEntries(), 1);
+   // Without the prefetch, the cache of the first tree would have been moved to the last tree and would span it
+   EXPECT_NE(treecache, firstTreeCache);
+   EXPECT_EQ(treecache->GetEntryMax(), 500);
+
+   // The prefetched cache only reads the entries of the last tree in the cache entry range of the chain
+   TChain rangeChain(treename);
+   for (const auto &filename : filenames)
+      rangeChain.Add(filename.c_str());
+   rangeChain.SetPrefetchNextFile();
+   rangeChain.SetBranchAddress("x", &x);
+   rangeChain.SetCacheEntryRange(200, 1300);
+   for (Long64_t i = 200; i < 1300; ++i) {
+      rangeChain.GetEntry(i);
+      EXPECT_EQ(x, i);
+   }
+   EXPECT_EQ(rangeChain.GetTreeNumber(), 2);
+   treecache = rangeChain.GetReadCache(rangeChain.GetCurrentFile());
+   ASSERT_NE(treecache, nullptr);
+   EXPECT_EQ(treecache->GetEntryMin(), 0);
+   EXPECT_EQ(treecache->GetEntryMax(), 300);
+
+   rangeChain.Reset();
+   chain.Reset();
+   for (const auto &filename : filenames)
+      gSystem->Unlink(filename.c_str());
+}
@@ -1,10 +1,12 @@
 #include "TFile.h"
+#include "TFileMerger.h"
 #include "TTree.h"
 #include "TBranch.h"
 #include "TBasket.h"
 #include "TBranchElement.h"
 #include "TLeafElement.h"
 #include "TRandom.h"
+#include "TSystem.h"
 
 #include "gtest/gtest.h"
 
@@ -185,3 +187,121 @@ TEST_F(TOffsetGeneration, elementsTest)
 
    ASSERT_TRUE(br->GetTotalSize() < fEventCount * 10);
 }
+
+TEST(TOffsetGenerationCollections, collectionCounts)
+{
+   constexpr Int_t kEventCount = 10000;
+   for (auto withCounts : {true, false}) {
+      const char *fileName = withCounts ? "TOffsetGenerationCounts1.root" : "TOffsetGenerationCounts2.root";
+      {
+         TFile file(fileName, "RECREATE");
+         TTree tree("tree", "A test tree");
+         if (withCounts) {
+            ROOT::TIOFeatures features;
+            features.Set(ROOT::Experimental::EIOFeatures::kCollectionCounts);
+            tree.SetIOFeatures(features);
+         }
+         std::vector<float> values;
+         tree.Branch("values", &values);
+         for (Int_t ev = 0; ev < kEventCount; ev++) {
+            values.clear();
+            for (Int_t idx = 0; idx < ev % 10; idx++)
+               values.push_back(ev + 0.5f * idx);
+            tree.Fill();
+         }
+         file.Write();
+      }
+
+      TFile file(fileName);
+      auto tree = file.Get<TTree>("tree");
+      ASSERT_NE(tree, nullptr);
+      auto br = static_cast<TBranchElement *>(tree->GetBranch("values"));
+      ASSERT_NE(br, nullptr);
+      EXPECT_EQ(withCounts, br->HasCollectionCounts());
+
+      // Without the per-entry collection headers, the entry sizes are multiples of the value size
+      auto basket = br->GetBasket(0);
+      ASSERT_NE(basket, nullptr);
+      Int_t *offsetArray = basket->GetEntryOffset();
+      ASSERT_NE(offsetArray, nullptr);
+      for (Int_t idx = 0; idx + 1 < basket->GetNevBuf(); idx++) {
+         Int_t size = offsetArray[idx + 1] - offsetArray[idx];
+         EXPECT_EQ(withCounts ? (idx % 10) * 4 : (idx % 10) * 4 + 10, size);
+      }
+      if (withCounts)
+         EXPECT_LT(br->GetTotBytes(), kEventCount * 24);
+      else
+         EXPECT_GT(br->GetTotBytes(), kEventCount * 30);
+
+      std::vector<float> *values = nullptr;
+      tree->SetBranchAddress("values", &values);
+      for (Int_t ev = 0; ev < kEventCount; ev++) {
+         tree->GetEntry(ev);
+         ASSERT_EQ(static_cast<std::size_t>(ev % 10), values->size());
+         for (Int_t idx = 0; idx < ev % 10; idx++)
+            ASSERT_EQ(ev + 0.5f * idx, (*values)[idx]);
+      }
+      tree->ResetBranchAddresses();
+      delete values;
+   }
+}
+
+TEST(TOffsetGenerationCollections, collectionCountsMerge)
+{
+   constexpr Int_t kEventCount = 1000;
+   const char *inputNames[] = {"TOffsetGenerationMerge1.root", "TOffsetGenerationMerge2.root"};
+   const char *outputName = "TOffsetGenerationMerge3.root";
+
+   // One input with and one without the collection counts layout
+   for (auto i : {0, 1}) {
+      TFile file(inputNames[i], "RECREATE");
+      TTree tree("tree", "A test tree");
+      if (i == 0) {
+         ROOT::TIOFeatures features;
+         features.Set(ROOT::Experimental::EIOFeatures::kCollectionCounts);
+         tree.SetIOFeatures(features);
+      }
+      std::vector<float> values;
+      tree.Branch("values", &values);
+      for (Int_t ev = 0; ev < kEventCount; ev++) {
+         values.assign(ev % 10, i * kEventCount + ev);
+         tree.Fill();
+      }
+      file.Write();
+   }
+
+   // Merges like hadd: the baskets of both inputs are copied as they are, each one records its own layout
+   {
+      TFileMerger merger(kFALSE, kFALSE);
+      merger.SetPrintLevel(0);
+      ASSERT_TRUE(merger.OutputFile(outputName, "RECREATE"));
+      for (auto name : inputNames)
+         ASSERT_TRUE(merger.AddFile(name));
+      ASSERT_TRUE(merger.Merge());
+   }
+
+   {
+      TFile file(outputName);
+      auto tree = file.Get<TTree>("tree");
+      ASSERT_NE(tree, nullptr);
+      ASSERT_EQ(2 * kEventCount, tree->GetEntries());
+      auto br = static_cast<TBranchElement *>(tree->GetBranch("values"));
+      ASSERT_NE(br, nullptr);
+      EXPECT_TRUE(br->HasCollectionCounts());
+
+      std::vector<float> *values = nullptr;
+      tree->SetBranchAddress("values", &values);
+      for (Int_t entry = 0; entry < 2 * kEventCount; entry++) {
+         tree->GetEntry(entry);
+         ASSERT_EQ(static_cast<std::size_t>(entry % kEventCount % 10), values->size());
+         for (auto v : *values)
+            ASSERT_EQ(static_cast<float>(entry), v);
+      }
+      tree->ResetBranchAddresses();
+      delete values;
+   }
+
+   for (auto name : inputNames)
+      gSystem->Unlink(name);
+   gSystem->Unlink(outputName);
+}
@@ -18,6 +18,7 @@
 #include "TChain.h"
 #include "TEntryList.h"
 #include "TTreeReader.h"
+#include "TTreeCache.h"
 #include "TError.h"
 #include "TEntryList.h"
 #include "TFriendElement.h"
@@ -77,7 +78,8 @@ public:
    std::unique_ptr<TTreeReader> GetTreeReader(Long64_t start, Long64_t end, const std::vector<std::string> &treeName,
                                               const std::vector<std::string> &fileNames, const FriendInfo &friendInfo,
                                               const TEntryList &entryList, const std::vector<Long64_t> &nEntries,
-                                              const std::vector<std::vector<Long64_t>> &friendEntries);
+                                              const std::vector<std::vector<Long64_t>> &friendEntries,
+                                              const std::shared_ptr<TTreeCacheLearnedBranches> &learnedBranches);
 };
 } // End of namespace Internal
 
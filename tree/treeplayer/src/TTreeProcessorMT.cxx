@@ -332,11 +332,13 @@ void TTreeView::MakeChain(const std::vector<std::string> &treeNames, const std::
 
 //////////////////////////////////////////////////////////////////////////
 /// Get a TTreeReader for the current tree of this view.
+/// The TTreeCache of the tree shares its learned branches through `learnedBranches`.
 std::unique_ptr<TTreeReader>
 TTreeView::GetTreeReader(Long64_t start, Long64_t end, const std::vector<std::string> &treeNames,
                          const std::vector<std::string> &fileNames, const FriendInfo &friendInfo,
                          const TEntryList &entryList, const std::vector<Long64_t> &nEntries,
-                         const std::vector<std::vector<Long64_t>> &friendEntries)
+                         const std::vector<std::vector<Long64_t>> &friendEntries,
+                         const std::shared_ptr<TTreeCacheLearnedBranches> &learnedBranches)
 {
    const bool hasEntryList = entryList.GetN() > 0;
    const bool usingLocalEntries = friendInfo.fFriendNames.empty() && !hasEntryList;
@@ -352,6 +354,8 @@ TTreeView::GetTreeReader(Long64_t start, Long64_t end, const std::vector<std::st
          }
       }
    }
+   // The cache of the chain skips its learning phase if the cache of another chain already learned the branches
+   fChain->SetCacheLearnedBranches(learnedBranches);
    auto reader = std::make_unique<TTreeReader>(fChain.get(), fEntryList.get());
    reader->SetEntriesRange(start, end);
    return reader;
@@ -583,6 +587,9 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    const auto &clusters = clusterAndEntries.first;
    const auto &entries = clusterAndEntries.second;
 
+   // The TTreeCaches of all tasks use the branches learned by the first one that completes its learning phase
+   const auto learnedBranches = std::make_shared<Internal::TTreeCacheLearnedBranches>();
+
    // Retrieve number of entries for each file for each friend tree
    const auto friendEntries =
       hasFriends ? GetFriendEntries(friendNames, friendFileNames) : std::vector<std::vector<Long64_t>>{};
@@ -607,7 +614,7 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
 
       auto processCluster = [&](const EntryCluster &c) {
          auto r = fTreeView->GetTreeReader(c.start, c.end, theseTrees, theseFiles, fFriendInfo, fEntryList,
-                                           theseEntries, friendEntries);
+                                           theseEntries, friendEntries, learnedBranches);
          func(*r);
       };
 